@@ -0,0 +1,423 @@
+// Decoder throughput over fixed corpora, for every API mode.
+// Prints JSON (see README.md); compare two runs with Tools/disa_bench_compare.py.
+//
+//	disa_bench [--time seconds] [--mode name] [blob.bin ...]
+//
+// The synthetic corpora are generated from the opcode table, so the same
+// tree always benchmarks the same bytes (each corpus' hash is in the output).
+// Any files given are decoded as raw 32-bit code, as well.
+#include "../DISA/disa.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <string>
+#include <vector>
+
+// Every allocation in the process goes through here, so the modes can be
+// charged for theirs
+static std::atomic<std::size_t> allocations(0);
+
+void* operator new(const std::size_t size)
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+
+	if (void* p = std::malloc(size ? size : 1))
+	{
+		return p;
+	}
+
+	throw std::bad_alloc();
+}
+
+void* operator new[](const std::size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+// Resets the peak resident set size, so each mode reports its own (Linux only)
+static void reset_peak_rss()
+{
+#ifdef __linux__
+	if (FILE* f = std::fopen("/proc/self/clear_refs", "w"))
+	{
+		std::fputs("5", f);
+		std::fclose(f);
+	}
+#endif
+}
+
+// Peak resident set size in KB, -1 where it isn't known
+static long peak_rss_kb()
+{
+	long kb = -1;
+#ifdef __linux__
+	if (FILE* f = std::fopen("/proc/self/status", "r"))
+	{
+		char line[256];
+
+		while (std::fgets(line, sizeof(line), f))
+		{
+			if (std::strncmp(line, "VmHWM:", 6) == 0)
+			{
+				kb = std::strtol(line + 6, nullptr, 10);
+			}
+		}
+
+		std::fclose(f);
+	}
+#endif
+	return kb;
+}
+
+struct bench_corpus
+{
+	std::string name;
+	std::vector<std::uint8_t> bytes;
+};
+
+constexpr std::uintptr_t BENCH_ADDRESS = 0x401000;
+
+// Tries every opcode byte after each of these, with every ModRM byte
+static const std::vector<std::vector<std::uint8_t>> BENCH_OPCODE_MAPS =
+{
+	{}, { 0x0F }, { 0x66 }, { 0x66, 0x0F }, { 0xF2 }, { 0xF2, 0x0F }, { 0xF3 }, { 0xF3, 0x0F },
+	{ 0x0F, 0x38 }, { 0x66, 0x0F, 0x38 }, { 0xF2, 0x0F, 0x38 }, { 0x0F, 0x3A }, { 0x66, 0x0F, 0x3A },
+};
+
+// One of each valid encoding the opcode table has a row for: every map and
+// opcode byte, with every ModRM byte, followed by a fixed SIB/displacement/immediate.
+// Only the bytes that decode to a known row are kept, so decoding the corpus
+// from the start gives back exactly these instructions
+static bench_corpus all_forms_corpus()
+{
+	bench_corpus corpus = { "all_forms", {} };
+	const std::uint8_t tail[] = { 0x24, 0x78, 0x56, 0x34, 0x12, 0xEF, 0xCD, 0xAB, 0x89, 0x67, 0x45, 0x23, 0x01 };
+
+	for (const auto& map : BENCH_OPCODE_MAPS)
+	{
+		for (std::size_t op = 0; op < 256; op++)
+		{
+			for (std::size_t modrm = 0; modrm < 256; modrm++)
+			{
+				std::uint8_t candidate[32];
+				std::size_t n = 0;
+
+				for (const auto byte : map)
+				{
+					candidate[n++] = byte;
+				}
+
+				candidate[n++] = static_cast<std::uint8_t>(op);
+				candidate[n++] = static_cast<std::uint8_t>(modrm);
+				std::memcpy(candidate + n, tail, sizeof(tail));
+				n += sizeof(tail);
+
+				disa_record record;
+
+				if (disa_decode(candidate, n, BENCH_ADDRESS, record) && record.row != DISA_NO_ROW)
+				{
+					corpus.bytes.insert(corpus.bytes.end(), candidate, candidate + record.len);
+				}
+			}
+		}
+	}
+
+	return corpus;
+}
+
+// Instructions a compiler emits most, picked from all_forms in a fixed pseudo-random order
+static bench_corpus common_mix_corpus(const bench_corpus& all_forms)
+{
+	static const char* const common[] =
+	{
+		"mov", "push", "pop", "call", "jmp", "jmp short", "je", "je short", "jne", "jne short",
+		"lea", "add", "sub", "cmp", "test", "xor", "and", "or", "ret", "inc", "dec", "movzx",
+	};
+
+	std::vector<std::pair<std::size_t, std::size_t>> picks; // offset, length in all_forms
+
+	for (const auto& rec : disa_stream(all_forms.bytes.data(), all_forms.bytes.size(), BENCH_ADDRESS))
+	{
+		const char* name = disa_mnemonic_name(rec.mnemonic());
+
+		if (std::any_of(std::begin(common), std::end(common), [name](const char* c) { return std::strcmp(c, name) == 0; }))
+		{
+			picks.emplace_back(rec.address - BENCH_ADDRESS, rec.len);
+		}
+	}
+
+	bench_corpus corpus = { "common_mix", {} };
+	std::uint32_t state = 12345;
+
+	for (std::size_t i = 0; i < 256 * 1024 && !picks.empty(); i++)
+	{
+		state = state * 1103515245 + 12345; // the same sequence everywhere
+		const auto& pick = picks[(state >> 8) % picks.size()];
+		corpus.bytes.insert(corpus.bytes.end(), all_forms.bytes.begin() + pick.first, all_forms.bytes.begin() + pick.first + pick.second);
+	}
+
+	return corpus;
+}
+
+static bool load_corpus(const std::string& path, bench_corpus& corpus)
+{
+	std::ifstream in(path, std::ios::binary);
+
+	if (!in)
+	{
+		return false;
+	}
+
+	corpus.name = path.substr(path.find_last_of("/\\") + 1);
+	corpus.bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	return true;
+}
+
+static std::uint64_t corpus_hash(const std::vector<std::uint8_t>& bytes)
+{
+	std::uint64_t hash = 0xCBF29CE484222325ull; // FNV-1a
+
+	for (const auto byte : bytes)
+	{
+		hash = (hash ^ byte) * 0x100000001B3ull;
+	}
+
+	return hash;
+}
+
+// A way of using the API. Decodes the whole corpus once, returns the number of instructions
+struct bench_mode
+{
+	const char* name;
+	std::size_t (*run)(const std::vector<std::uint8_t>& bytes);
+};
+
+static std::size_t run_text(const std::vector<std::uint8_t>& bytes)
+{
+	return disa_ranged_read(bytes.data(), bytes.size(), BENCH_ADDRESS, true).size();
+}
+
+static std::size_t run_structure(const std::vector<std::uint8_t>& bytes)
+{
+	return disa_ranged_read(bytes.data(), bytes.size(), BENCH_ADDRESS, false).size();
+}
+
+static std::size_t run_record(const std::vector<std::uint8_t>& bytes)
+{
+	std::size_t count = 0;
+	disa_record record;
+
+	for (std::size_t offset = 0; offset < bytes.size(); count++)
+	{
+		offset += disa_decode(bytes.data() + offset, bytes.size() - offset, BENCH_ADDRESS + offset, record);
+	}
+
+	return count;
+}
+
+static std::size_t run_batch(const std::vector<std::uint8_t>& bytes)
+{
+	static disa_batch batch; // kept between runs, like a caller reusing one would
+	batch.clear();
+	return disa_decode_batch(bytes.data(), bytes.size(), BENCH_ADDRESS, batch);
+}
+
+static std::size_t run_length(const std::vector<std::uint8_t>& bytes)
+{
+	std::uint8_t lengths[4096];
+	std::size_t count = 0;
+
+	for (std::size_t offset = 0; offset < bytes.size();)
+	{
+		const std::size_t n = disa_lengths(bytes.data() + offset, bytes.size() - offset, lengths, sizeof(lengths));
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			offset += lengths[i];
+		}
+
+		if (n < sizeof(lengths) && offset < bytes.size())
+		{
+			offset++; // not an instruction, step over the byte
+		}
+
+		count += n;
+	}
+
+	return count;
+}
+
+static volatile std::uint32_t bench_sink; // so the stream loop isn't optimized away
+
+static std::size_t run_stream(const std::vector<std::uint8_t>& bytes)
+{
+	std::size_t count = 0;
+	std::uint32_t sink = 0;
+
+	for (const auto& rec : disa_stream(bytes.data(), bytes.size(), BENCH_ADDRESS))
+	{
+		sink += rec.row;
+		count++;
+	}
+
+	bench_sink = sink;
+	return count;
+}
+
+static std::size_t run_format(const std::vector<std::uint8_t>& bytes)
+{
+	std::size_t count = 0;
+	char text[DISA_TEXT_SIZE];
+
+	for (const auto& rec : disa_stream(bytes.data(), bytes.size(), BENCH_ADDRESS))
+	{
+		disa_format(rec, text, sizeof(text));
+		count++;
+	}
+
+	return count;
+}
+
+static const bench_mode BENCH_MODES[] =
+{
+	{ "text", run_text },			// disa_ranged_read, with text
+	{ "structure", run_structure },	// disa_ranged_read, without text
+	{ "record", run_record },		// disa_decode into a disa_record
+	{ "batch", run_batch },			// disa_decode_batch
+	{ "length", run_length },		// disa_lengths
+	{ "stream", run_stream },		// disa_stream
+	{ "format", run_format },		// disa_stream + disa_format into a buffer
+};
+
+int main(int argc, char** argv)
+{
+	double min_time = 0.5;
+	std::string only;
+	std::vector<bench_corpus> corpora;
+
+	corpora.push_back(all_forms_corpus());
+	corpora.push_back(common_mix_corpus(corpora[0]));
+
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+
+		if (arg == "--time" && i + 1 < argc)
+		{
+			min_time = std::atof(argv[++i]);
+		}
+		else if (arg == "--mode" && i + 1 < argc)
+		{
+			only = argv[++i];
+		}
+		else
+		{
+			bench_corpus corpus;
+
+			if (!load_corpus(arg, corpus))
+			{
+				std::fprintf(stderr, "can't read %s\n", arg.c_str());
+				return 1;
+			}
+
+			corpora.push_back(std::move(corpus));
+		}
+	}
+
+	std::printf("{\n\t\"format\": 1,\n\t\"min_time\": %g,\n\t\"corpora\": [", min_time);
+
+	for (std::size_t c = 0; c < corpora.size(); c++)
+	{
+		const auto& corpus = corpora[c];
+
+		// which rows of the opcode table the corpus has
+		std::vector<bool> forms(FORM_COUNT);
+		std::size_t instructions = 0;
+
+		for (const auto& rec : disa_stream(corpus.bytes.data(), corpus.bytes.size(), BENCH_ADDRESS))
+		{
+			if (rec.row < FORM_COUNT)
+			{
+				forms[rec.row] = true;
+			}
+
+			instructions++;
+		}
+
+		std::printf("%s\n\t\t{\n", c ? "," : "");
+		std::printf("\t\t\t\"name\": \"%s\",\n", corpus.name.c_str());
+		std::printf("\t\t\t\"hash\": \"%016llx\",\n", static_cast<unsigned long long>(corpus_hash(corpus.bytes)));
+		std::printf("\t\t\t\"bytes\": %zu,\n", corpus.bytes.size());
+		std::printf("\t\t\t\"instructions\": %zu,\n", instructions);
+		std::printf("\t\t\t\"forms_covered\": %zu,\n", static_cast<std::size_t>(std::count(forms.begin(), forms.end(), true)));
+		std::printf("\t\t\t\"forms_total\": %zu,\n", static_cast<std::size_t>(FORM_COUNT));
+		std::printf("\t\t\t\"modes\": [");
+
+		bool first = true;
+
+		for (const auto& mode : BENCH_MODES)
+		{
+			if (!only.empty() && only != mode.name)
+			{
+				continue;
+			}
+
+			reset_peak_rss();
+
+			// the first run counts the allocations, the rest are timed
+			const std::size_t before = allocations.load();
+			const std::size_t count = mode.run(corpus.bytes);
+			const std::size_t allocated = allocations.load() - before;
+
+			double best = 1e30;
+			double total = 0;
+
+			for (std::size_t runs = 0; runs < 3 || total < min_time; runs++)
+			{
+				const auto start = std::chrono::steady_clock::now();
+				mode.run(corpus.bytes);
+				const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+				best = std::min(best, seconds);
+				total += seconds;
+			}
+
+			const double n = count ? double(count) : 1.0;
+
+			std::printf("%s\n\t\t\t\t{ \"mode\": \"%s\", \"instructions\": %zu, \"seconds\": %.6f, \"instructions_per_sec\": %.0f, \"mb_per_sec\": %.2f, \"ns_per_instruction\": %.2f, \"allocations_per_instruction\": %.3f, \"peak_rss_kb\": %ld }",
+				first ? "" : ",", mode.name, count, best, count / best, corpus.bytes.size() / best / (1024.0 * 1024.0), best * 1e9 / n, allocated / n, peak_rss_kb());
+
+			first = false;
+		}
+
+		std::printf("\n\t\t\t]\n\t\t}");
+	}
+
+	std::printf("\n\t]\n}\n");
+	return 0;
+}
@@ -0,0 +1,230 @@
+#include "disa_cfg.hpp"
+#include "disa_descent.hpp"
+#include "disa_flow.hpp"
+#include <algorithm>
+
+disa_cfg::disa_cfg(std::vector<disa_record> records, const std::vector<std::uintptr_t>& functions)
+	: records(std::move(records))
+{
+	const auto by_address = [](const disa_record& a, const disa_record& b) { return a.address < b.address; };
+
+	if (!std::is_sorted(this->records.begin(), this->records.end(), by_address))
+	{
+		std::sort(this->records.begin(), this->records.end(), by_address);
+	}
+
+	build(functions);
+}
+
+disa_cfg::disa_cfg(const disa_descent& descent)
+	: records(descent.get_records())
+{
+	build(descent.get_functions());
+}
+
+std::size_t disa_cfg::find_record(const std::uintptr_t address) const
+{
+	const auto it = std::lower_bound(records.begin(), records.end(), address,
+		[](const disa_record& rec, const std::uintptr_t at) { return rec.address < at; });
+
+	return it != records.end() && it->address == address ? it - records.begin() : records.size();
+}
+
+std::uint32_t disa_cfg::block_of(const std::uintptr_t address) const
+{
+	const auto it = std::upper_bound(block_starts.begin(), block_starts.end() - 1, address,
+		[this](const std::uintptr_t at, const std::uint32_t start) { return at < records[start].address; });
+
+	if (it == block_starts.begin())
+	{
+		return NO_BLOCK;
+	}
+
+	const std::uint32_t block = std::uint32_t(it - block_starts.begin() - 1);
+	const auto& last = records[block_starts[block + 1] - 1];
+
+	return address < last.address + last.len ? block : NO_BLOCK;
+}
+
+// Turns per-block edge counts (in offsets[1...]) into CSR offsets
+static void prefix_sum(std::vector<std::uint32_t>& offsets)
+{
+	for (std::size_t i = 1; i < offsets.size(); i++)
+	{
+		offsets[i] += offsets[i - 1];
+	}
+}
+
+void disa_cfg::build(const std::vector<std::uintptr_t>& functions)
+{
+	const std::size_t n = records.size();
+
+	// 1. leaders: function starts, branch targets, and whatever follows
+	// a branch, a ret or a gap between instructions
+	std::vector<std::uint8_t> leader(n + 1, 0);
+	std::vector<std::uint32_t> targets(n, NO_BLOCK); // record index of the branch target, until the blocks exist
+	std::vector<disa_flow_kind> kinds(n);
+
+	if (n)
+	{
+		leader[0] = 1;
+	}
+
+	leader[n] = 1;
+
+	for (const auto function : functions)
+	{
+		leader[find_record(function)] = 1;
+	}
+
+	for (std::size_t i = 0; i < n; i++)
+	{
+		const auto& rec = records[i];
+		kinds[i] = disa_flow(rec);
+
+		std::uintptr_t target;
+
+		if ((kinds[i] == DISA_FLOW_JCC || kinds[i] == DISA_FLOW_JMP) && rec.branch_target(target))
+		{
+			const std::size_t j = find_record(target);
+
+			if (j != n)
+			{
+				leader[j] = 1;
+				targets[i] = std::uint32_t(j);
+			}
+		}
+
+		const bool ends_block = kinds[i] != DISA_FLOW_NONE && kinds[i] != DISA_FLOW_CALL && kinds[i] != DISA_FLOW_INDIRECT_CALL;
+
+		if (ends_block || (i + 1 < n && records[i + 1].address != rec.address + rec.len))
+		{
+			leader[i + 1] = 1;
+		}
+	}
+
+	// 2. blocks
+	std::vector<std::uint32_t> block_index(n); // block of every record
+
+	block_starts.clear();
+
+	for (std::size_t i = 0; i < n; i++)
+	{
+		if (leader[i])
+		{
+			block_starts.push_back(std::uint32_t(i));
+		}
+
+		block_index[i] = std::uint32_t(block_starts.size() - 1);
+	}
+
+	block_starts.push_back(std::uint32_t(n));
+
+	const std::size_t nblocks = block_starts.size() - 1;
+
+	// 3. successors: blocks are in address order, so they come out already in CSR order
+	successor_offsets.assign(nblocks + 1, 0);
+	successors.clear();
+	successor_kinds.clear();
+
+	for (std::size_t b = 0; b < nblocks; b++)
+	{
+		const std::size_t last = block_starts[b + 1] - 1;
+		const auto& rec = records[last];
+
+		if (disa_flow_falls_through(kinds[last]) && last + 1 < n && records[last + 1].address == rec.address + rec.len)
+		{
+			successors.push_back(block_index[last + 1]);
+			successor_kinds.push_back(DISA_EDGE_FALLTHROUGH);
+		}
+
+		if (targets[last] != NO_BLOCK)
+		{
+			successors.push_back(block_index[targets[last]]);
+			successor_kinds.push_back(DISA_EDGE_BRANCH);
+		}
+
+		successor_offsets[b + 1] = std::uint32_t(successors.size());
+	}
+
+	// 4. predecessors: counting sort of the edges by target
+	predecessor_offsets.assign(nblocks + 1, 0);
+
+	for (const auto to : successors)
+	{
+		predecessor_offsets[to + 1]++;
+	}
+
+	prefix_sum(predecessor_offsets);
+
+	predecessors.resize(successors.size());
+	predecessor_kinds.resize(successors.size());
+
+	std::vector<std::uint32_t> fill(predecessor_offsets.begin(), predecessor_offsets.end() - 1);
+
+	for (std::uint32_t b = 0; b < nblocks; b++)
+	{
+		for (std::uint32_t e = successor_offsets[b]; e < successor_offsets[b + 1]; e++)
+		{
+			const std::uint32_t at = fill[successors[e]]++;
+			predecessors[at] = b;
+			predecessor_kinds[at] = successor_kinds[e];
+		}
+	}
+
+	// 5. functions: the blocks reachable from each start, stopping at other starts
+	function_addresses.clear();
+
+	std::vector<std::uint8_t> is_function(nblocks, 0);
+
+	for (const auto function : functions)
+	{
+		const std::size_t i = find_record(function);
+
+		if (i != n)
+		{
+			function_addresses.push_back(function);
+			is_function[block_index[i]] = 1;
+		}
+	}
+
+	std::sort(function_addresses.begin(), function_addresses.end());
+	function_addresses.erase(std::unique(function_addresses.begin(), function_addresses.end()), function_addresses.end());
+
+	function_offsets.assign(1, 0);
+	function_blocks.clear();
+
+	std::vector<std::uint32_t> visited(nblocks, 0); // function number + 1 of the last visit, so it never needs clearing
+	std::vector<std::uint32_t> work;
+
+	for (std::size_t f = 0; f < function_addresses.size(); f++)
+	{
+		const std::uint32_t stamp = std::uint32_t(f + 1);
+		const std::uint32_t entry = block_index[find_record(function_addresses[f])];
+		const std::size_t first = function_blocks.size();
+
+		work.assign(1, entry);
+		visited[entry] = stamp;
+
+		while (!work.empty())
+		{
+			const std::uint32_t b = work.back();
+			work.pop_back();
+			function_blocks.push_back(b);
+
+			for (std::uint32_t e = successor_offsets[b]; e < successor_offsets[b + 1]; e++)
+			{
+				const std::uint32_t to = successors[e];
+
+				if (visited[to] != stamp && !is_function[to])
+				{
+					visited[to] = stamp;
+					work.push_back(to);
+				}
+			}
+		}
+
+		std::sort(function_blocks.begin() + first, function_blocks.end());
+		function_offsets.push_back(std::uint32_t(function_blocks.size()));
+	}
+}
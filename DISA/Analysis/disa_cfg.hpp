@@ -0,0 +1,94 @@
+#pragma once
+#include "../disa.hpp"
+#include "disa_span.hpp"
+
+class disa_descent;
+
+enum disa_edge_kind : std::uint8_t
+{
+	DISA_EDGE_FALLTHROUGH,	// into the next instruction (after a jcc, or a block that ends because the next one starts)
+	DISA_EDGE_BRANCH,		// taken jmp/jcc/loop/jecxz
+};
+
+// Basic blocks and control-flow graph.
+// Blocks are numbered in address order; a block is a range of the
+// (address-sorted) instructions. Edges are stored CSR-style: the
+// successors of block b are successors[successor_offsets[b]...
+// successor_offsets[b + 1]], likewise for predecessors. Nothing is a
+// node object, so passes over the graph walk flat arrays.
+//
+// Calls don't end a block and don't get an edge; a jmp into another
+// function's start is an edge (a tail call), but doesn't make the target
+// part of the function.
+class disa_cfg
+{
+private:
+	std::vector<disa_record> records; // sorted by address
+
+	std::vector<std::uint32_t> block_starts; // block b is records[block_starts[b]...block_starts[b + 1]]
+
+	std::vector<std::uint32_t> successor_offsets;
+	std::vector<std::uint32_t> successors;
+	std::vector<disa_edge_kind> successor_kinds;
+
+	std::vector<std::uint32_t> predecessor_offsets;
+	std::vector<std::uint32_t> predecessors;
+	std::vector<disa_edge_kind> predecessor_kinds;
+
+	std::vector<std::uintptr_t> function_addresses; // sorted
+	std::vector<std::uint32_t> function_offsets;
+	std::vector<std::uint32_t> function_blocks; // the blocks of each function, in address order
+
+	std::size_t find_record(const std::uintptr_t address) const; // index of the record at `address`, or records.size()
+	void build(const std::vector<std::uintptr_t>& functions);
+public:
+	static constexpr std::uint32_t NO_BLOCK = 0xFFFFFFFF;
+
+	// `records` may come from a sweep or from a recursive descent.
+	// `functions` are the function starts (entry points, call targets)
+	disa_cfg(std::vector<disa_record> records, const std::vector<std::uintptr_t>& functions);
+	explicit disa_cfg(const disa_descent& descent);
+
+	const std::vector<disa_record>& get_records() const { return records; }
+
+	std::size_t block_count() const { return block_starts.size() - 1; }
+	std::size_t edge_count() const { return successors.size(); }
+
+	std::uintptr_t block_address(const std::uint32_t block) const { return records[block_starts[block]].address; }
+	std::uint32_t block_of(const std::uintptr_t address) const; // the block containing `address`, or NO_BLOCK
+
+	// the instructions of a block
+	disa_span<disa_record> instructions(const std::uint32_t block) const
+	{
+		return { records.data() + block_starts[block], records.data() + block_starts[block + 1] };
+	}
+
+	disa_span<std::uint32_t> get_successors(const std::uint32_t block) const
+	{
+		return { successors.data() + successor_offsets[block], successors.data() + successor_offsets[block + 1] };
+	}
+
+	disa_span<disa_edge_kind> get_successor_kinds(const std::uint32_t block) const
+	{
+		return { successor_kinds.data() + successor_offsets[block], successor_kinds.data() + successor_offsets[block + 1] };
+	}
+
+	disa_span<std::uint32_t> get_predecessors(const std::uint32_t block) const
+	{
+		return { predecessors.data() + predecessor_offsets[block], predecessors.data() + predecessor_offsets[block + 1] };
+	}
+
+	disa_span<disa_edge_kind> get_predecessor_kinds(const std::uint32_t block) const
+	{
+		return { predecessor_kinds.data() + predecessor_offsets[block], predecessor_kinds.data() + predecessor_offsets[block + 1] };
+	}
+
+	std::size_t function_count() const { return function_addresses.size(); }
+	std::uintptr_t function_address(const std::size_t function) const { return function_addresses[function]; }
+
+	// the blocks reachable from a function's start without going through another function's start
+	disa_span<std::uint32_t> get_function_blocks(const std::size_t function) const
+	{
+		return { function_blocks.data() + function_offsets[function], function_blocks.data() + function_offsets[function + 1] };
+	}
+};
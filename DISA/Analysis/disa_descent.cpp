@@ -0,0 +1,165 @@
+#include "disa_descent.hpp"
+#include "disa_flow.hpp"
+#include "disa_pool.hpp"
+
+disa_descent::disa_descent(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const disa_decoder& decoder)
+	: buffer(buffer)
+	, size(size)
+	, address(address)
+	, decoder(decoder)
+	, nwords((size + 63) / 64)
+	, starts(new std::atomic<std::uint64_t>[(size + 63) / 64])
+	, function_starts(new std::atomic<std::uint64_t>[(size + 63) / 64])
+{
+	for (std::size_t i = 0; i < nwords; i++)
+	{
+		starts[i].store(0, std::memory_order_relaxed);
+		function_starts[i].store(0, std::memory_order_relaxed);
+	}
+}
+
+bool disa_descent::contains(const std::uintptr_t at) const
+{
+	return at >= address && at - address < size;
+}
+
+// Sets the bit for `offset`. Returns false if it was already set
+bool disa_descent::claim(std::atomic<std::uint64_t>* bitmap, const std::size_t offset)
+{
+	const std::uint64_t bit = std::uint64_t(1) << (offset % 64);
+	return !(bitmap[offset / 64].fetch_or(bit, std::memory_order_relaxed) & bit);
+}
+
+bool disa_descent::test(const std::atomic<std::uint64_t>* bitmap, const std::size_t offset)
+{
+	return (bitmap[offset / 64].load(std::memory_order_relaxed) >> (offset % 64)) & 1;
+}
+
+// Follows one path, until it ends or reaches code another path has claimed.
+// Branch targets are handed to `submit`, to be explored as paths of their own
+template <typename Submit>
+void disa_descent::explore(std::size_t offset, const Submit& submit)
+{
+	disa_record record;
+
+	while (offset < size && !test(starts.get(), offset))
+	{
+		decoder.decode(buffer + offset, size - offset, address + offset, record);
+
+		// bytes that don't decode end the path, and aren't code
+		if (record.row == DISA_NO_ROW || !claim(starts.get(), offset))
+		{
+			break;
+		}
+
+		const auto kind = disa_flow(record);
+		std::uintptr_t target;
+
+		if (record.branch_target(target) && contains(target))
+		{
+			const std::size_t target_offset = target - address;
+
+			if (kind == DISA_FLOW_CALL)
+			{
+				claim(function_starts.get(), target_offset);
+			}
+
+			if (!test(starts.get(), target_offset))
+			{
+				submit(target_offset);
+			}
+		}
+
+		if (!disa_flow_falls_through(kind))
+		{
+			break;
+		}
+
+		offset += record.len;
+	}
+}
+
+void disa_descent::run(const std::vector<std::uintptr_t>& entries, const std::size_t threads)
+{
+	disa_pool pool(threads);
+
+	// a task explores one path, and queues up the paths it branches to
+	std::function<void(std::size_t)> task = [this, &pool, &task](const std::size_t offset)
+	{
+		explore(offset, [&pool, &task](const std::size_t target_offset)
+		{
+			pool.submit([&task, target_offset]() { task(target_offset); });
+		});
+	};
+
+	for (const auto entry : entries)
+	{
+		if (contains(entry))
+		{
+			claim(function_starts.get(), entry - address);
+			pool.submit([&task, entry, this]() { task(entry - address); });
+		}
+	}
+
+	pool.wait();
+}
+
+bool disa_descent::is_start(const std::uintptr_t at) const
+{
+	return contains(at) && test(starts.get(), at - address);
+}
+
+bool disa_descent::is_function(const std::uintptr_t at) const
+{
+	return contains(at) && test(function_starts.get(), at - address);
+}
+
+std::vector<std::uintptr_t> disa_descent::collect(const std::atomic<std::uint64_t>* bitmap, const std::size_t nwords, const std::uintptr_t address)
+{
+	std::vector<std::uintptr_t> result;
+
+	for (std::size_t i = 0; i < nwords; i++)
+	{
+		std::uint64_t word = bitmap[i].load(std::memory_order_relaxed);
+
+		while (word)
+		{
+			std::size_t bit = 0;
+
+			while (!((word >> bit) & 1))
+			{
+				bit++;
+			}
+
+			result.push_back(address + i * 64 + bit);
+			word &= word - 1;
+		}
+	}
+
+	return result;
+}
+
+std::vector<std::uintptr_t> disa_descent::get_starts() const
+{
+	return collect(starts.get(), nwords, address);
+}
+
+std::vector<std::uintptr_t> disa_descent::get_functions() const
+{
+	return collect(function_starts.get(), nwords, address);
+}
+
+std::vector<disa_record> disa_descent::get_records() const
+{
+	const auto list = get_starts();
+
+	std::vector<disa_record> records(list.size());
+
+	for (std::size_t i = 0; i < list.size(); i++)
+	{
+		const std::size_t offset = list[i] - address;
+		decoder.decode(buffer + offset, size - offset, list[i], records[i]);
+	}
+
+	return records;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "../disa.hpp"
+#include <atomic>
+#include <memory>
+
+// Recursive-descent disassembly.
+// Starting from the entry points, instructions are decoded along every
+// path execution can take: direct call/jmp/jcc targets are followed, and
+// a path ends at a ret, an unconditional or indirect jmp, or bytes that
+// don't decode. Inline data, jump tables and padding that nothing
+// branches to are never decoded.
+//
+// Paths are explored on a work-stealing pool; a path stops as soon as
+// it reaches an instruction another path has already claimed.
+// Instruction starts and function starts (entry points and call targets)
+// are kept as one bit per byte of the region.
+class disa_descent
+{
+private:
+	const std::uint8_t* buffer;
+	std::size_t size;
+	std::uintptr_t address;
+	disa_decoder decoder;
+
+	std::size_t nwords;
+	std::unique_ptr<std::atomic<std::uint64_t>[]> starts;
+	std::unique_ptr<std::atomic<std::uint64_t>[]> function_starts;
+
+	bool contains(const std::uintptr_t at) const;
+	bool claim(std::atomic<std::uint64_t>* bitmap, const std::size_t offset);
+	static bool test(const std::atomic<std::uint64_t>* bitmap, const std::size_t offset);
+	static std::vector<std::uintptr_t> collect(const std::atomic<std::uint64_t>* bitmap, const std::size_t nwords, const std::uintptr_t address);
+
+	template <typename Submit>
+	void explore(std::size_t offset, const Submit& submit);
+public:
+	// `buffer` is located at `address` in the target, and has to outlive this object
+	disa_descent(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const disa_decoder& decoder = disa_decoder());
+
+	// Explores everything reachable from `entries`.
+	// Can be called again with more entries; what's known is kept
+	void run(const std::vector<std::uintptr_t>& entries, const std::size_t threads = 0);
+
+	bool is_start(const std::uintptr_t at) const; // an instruction starts at `at`
+	bool is_function(const std::uintptr_t at) const; // an entry point or call target
+
+	std::vector<std::uintptr_t> get_starts() const; // sorted
+	std::vector<std::uintptr_t> get_functions() const; // sorted
+	std::vector<disa_record> get_records() const; // every reachable instruction, sorted by address
+};
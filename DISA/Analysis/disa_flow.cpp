@@ -0,0 +1,71 @@
+#include "disa_flow.hpp"
+
+disa_flow_kind disa_flow(const disa_record& record)
+{
+	std::uintptr_t target;
+	const bool direct = record.branch_target(target);
+
+	switch (record.mnemonic())
+	{
+	case MN_NONE:
+	case MN_HLT:
+	case MN_UD:
+	case MN_UD2:
+		return DISA_FLOW_END;
+	case MN_RET:
+	case MN_RETN:
+	case MN_RETF:
+	case MN_IRETD:
+	case MN_SYSEXIT:
+	case MN_SYSRET:
+		return DISA_FLOW_RET;
+	case MN_CALL:
+		return direct ? DISA_FLOW_CALL : DISA_FLOW_INDIRECT_CALL;
+	case MN_CALLF:
+		return DISA_FLOW_INDIRECT_CALL;
+	case MN_JMP:
+	case MN_JMP_SHORT:
+		return direct ? DISA_FLOW_JMP : DISA_FLOW_INDIRECT_JMP;
+	case MN_JMPF:
+		return DISA_FLOW_INDIRECT_JMP;
+	case MN_JO_SHORT:
+	case MN_JNO_SHORT:
+	case MN_JB_SHORT:
+	case MN_JAE_SHORT:
+	case MN_JE_SHORT:
+	case MN_JNE_SHORT:
+	case MN_JNA_SHORT:
+	case MN_JA_SHORT:
+	case MN_JS_SHORT:
+	case MN_JNS_SHORT:
+	case MN_JP_SHORT:
+	case MN_JNP_SHORT:
+	case MN_JL_SHORT:
+	case MN_JGE_SHORT:
+	case MN_JLE_SHORT:
+	case MN_JG_SHORT:
+	case MN_LONG_JO:
+	case MN_LONG_JNO:
+	case MN_LONG_JB:
+	case MN_LONG_JNB:
+	case MN_LONG_JE:
+	case MN_LONG_JNE:
+	case MN_LONG_JNA:
+	case MN_LONG_JA:
+	case MN_LONG_JS:
+	case MN_LONG_JNS:
+	case MN_LONG_JP:
+	case MN_LONG_JNP:
+	case MN_LONG_JL:
+	case MN_LONG_JNL:
+	case MN_LONG_JNG:
+	case MN_LONG_JG:
+	case MN_LOOP:
+	case MN_LOOPE:
+	case MN_LOOPNE:
+	case MN_JECXZ:
+		return DISA_FLOW_JCC;
+	default:
+		return DISA_FLOW_NONE;
+	}
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "../disa.hpp"
+
+// What an instruction does to the flow of execution
+enum disa_flow_kind : std::uint8_t
+{
+	DISA_FLOW_NONE,				// continues with the next instruction
+	DISA_FLOW_CALL,				// call rel16/32: the target, and then the next instruction
+	DISA_FLOW_JCC,				// jcc, loop, jecxz: the target or the next instruction
+	DISA_FLOW_JMP,				// jmp rel8/16/32: only the target
+	DISA_FLOW_INDIRECT_CALL,	// call r/m, callf: somewhere unknown, and then the next instruction
+	DISA_FLOW_INDIRECT_JMP,		// jmp r/m, jmpf: only somewhere unknown
+	DISA_FLOW_RET,				// ret, retn, retf, iretd
+	DISA_FLOW_END,				// hlt, ud2, unknown bytes: nothing after it
+};
+
+// (the target of a direct call/jmp/jcc is disa_record::branch_target)
+disa_flow_kind disa_flow(const disa_record& record);
+
+// Whether execution can continue with the next instruction
+inline bool disa_flow_falls_through(const disa_flow_kind kind)
+{
+	return kind == DISA_FLOW_NONE || kind == DISA_FLOW_CALL || kind == DISA_FLOW_JCC || kind == DISA_FLOW_INDIRECT_CALL;
+}
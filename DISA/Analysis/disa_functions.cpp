@@ -0,0 +1,198 @@
+#include "disa_functions.hpp"
+#include "disa_flow.hpp"
+#include "disa_pool.hpp"
+
+#include "disa_simd.hpp"
+
+// a thread scans this much at a time
+constexpr std::size_t DISA_FUNCTIONS_CHUNK = 1024 * 1024;
+
+// instructions decoded to confirm a candidate (fewer if a ret/jmp comes first)
+constexpr std::size_t DISA_FUNCTIONS_CONFIRM = 8;
+
+// the candidate check reads up to this many bytes from a position
+constexpr std::size_t DISA_FUNCTIONS_LOOKAHEAD = 5;
+
+static bool is_padding(const std::uint8_t byte)
+{
+	return byte == 0xCC || byte == 0x90;
+}
+
+// Whether a function could start at `offset`, going by the bytes alone
+static bool is_candidate(const std::uint8_t* buffer, const std::size_t size, const std::size_t offset, const std::uintptr_t address)
+{
+	const std::uint8_t* at = buffer + offset;
+	const std::size_t left = size - offset;
+	const std::uint8_t previous = offset ? at[-1] : 0;
+
+	if (left >= 5 && at[0] == 0x8B && at[1] == 0xFF && at[2] == 0x55 && at[3] == 0x8B && at[4] == 0xEC)
+	{
+		return true;
+	}
+
+	if (left >= 3 && at[0] == 0x55 && ((at[1] == 0x8B && at[2] == 0xEC) || (at[1] == 0x89 && at[2] == 0xE5)))
+	{
+		// (the push ebp of a hot-patch prologue, that one starts 2 bytes earlier)
+		return !(offset >= 2 && at[-2] == 0x8B && at[-1] == 0xFF);
+	}
+
+	if (left >= 3 && at[0] == 0x53 && at[1] == 0x56 && at[2] == 0x57)
+	{
+		return is_padding(previous) || previous == 0xC3;
+	}
+
+	return offset && (address + offset) % 16 == 0 && is_padding(previous) && !is_padding(at[0]) && at[0] != 0x00;
+}
+
+// Decodes the start of the would-be function: everything has to decode,
+// and it can't start with more padding
+static bool confirm(const disa_decoder& decoder, const std::uint8_t* buffer, const std::size_t size, const std::size_t offset, const std::uintptr_t address)
+{
+	disa_record record;
+	std::size_t at = offset;
+
+	for (std::size_t i = 0; i < DISA_FUNCTIONS_CONFIRM; i++)
+	{
+		if (at >= size)
+		{
+			return false;
+		}
+
+		decoder.decode(buffer + at, size - at, address + at, record);
+
+		const auto kind = disa_flow(record);
+
+		if (kind == DISA_FLOW_END || (i == 0 && (record.mnemonic() == MN_NOP || record.mnemonic() == MN_INT_3)))
+		{
+			return false;
+		}
+
+		if (!disa_flow_falls_through(kind))
+		{
+			break;
+		}
+
+		at += record.len;
+	}
+
+	return true;
+}
+
+static void check(const disa_decoder& decoder, const std::uint8_t* buffer, const std::size_t size, const std::size_t offset, const std::uintptr_t address, std::vector<std::uintptr_t>& result)
+{
+	if (is_candidate(buffer, size, offset, address) && confirm(decoder, buffer, size, offset, address))
+	{
+		result.push_back(address + offset);
+	}
+}
+
+// Scans [begin, end) of the buffer, appending the confirmed starts in order
+static void scan(const disa_decoder& decoder, const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address,
+	const std::size_t begin, const std::size_t end, std::vector<std::uintptr_t>& result)
+{
+	std::size_t offset = begin;
+
+#ifdef DISA_SIMD
+	// the vector pass only narrows things down: every bit it sets
+	// still goes through is_candidate, so it may be a bit generous
+	// (it ignores the hot-patch overlap and the byte before 53 56 57)
+	if (offset == 0 && offset < end)
+	{
+		check(decoder, buffer, size, 0, address, result);
+		offset = 1;
+	}
+
+	// offset moves in steps of DISA_VECTOR_SIZE, so the 16-byte aligned
+	// positions are the same bits in every block
+	std::uint32_t aligned = 0;
+
+	for (std::size_t i = 0; i < DISA_VECTOR_SIZE; i++)
+	{
+		if ((address + offset + i) % 16 == 0)
+		{
+			aligned |= std::uint32_t(1) << i;
+		}
+	}
+
+	const disa_vector x00 = disa_vset(0x00), x53 = disa_vset(0x53), x55 = disa_vset(0x55), x56 = disa_vset(0x56), x57 = disa_vset(0x57), x89 = disa_vset(0x89);
+	const disa_vector x8B = disa_vset(0x8B), x90 = disa_vset(0x90), xCC = disa_vset(0xCC), xE5 = disa_vset(0xE5), xEC = disa_vset(0xEC), xFF = disa_vset(0xFF);
+
+	while (offset + DISA_VECTOR_SIZE <= end && offset + DISA_VECTOR_SIZE + DISA_FUNCTIONS_LOOKAHEAD <= size)
+	{
+		const std::uint8_t* at = buffer + offset;
+		const disa_vector previous = disa_vload(at - 1);
+		const disa_vector b0 = disa_vload(at), b1 = disa_vload(at + 1), b2 = disa_vload(at + 2);
+
+		const disa_vector push_ebp = disa_vand(disa_veq(b0, x55), disa_vor(disa_vand(disa_veq(b1, x8B), disa_veq(b2, xEC)), disa_vand(disa_veq(b1, x89), disa_veq(b2, xE5))));
+		const disa_vector hot_patch = disa_vand(disa_vand(disa_veq(b0, x8B), disa_veq(b1, xFF)), disa_veq(b2, x55));
+		const disa_vector push_regs = disa_vand(disa_vand(disa_veq(b0, x53), disa_veq(b1, x56)), disa_veq(b2, x57));
+		const disa_vector padded = disa_vandnot(disa_vor(disa_vor(disa_veq(b0, xCC), disa_veq(b0, x90)), disa_veq(b0, x00)), disa_vor(disa_veq(previous, xCC), disa_veq(previous, x90)));
+
+		std::uint32_t mask = disa_vmask(disa_vor(disa_vor(push_ebp, hot_patch), push_regs)) | (disa_vmask(padded) & aligned);
+
+		while (mask)
+		{
+			check(decoder, buffer, size, offset + disa_lowest_bit(mask), address, result);
+			mask &= mask - 1;
+		}
+
+		offset += DISA_VECTOR_SIZE;
+	}
+#endif
+
+	for (; offset < end; offset++)
+	{
+		check(decoder, buffer, size, offset, address, result);
+	}
+}
+
+std::vector<std::uintptr_t> disa_find_functions(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const std::size_t threads, const disa_decoder& decoder)
+{
+	const std::size_t nchunks = (size + DISA_FUNCTIONS_CHUNK - 1) / DISA_FUNCTIONS_CHUNK;
+
+	std::vector<std::vector<std::uintptr_t>> found(nchunks);
+
+	const auto scan_chunk = [&](const std::size_t i)
+	{
+		const std::size_t begin = i * DISA_FUNCTIONS_CHUNK;
+		const std::size_t end = begin + DISA_FUNCTIONS_CHUNK < size ? begin + DISA_FUNCTIONS_CHUNK : size;
+
+		scan(decoder, buffer, size, address, begin, end, found[i]);
+	};
+
+	if (nchunks <= 1)
+	{
+		for (std::size_t i = 0; i < nchunks; i++)
+		{
+			scan_chunk(i);
+		}
+	}
+	else
+	{
+		disa_pool pool(threads);
+		pool.run(nchunks, scan_chunk);
+	}
+
+	// chunks are in order and each one is sorted
+	std::vector<std::uintptr_t> result;
+	std::size_t total = 0;
+
+	for (const auto& list : found)
+	{
+		total += list.size();
+	}
+
+	result.reserve(total);
+
+	for (const auto& list : found)
+	{
+		result.insert(result.end(), list.begin(), list.end());
+	}
+
+	return result;
+}
+
+std::vector<std::uintptr_t> disa_find_functions(const std::uintptr_t from, const std::uintptr_t to, const std::size_t threads, const disa_decoder& decoder)
+{
+	return disa_find_functions(reinterpret_cast<const std::uint8_t*>(from), (to > from) ? to - from : 0, from, threads, decoder);
+}
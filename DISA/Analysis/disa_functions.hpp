@@ -0,0 +1,18 @@
+#pragma once
+#include "../disa.hpp"
+
+// Function-start discovery for code without symbols.
+// Candidates are found with SSE2/AVX2 compares, 16/32 bytes at a time:
+//  - the usual prologues: 55 8B EC / 55 89 E5 (push ebp; mov ebp,esp),
+//    8B FF 55 8B EC (hot-patchable mov edi,edi; push ebp; mov ebp,esp),
+//    and 53 56 57 (push ebx; push esi; push edi) right after padding or a ret
+//  - the 16-byte aligned byte after a run of CC/90 padding
+// and every candidate is then confirmed by decoding the first few
+// instructions with DISA. `threads` = 0 uses one thread per hardware thread.
+// The result is sorted.
+
+// memory of the current process
+std::vector<std::uintptr_t> disa_find_functions(const std::uintptr_t from, const std::uintptr_t to, const std::size_t threads = 0, const disa_decoder& decoder = disa_decoder());
+
+// a buffer that's located at `address` in the target
+std::vector<std::uintptr_t> disa_find_functions(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const std::size_t threads = 0, const disa_decoder& decoder = disa_decoder());
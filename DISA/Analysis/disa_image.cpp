@@ -0,0 +1,266 @@
+#include "disa_image.hpp"
+#include <cstring>
+
+// Little-endian fields, at any alignment
+static std::uint16_t get_u16(const std::uint8_t* at)
+{
+	return static_cast<std::uint16_t>(at[0] | (at[1] << 8));
+}
+
+static std::uint32_t get_u32(const std::uint8_t* at)
+{
+	return static_cast<std::uint32_t>(at[0] | (at[1] << 8) | (at[2] << 16) | (static_cast<std::uint32_t>(at[3]) << 24));
+}
+
+disa_image::disa_image()
+	: view(nullptr)
+	, view_size(0)
+	, format(DISA_IMAGE_NONE)
+	, base(0)
+	, entry(0)
+{
+}
+
+disa_image::~disa_image()
+{
+	close();
+}
+
+bool disa_image::open(const std::string& path)
+{
+	close();
+
+	if (!file.open(path))
+	{
+		return false;
+	}
+
+	view = file.data();
+	view_size = file.size();
+
+	if (!(parse_pe32() || parse_elf32()))
+	{
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+void disa_image::close()
+{
+	file.close();
+
+	view = nullptr;
+	view_size = 0;
+	format = DISA_IMAGE_NONE;
+	base = 0;
+	entry = 0;
+	sections.clear();
+}
+
+bool disa_image::parse_pe32()
+{
+	if (view_size < 0x40 || view[0] != 'M' || view[1] != 'Z')
+	{
+		return false;
+	}
+
+	const std::size_t pe = get_u32(view + 0x3C);
+
+	// signature + COFF header + the optional header up to the image base
+	if (pe > view_size || view_size - pe < 24 + 32 || std::memcmp(view + pe, "PE\0\0", 4))
+	{
+		return false;
+	}
+
+	const std::uint8_t* const coff = view + pe + 4;
+	const std::size_t nsections = get_u16(coff + 2);
+	const std::size_t optional_size = get_u16(coff + 16);
+	const std::uint8_t* const optional = coff + 20;
+
+	if (get_u16(optional) != 0x10B) // PE32 (not PE32+)
+	{
+		return false;
+	}
+
+	entry = get_u32(optional + 16);
+	base = get_u32(optional + 28);
+	entry += base;
+
+	const std::size_t table = (optional - view) + optional_size;
+
+	if (table > view_size || (view_size - table) / 40 < nsections)
+	{
+		return false;
+	}
+
+	for (std::size_t i = 0; i < nsections; i++)
+	{
+		const std::uint8_t* const header = view + table + i * 40;
+		const std::uint32_t virtual_size = get_u32(header + 8);
+		const std::uint32_t raw_size = get_u32(header + 16);
+		const std::uint32_t characteristics = get_u32(header + 36);
+
+		disa_section section;
+		section.name.assign(reinterpret_cast<const char*>(header), strnlen(reinterpret_cast<const char*>(header), 8));
+		section.address = base + get_u32(header + 12);
+		section.size = virtual_size ? virtual_size : raw_size;
+		section.file_offset = get_u32(header + 20);
+		section.executable = (characteristics & 0x20000020) != 0; // IMAGE_SCN_MEM_EXECUTE, IMAGE_SCN_CNT_CODE
+
+		// (the raw data is padded to the file alignment, past the virtual size)
+		section.file_size = raw_size < section.size ? raw_size : section.size;
+
+		if (section.file_offset > view_size)
+		{
+			section.file_size = 0;
+		}
+		else if (section.file_size > view_size - section.file_offset)
+		{
+			section.file_size = view_size - section.file_offset;
+		}
+
+		section.data = view + (section.file_size ? section.file_offset : 0);
+		sections.push_back(section);
+	}
+
+	format = DISA_IMAGE_PE32;
+	return true;
+}
+
+bool disa_image::parse_elf32()
+{
+	// ELFCLASS32, ELFDATA2LSB
+	if (view_size < 52 || std::memcmp(view, "\x7F" "ELF", 4) || view[4] != 1 || view[5] != 1)
+	{
+		return false;
+	}
+
+	entry = get_u32(view + 0x18);
+
+	const std::size_t phoff = get_u32(view + 0x1C);
+	const std::size_t shoff = get_u32(view + 0x20);
+	const std::size_t phentsize = get_u16(view + 0x2A);
+	const std::size_t phnum = get_u16(view + 0x2C);
+	const std::size_t shentsize = get_u16(view + 0x2E);
+	const std::size_t shnum = get_u16(view + 0x30);
+	const std::size_t shstrndx = get_u16(view + 0x32);
+
+	const auto add = [this](const std::string& name, const std::uint32_t address, const std::uint32_t size, const std::uint32_t offset, const std::uint32_t file_size, const bool executable)
+	{
+		disa_section section;
+		section.name = name;
+		section.address = address;
+		section.size = size;
+		section.file_offset = offset;
+		section.file_size = offset > view_size ? 0 : (file_size > view_size - offset ? view_size - offset : file_size);
+		section.executable = executable;
+		section.data = view + (section.file_size ? offset : 0);
+		sections.push_back(section);
+	};
+
+	if (shnum && shentsize >= 40 && shoff <= view_size && (view_size - shoff) / shentsize >= shnum)
+	{
+		const std::uint8_t* const strings_header = shstrndx < shnum ? view + shoff + shstrndx * shentsize : nullptr;
+		const std::size_t strings = strings_header ? get_u32(strings_header + 16) : 0;
+		const std::size_t strings_size = strings_header ? get_u32(strings_header + 20) : 0;
+
+		for (std::size_t i = 0; i < shnum; i++)
+		{
+			const std::uint8_t* const header = view + shoff + i * shentsize;
+			const std::uint32_t type = get_u32(header + 4);
+			const std::uint32_t flags = get_u32(header + 8);
+
+			if (!(flags & 0x2)) // SHF_ALLOC: not loaded
+			{
+				continue;
+			}
+
+			std::string name;
+			const std::size_t name_at = strings + get_u32(header);
+
+			if (get_u32(header) < strings_size && name_at < view_size)
+			{
+				name.assign(reinterpret_cast<const char*>(view + name_at), strnlen(reinterpret_cast<const char*>(view + name_at), view_size - name_at));
+			}
+
+			const std::uint32_t size = get_u32(header + 20);
+			add(name, get_u32(header + 12), size, get_u32(header + 16), type == 8 ? 0 : size, (flags & 0x4) != 0); // SHT_NOBITS, SHF_EXECINSTR
+		}
+	}
+	else if (phnum && phentsize >= 32 && phoff <= view_size && (view_size - phoff) / phentsize >= phnum)
+	{
+		// no section headers (stripped): the loadable segments
+		for (std::size_t i = 0; i < phnum; i++)
+		{
+			const std::uint8_t* const header = view + phoff + i * phentsize;
+
+			if (get_u32(header) == 1) // PT_LOAD
+			{
+				add("LOAD", get_u32(header + 8), get_u32(header + 20), get_u32(header + 4), get_u32(header + 16), (get_u32(header + 24) & 0x1) != 0); // PF_X
+			}
+		}
+	}
+	else
+	{
+		return false;
+	}
+
+	base = 0;
+
+	for (std::size_t i = 0; i < sections.size(); i++)
+	{
+		if (i == 0 || sections[i].address < base)
+		{
+			base = sections[i].address;
+		}
+	}
+
+	format = DISA_IMAGE_ELF32;
+	return true;
+}
+
+std::vector<disa_section> disa_image::get_code_sections() const
+{
+	std::vector<disa_section> code;
+
+	for (const auto& section : sections)
+	{
+		if (section.executable)
+		{
+			code.push_back(section);
+		}
+	}
+
+	return code;
+}
+
+bool disa_image::file_offset(const std::uintptr_t address, std::size_t& offset) const
+{
+	for (const auto& section : sections)
+	{
+		if (address >= section.address && address - section.address < section.file_size)
+		{
+			offset = section.file_offset + (address - section.address);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+const std::uint8_t* disa_image::at(const std::uintptr_t address, std::size_t& available) const
+{
+	for (const auto& section : sections)
+	{
+		if (address >= section.address && address - section.address < section.file_size)
+		{
+			available = section.file_size - (address - section.address);
+			return section.data + (address - section.address);
+		}
+	}
+
+	available = 0;
+	return nullptr;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "../disa.hpp"
+#include "disa_mapping.hpp"
+
+enum disa_image_format : std::uint8_t
+{
+	DISA_IMAGE_NONE,
+	DISA_IMAGE_PE32,
+	DISA_IMAGE_ELF32,
+};
+
+struct disa_section
+{
+	std::string name;
+	std::uintptr_t address; // where it's loaded
+	std::size_t size; // size in memory
+	std::size_t file_offset;
+	std::size_t file_size; // bytes in the file (the rest of `size` is zeroes)
+	bool executable;
+	const std::uint8_t* data; // the file's bytes (file_size of them), in the mapping
+};
+
+// An executable image on disk (PE32 or ELF32), mapped read-only.
+// Nothing is copied: sections point into the mapping, so they can be
+// handed to the decoder with their load addresses, e.g.
+//   for (const auto& rec : disa_stream(section.data, section.file_size, section.address))
+// Memory only gets paged in for the parts that are read.
+class disa_image
+{
+private:
+	disa_mapping file;
+	const std::uint8_t* view;
+	std::size_t view_size;
+	disa_image_format format;
+	std::uintptr_t base;
+	std::uintptr_t entry;
+	std::vector<disa_section> sections;
+
+	bool parse_pe32();
+	bool parse_elf32();
+public:
+	disa_image();
+	~disa_image();
+
+	disa_image(const disa_image&) = delete;
+	disa_image& operator=(const disa_image&) = delete;
+
+	// false if the file can't be mapped, or isn't a PE32/ELF32 image
+	bool open(const std::string& path);
+	void close();
+
+	bool is_open() const { return view != nullptr; }
+	disa_image_format get_format() const { return format; }
+	std::uintptr_t get_base() const { return base; } // image base (PE), lowest section address (ELF)
+	std::uintptr_t get_entry() const { return entry; }
+
+	const std::vector<disa_section>& get_sections() const { return sections; }
+	std::vector<disa_section> get_code_sections() const;
+
+	// The file offset that's loaded at `address`; false if it isn't in the file
+	bool file_offset(const std::uintptr_t address, std::size_t& offset) const;
+
+	// The bytes loaded at `address`, and how many of them there are up to the end of
+	// the section's file data; nullptr if it isn't in the file
+	const std::uint8_t* at(const std::uintptr_t address, std::size_t& available) const;
+};
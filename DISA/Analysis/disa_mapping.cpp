@@ -0,0 +1,114 @@
+#include "disa_mapping.hpp"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+disa_mapping::disa_mapping()
+	: view(nullptr)
+	, view_size(0)
+#ifdef _WIN32
+	, file(INVALID_HANDLE_VALUE)
+	, mapping(nullptr)
+#else
+	, file(-1)
+#endif
+{
+}
+
+disa_mapping::~disa_mapping()
+{
+	close();
+}
+
+bool disa_mapping::open(const std::string& path)
+{
+	close();
+
+#ifdef _WIN32
+	file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER size;
+
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+	{
+		close();
+		return false;
+	}
+
+	mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (!mapping)
+	{
+		close();
+		return false;
+	}
+
+	view = static_cast<const std::uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+	view_size = static_cast<std::size_t>(size.QuadPart);
+#else
+	file = ::open(path.c_str(), O_RDONLY);
+
+	if (file < 0)
+	{
+		return false;
+	}
+
+	struct stat info;
+
+	if (fstat(file, &info) != 0 || info.st_size == 0)
+	{
+		close();
+		return false;
+	}
+
+	void* const mapped = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+	if (mapped == MAP_FAILED)
+	{
+		close();
+		return false;
+	}
+
+	view = static_cast<const std::uint8_t*>(mapped);
+	view_size = static_cast<std::size_t>(info.st_size);
+#endif
+
+	if (!view)
+	{
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+void disa_mapping::close()
+{
+#ifdef _WIN32
+	if (view) UnmapViewOfFile(view);
+	if (mapping) CloseHandle(mapping);
+	if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+
+	mapping = nullptr;
+	file = INVALID_HANDLE_VALUE;
+#else
+	if (view) munmap(const_cast<std::uint8_t*>(view), view_size);
+	if (file >= 0) ::close(file);
+
+	file = -1;
+#endif
+
+	view = nullptr;
+	view_size = 0;
+}
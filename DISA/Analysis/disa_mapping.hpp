@@ -0,0 +1,32 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// A whole file mapped read-only into memory (mmap, MapViewOfFile)
+class disa_mapping
+{
+private:
+	const std::uint8_t* view;
+	std::size_t view_size;
+
+#ifdef _WIN32
+	void* file;
+	void* mapping;
+#else
+	int file;
+#endif
+public:
+	disa_mapping();
+	~disa_mapping();
+
+	disa_mapping(const disa_mapping&) = delete;
+	disa_mapping& operator=(const disa_mapping&) = delete;
+
+	// false if the file can't be opened or is empty
+	bool open(const std::string& path);
+	void close();
+
+	const std::uint8_t* data() const { return view; }
+	std::size_t size() const { return view_size; }
+};
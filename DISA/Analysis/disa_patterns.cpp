@@ -0,0 +1,611 @@
+#include "disa_patterns.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <map>
+
+// distinct instruction texts remembered while matching, before starting over
+constexpr std::size_t DISA_PATTERNS_TEXT_CACHE = 1 << 16;
+
+static std::string trim(const std::string& text)
+{
+	const std::size_t first = text.find_first_not_of(' ');
+
+	if (first == std::string::npos)
+	{
+		return std::string();
+	}
+
+	return text.substr(first, text.find_last_not_of(' ') - first + 1);
+}
+
+static bool is_hex(const char c)
+{
+	return std::isxdigit(static_cast<unsigned char>(c)) != 0;
+}
+
+static bool is_reg_char(const char c)
+{
+	return std::isalnum(static_cast<unsigned char>(c)) || c == '(' || c == ')';
+}
+
+// Matches operand text against an operand pattern (?reg, ?imm, ?, or characters, ignoring case)
+static bool glob(const char* pattern, const char* text)
+{
+	if (!*pattern)
+	{
+		return !*text;
+	}
+
+	if (!std::strncmp(pattern, "?reg", 4))
+	{
+		if (!std::isalpha(static_cast<unsigned char>(*text)))
+		{
+			return false;
+		}
+
+		for (const char* end = text + 1;; end++)
+		{
+			if (glob(pattern + 4, end))
+			{
+				return true;
+			}
+
+			if (!is_reg_char(*end))
+			{
+				return false;
+			}
+		}
+	}
+
+	if (!std::strncmp(pattern, "?imm", 4))
+	{
+		for (const char* end = text; is_hex(*end);)
+		{
+			if (glob(pattern + 4, ++end))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	if (*pattern == '?')
+	{
+		for (const char* end = text;; end++)
+		{
+			if (glob(pattern + 1, end))
+			{
+				return true;
+			}
+
+			if (!*end)
+			{
+				return false;
+			}
+		}
+	}
+
+	return *text && std::tolower(static_cast<unsigned char>(*pattern)) == std::tolower(static_cast<unsigned char>(*text)) && glob(pattern + 1, text + 1);
+}
+
+// Splits "a,b,c" into its operands, without spaces
+static std::vector<std::string> split_operands(const char* text)
+{
+	std::vector<std::string> operands;
+	std::string current;
+
+	for (; *text; text++)
+	{
+		if (*text == ',')
+		{
+			operands.push_back(current);
+			current.clear();
+		}
+		else if (*text != ' ')
+		{
+			current += *text;
+		}
+	}
+
+	if (!current.empty() || !operands.empty())
+	{
+		operands.push_back(current);
+	}
+
+	return operands;
+}
+
+disa_patterns::disa_patterns()
+	: by_mnemonic(MN_COUNT)
+	, nodes(1)
+	, npatterns(0)
+{
+	nodes[0].depth = 0;
+}
+
+bool disa_patterns::parse_element(std::string text, element& result) const
+{
+	text = trim(text);
+
+	result = element();
+	result.mnemonic = MN_NONE;
+	result.any = (text == "?");
+
+	if (result.any)
+	{
+		return true;
+	}
+
+	std::transform(text.begin(), text.end(), text.begin(), [](const char c) { return char(std::tolower(static_cast<unsigned char>(c))); });
+
+	// the longest mnemonic the text starts with (so "je short" wins over "je")
+	std::size_t longest = 0;
+
+	for (std::size_t i = 1; i < MN_COUNT; i++)
+	{
+		const std::size_t n = std::strlen(disa_mnemonic_names[i]);
+
+		if (n > longest && !text.compare(0, n, disa_mnemonic_names[i]) && (text.size() == n || text[n] == ' '))
+		{
+			result.mnemonic = static_cast<disa_mnemonic>(i);
+			longest = n;
+		}
+	}
+
+	if (result.mnemonic == MN_NONE)
+	{
+		return false;
+	}
+
+	result.operands = split_operands(text.c_str() + longest);
+
+	for (auto& operand : result.operands)
+	{
+		if (operand.empty())
+		{
+			return false;
+		}
+
+		if (operand == "imm")
+		{
+			operand = "?imm";
+		}
+	}
+
+	return true;
+}
+
+// An element is found through the longest part of an operand without wildcards
+// (the longer, the fewer elements share it):
+// "=" position text for a whole operand, "<" position text for the start of one,
+// ">" position text for the end of one. "" if it has no operands (and also if
+// every operand is a lone wildcard, but then it's not indexed)
+std::string disa_patterns::index_key(const element& e)
+{
+	std::string best;
+	std::size_t best_length = 0;
+
+	for (std::size_t i = 0; i < e.operands.size(); i++)
+	{
+		const auto& operand = e.operands[i];
+		const char position = char('0' + i);
+		const std::size_t first = operand.find('?');
+
+		if (first == std::string::npos)
+		{
+			if (operand.size() >= best_length)
+			{
+				best = std::string(1, '=') + position + operand;
+				best_length = operand.size();
+			}
+
+			continue;
+		}
+
+		std::size_t end = first; // after the last ?, ?imm or ?reg
+
+		for (std::size_t at = first; at < operand.size(); at++)
+		{
+			if (operand[at] == '?')
+			{
+				end = at + (!operand.compare(at, 4, "?reg") || !operand.compare(at, 4, "?imm") ? 4 : 1);
+				at = end - 1;
+			}
+		}
+
+		const std::size_t suffix = operand.size() - end;
+
+		if (first > best_length)
+		{
+			best = std::string(1, '<') + position + operand.substr(0, first);
+			best_length = first;
+		}
+
+		if (suffix > best_length)
+		{
+			best = std::string(1, '>') + position + operand.substr(end);
+			best_length = suffix;
+		}
+	}
+
+	return best;
+}
+
+std::uint32_t disa_patterns::intern(const element& e)
+{
+	for (std::uint32_t i = 0; i < elements.size(); i++)
+	{
+		if (elements[i].any == e.any && elements[i].mnemonic == e.mnemonic && elements[i].operands == e.operands)
+		{
+			return i;
+		}
+	}
+
+	const std::uint32_t id = std::uint32_t(elements.size());
+	elements.push_back(e);
+
+	if (e.any)
+	{
+		any_elements.push_back(id);
+	}
+	else
+	{
+		auto& index = by_mnemonic[e.mnemonic];
+
+		const auto key = index_key(e);
+
+		if (key.empty() && !e.operands.empty())
+		{
+			index.wildcards.push_back(id);
+		}
+		else
+		{
+			index.by_key[key].push_back(id);
+		}
+	}
+
+	return id;
+}
+
+std::size_t disa_patterns::add(const std::string& pattern)
+{
+	std::vector<element> parsed;
+	std::size_t begin = 0;
+
+	while (begin <= pattern.size())
+	{
+		std::size_t end = pattern.find(';', begin);
+
+		if (end == std::string::npos)
+		{
+			end = pattern.size();
+		}
+
+		element e;
+
+		if (!parse_element(pattern.substr(begin, end - begin), e))
+		{
+			return INVALID;
+		}
+
+		parsed.push_back(e);
+		begin = end + 1;
+	}
+
+	std::uint32_t at = 0;
+
+	for (const auto& e : parsed)
+	{
+		const std::uint32_t id = intern(e);
+		std::uint32_t next = 0;
+
+		for (const auto& child : nodes[at].children)
+		{
+			if (child.first == id)
+			{
+				next = child.second;
+			}
+		}
+
+		if (!next)
+		{
+			next = std::uint32_t(nodes.size());
+			nodes[at].children.push_back({ id, next });
+
+			node n;
+			n.depth = nodes[at].depth + 1;
+			nodes.push_back(n);
+		}
+
+		at = next;
+	}
+
+	nodes[at].outputs.push_back(npatterns);
+	return npatterns++;
+}
+
+// The automaton over the instruction stream, built lazily while matching:
+// a state is the set of trie nodes the patterns could be in, a symbol is
+// the set of elements an instruction matches
+struct disa_pattern_automaton
+{
+	const disa_patterns& patterns;
+
+	std::map<std::vector<std::uint32_t>, std::uint32_t> state_ids;
+	std::vector<std::vector<std::uint32_t>> states; // trie nodes, sorted
+	std::vector<std::vector<std::pair<std::size_t, std::uint32_t>>> state_outputs; // pattern, depth
+
+	std::map<std::vector<std::uint32_t>, std::uint32_t> symbol_ids;
+	std::vector<std::vector<std::uint32_t>> symbols; // elements, sorted
+
+	std::unordered_map<std::uint64_t, std::uint32_t> transitions; // state << 32 | symbol
+
+	std::unordered_map<std::string, std::uint32_t> text_symbols; // instruction text (mnemonic|operands) -> symbol
+	std::string key;
+
+	std::vector<std::uint32_t> scratch;
+	char text[DISA_TEXT_SIZE];
+
+	explicit disa_pattern_automaton(const disa_patterns& patterns)
+		: patterns(patterns)
+	{
+		state_id({ 0 });
+		symbol_id({});
+	}
+
+	std::uint32_t state_id(const std::vector<std::uint32_t>& nodes)
+	{
+		const auto it = state_ids.find(nodes);
+
+		if (it != state_ids.end())
+		{
+			return it->second;
+		}
+
+		const std::uint32_t id = std::uint32_t(states.size());
+		state_ids.emplace(nodes, id);
+		states.push_back(nodes);
+
+		std::vector<std::pair<std::size_t, std::uint32_t>> outputs;
+
+		for (const auto n : nodes)
+		{
+			for (const auto pattern : patterns.nodes[n].outputs)
+			{
+				outputs.push_back({ pattern, patterns.nodes[n].depth });
+			}
+		}
+
+		std::sort(outputs.begin(), outputs.end());
+		state_outputs.push_back(outputs);
+		return id;
+	}
+
+	std::uint32_t symbol_id(const std::vector<std::uint32_t>& elements)
+	{
+		const auto it = symbol_ids.find(elements);
+
+		if (it != symbol_ids.end())
+		{
+			return it->second;
+		}
+
+		const std::uint32_t id = std::uint32_t(symbols.size());
+		symbol_ids.emplace(elements, id);
+		symbols.push_back(elements);
+		return id;
+	}
+
+	bool matches(const std::uint32_t id, const std::vector<std::string>& operands) const
+	{
+		const auto& e = patterns.elements[id];
+
+		if (e.operands.size() != operands.size())
+		{
+			return false;
+		}
+
+		for (std::size_t i = 0; i < operands.size(); i++)
+		{
+			if (!glob(e.operands[i].c_str(), operands[i].c_str()))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// The elements `record` matches
+	std::uint32_t classify(const disa_record& record)
+	{
+		const auto mnemonic = record.mnemonic();
+		const auto& index = patterns.by_mnemonic[mnemonic];
+
+		if (index.empty())
+		{
+			return patterns.any_elements.empty() ? 0 : symbol_id(patterns.any_elements);
+		}
+
+		disa_format(record, text, sizeof(text));
+
+		// skip the lock/rep prefixes and the mnemonic
+		const char* at = text;
+		const char* const name = disa_mnemonic_name(mnemonic);
+
+		while (std::strncmp(at, name, std::strlen(name)) && std::strchr(at, ' '))
+		{
+			at = std::strchr(at, ' ') + 1;
+		}
+
+		key.assign(name);
+		key += '|';
+		key.append(at + std::strlen(name));
+
+		const auto cached = text_symbols.find(key);
+
+		if (cached != text_symbols.end())
+		{
+			return cached->second;
+		}
+
+		auto operands = split_operands(at + std::strlen(name));
+
+		for (auto& operand : operands)
+		{
+			std::transform(operand.begin(), operand.end(), operand.begin(), [](const char c) { return char(std::tolower(static_cast<unsigned char>(c))); });
+		}
+
+		scratch = patterns.any_elements;
+
+		// every key the instruction's operands can be found under
+		// (an element is only under one key, so nothing is added twice)
+		const auto add_key = [&](const std::string& key)
+		{
+			const auto found = index.by_key.find(key);
+
+			if (found != index.by_key.end())
+			{
+				for (const auto id : found->second)
+				{
+					if (matches(id, operands))
+					{
+						scratch.push_back(id);
+					}
+				}
+			}
+		};
+
+		if (operands.empty())
+		{
+			add_key(std::string());
+		}
+
+		for (std::size_t i = 0; i < operands.size(); i++)
+		{
+			const auto& operand = operands[i];
+			const char position = char('0' + i);
+
+			add_key(std::string(1, '=') + position + operand);
+
+			for (std::size_t n = 1; n <= operand.size(); n++)
+			{
+				add_key(std::string(1, '<') + position + operand.substr(0, n));
+				add_key(std::string(1, '>') + position + operand.substr(operand.size() - n));
+			}
+		}
+
+		for (const auto id : index.wildcards)
+		{
+			if (matches(id, operands))
+			{
+				scratch.push_back(id);
+			}
+		}
+
+		std::sort(scratch.begin(), scratch.end());
+
+		const std::uint32_t symbol = symbol_id(scratch);
+
+		if (text_symbols.size() >= DISA_PATTERNS_TEXT_CACHE)
+		{
+			text_symbols.clear();
+		}
+
+		text_symbols.emplace(key, symbol);
+		return symbol;
+	}
+
+	std::uint32_t next(const std::uint32_t state, const std::uint32_t symbol)
+	{
+		const std::uint64_t key = (std::uint64_t(state) << 32) | symbol;
+		const auto it = transitions.find(key);
+
+		if (it != transitions.end())
+		{
+			return it->second;
+		}
+
+		// the root is always in the set: a pattern can start at any instruction
+		std::vector<std::uint32_t> nodes(1, 0);
+
+		for (const auto n : states[state])
+		{
+			for (const auto& child : patterns.nodes[n].children)
+			{
+				if (std::binary_search(symbols[symbol].begin(), symbols[symbol].end(), child.first))
+				{
+					nodes.push_back(child.second);
+				}
+			}
+		}
+
+		std::sort(nodes.begin(), nodes.end());
+		nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+
+		const std::uint32_t id = state_id(nodes);
+		transitions.emplace(key, id);
+		return id;
+	}
+};
+
+std::vector<disa_pattern_match> disa_patterns::match(const std::vector<disa_record>& records) const
+{
+	disa_pattern_automaton automaton(*this);
+	std::vector<disa_pattern_match> matches;
+	std::uint32_t state = 0;
+
+	for (std::size_t i = 0; i < records.size(); i++)
+	{
+		if (i && records[i].address != records[i - 1].address + records[i - 1].len)
+		{
+			state = 0;
+		}
+
+		state = automaton.next(state, automaton.classify(records[i]));
+
+		for (const auto& output : automaton.state_outputs[state])
+		{
+			const std::size_t first = i + 1 - output.second;
+			matches.push_back({ output.first, first, records[first].address });
+		}
+	}
+
+	return matches;
+}
+
+std::vector<disa_pattern_match> disa_patterns::match(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const disa_decoder& decoder) const
+{
+	disa_pattern_automaton automaton(*this);
+	std::vector<disa_pattern_match> matches;
+	std::uint32_t state = 0;
+
+	// the addresses of the last few instructions, as far back as the longest pattern
+	std::uint32_t longest = 1;
+
+	for (const auto& n : nodes)
+	{
+		longest = std::max(longest, n.depth);
+	}
+
+	std::vector<std::uintptr_t> recent(longest);
+	std::size_t i = 0;
+
+	for (const auto& record : decoder.stream(buffer, size, address))
+	{
+		recent[i % longest] = record.address;
+		state = automaton.next(state, automaton.classify(record));
+
+		for (const auto& output : automaton.state_outputs[state])
+		{
+			const std::size_t first = i + 1 - output.second;
+			matches.push_back({ output.first, first, recent[first % longest] });
+		}
+
+		i++;
+	}
+
+	return matches;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "../disa.hpp"
+#include <unordered_map>
+
+struct disa_pattern_match
+{
+	std::size_t pattern; // as returned by disa_patterns::add
+	std::size_t first; // index of its first instruction in the matched records
+	std::uintptr_t address; // address of its first instruction
+};
+
+// Instruction-level patterns, e.g.
+// "push ebp; mov ebp,esp; sub esp,?imm; mov ?reg,[ebp+08]".
+// Instructions are written the way disa_format prints them (DISA syntax),
+// separated by ';'. In operands:
+//  ?reg    any register name
+//  ?imm    any number (an immediate, a displacement, a branch target); a lone `imm` too
+//  ?       anything (a whole operand, or part of one, as in [ebp+?])
+// and an instruction that's only `?` matches any instruction.
+//
+// All patterns go into one trie, and the instruction stream is run
+// through it as an automaton: every instruction is turned into the set
+// of pattern instructions it matches, and (state, set) -> state
+// transitions are built the first time they're needed and then reused.
+// The set is worked out once per distinct instruction text, looking only
+// at pattern instructions with the same mnemonic whose longest wildcard-free
+// piece of an operand (the whole operand, or its start or end) agrees with
+// the same operand of the instruction, plus the ones with nothing but
+// wildcards to go by (see index_key). Once the common instructions have
+// been seen, the cost per instruction no longer depends on how many
+// patterns there are.
+class disa_patterns
+{
+private:
+	struct element
+	{
+		disa_mnemonic mnemonic;
+		bool any; // `?`: any instruction
+		std::vector<std::string> operands;
+	};
+
+	struct node
+	{
+		std::vector<std::pair<std::uint32_t, std::uint32_t>> children; // element, node
+		std::vector<std::size_t> outputs; // patterns that end here
+		std::uint32_t depth;
+	};
+
+	std::vector<element> elements;
+	struct mnemonic_elements
+	{
+		// by a part of one operand that has no wildcards (see index_key)
+		std::unordered_map<std::string, std::vector<std::uint32_t>> by_key;
+		std::vector<std::uint32_t> wildcards; // nothing to go by (e.g. "?reg,?imm")
+
+		bool empty() const { return by_key.empty() && wildcards.empty(); }
+	};
+
+	std::vector<mnemonic_elements> by_mnemonic; // [mnemonic]: its elements
+	std::vector<std::uint32_t> any_elements;
+	std::vector<node> nodes; // nodes[0] is the root
+	std::size_t npatterns;
+
+	bool parse_element(std::string text, element& result) const;
+	std::uint32_t intern(const element& e);
+	static std::string index_key(const element& e);
+
+	friend struct disa_pattern_automaton;
+public:
+	static constexpr std::size_t INVALID = static_cast<std::size_t>(-1);
+
+	disa_patterns();
+
+	// Returns the pattern's number, or INVALID if it can't be parsed
+	std::size_t add(const std::string& pattern);
+
+	std::size_t size() const { return npatterns; }
+
+	// Every match in a list of records, in the order they end.
+	// A match never spans a gap between records (the next record
+	// not starting where the previous one ends)
+	std::vector<disa_pattern_match> match(const std::vector<disa_record>& records) const;
+
+	// Same, over a linear sweep of a buffer that's located at `address` in the target
+	std::vector<disa_pattern_match> match(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const disa_decoder& decoder = disa_decoder()) const;
+};
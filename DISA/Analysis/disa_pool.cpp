@@ -0,0 +1,155 @@
+#include "disa_pool.hpp"
+
+// the queue of the worker running on this thread (if any)
+static thread_local const disa_pool* current_pool = nullptr;
+static thread_local std::size_t current_id = 0;
+
+disa_pool::disa_pool(std::size_t threads) : pending(0), queued(0), next_queue(0), stopping(false)
+{
+	if (threads == 0)
+	{
+		threads = std::thread::hardware_concurrency();
+	}
+
+	if (threads == 0)
+	{
+		threads = 1;
+	}
+
+	for (std::size_t i = 0; i < threads; i++)
+	{
+		queues.push_back(std::unique_ptr<worker_queue>(new worker_queue()));
+	}
+
+	for (std::size_t i = 0; i < threads; i++)
+	{
+		workers.emplace_back(&disa_pool::work, this, i);
+	}
+}
+
+disa_pool::~disa_pool()
+{
+	wait();
+
+	{
+		std::lock_guard<std::mutex> guard(sleep_lock);
+		stopping = true;
+	}
+
+	wake.notify_all();
+
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+}
+
+std::size_t disa_pool::size() const
+{
+	return workers.size();
+}
+
+void disa_pool::submit(std::function<void()> task)
+{
+	const std::size_t id = (current_pool == this) ? current_id : next_queue++ % queues.size();
+
+	pending++;
+
+	{
+		// (counted before it can be taken, so take() never brings queued below 0)
+		std::lock_guard<std::mutex> guard(queues[id]->lock);
+		queued++;
+		queues[id]->tasks.push_back(std::move(task));
+	}
+
+	{
+		// (taken so a worker can't miss the wakeup between its check and its wait)
+		std::lock_guard<std::mutex> guard(sleep_lock);
+	}
+
+	wake.notify_one();
+}
+
+bool disa_pool::take(const std::size_t id, std::function<void()>& task)
+{
+	{
+		// own queue: newest first
+		std::lock_guard<std::mutex> guard(queues[id]->lock);
+
+		if (!queues[id]->tasks.empty())
+		{
+			task = std::move(queues[id]->tasks.back());
+			queues[id]->tasks.pop_back();
+			queued--;
+			return true;
+		}
+	}
+
+	for (std::size_t i = 1; i < queues.size(); i++)
+	{
+		// someone else's: oldest first
+		auto& victim = *queues[(id + i) % queues.size()];
+		std::lock_guard<std::mutex> guard(victim.lock);
+
+		if (!victim.tasks.empty())
+		{
+			task = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			queued--;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void disa_pool::work(const std::size_t id)
+{
+	current_pool = this;
+	current_id = id;
+
+	std::function<void()> task;
+
+	while (true)
+	{
+		if (take(id, task))
+		{
+			task();
+			task = nullptr;
+
+			if (--pending == 0)
+			{
+				std::lock_guard<std::mutex> guard(sleep_lock);
+				idle.notify_all();
+			}
+
+			continue;
+		}
+
+		std::unique_lock<std::mutex> guard(sleep_lock);
+		wake.wait(guard, [this]() { return stopping || queued > 0; });
+
+		if (stopping)
+		{
+			break;
+		}
+	}
+
+	current_pool = nullptr;
+}
+
+void disa_pool::wait()
+{
+	std::unique_lock<std::mutex> guard(sleep_lock);
+	idle.wait(guard, [this]() { return pending == 0; });
+}
+
+void disa_pool::run(const std::size_t count, const std::function<void(std::size_t)>& fn)
+{
+	for (std::size_t i = 0; i < count; i++)
+	{
+		submit([&fn, i]() { fn(i); });
+	}
+
+	wait();
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A work-stealing thread pool.
+// Every worker has its own queue: tasks submitted from a worker go onto
+// that worker's queue (and are taken newest-first), and a worker with
+// nothing left to do steals the oldest task of another worker.
+// Tasks may submit more tasks; wait() returns once all of them are done.
+class disa_pool
+{
+private:
+	struct worker_queue
+	{
+		std::mutex lock;
+		std::deque<std::function<void()>> tasks;
+	};
+
+	std::vector<std::unique_ptr<worker_queue>> queues;
+	std::vector<std::thread> workers;
+
+	std::mutex sleep_lock;
+	std::condition_variable wake; // tasks were submitted, or stopping
+	std::condition_variable idle; // pending dropped to 0
+
+	std::atomic<std::size_t> pending; // submitted but not finished
+	std::atomic<std::size_t> queued; // submitted but not started
+	std::atomic<std::size_t> next_queue; // for tasks submitted from outside the pool
+	bool stopping;
+
+	void work(const std::size_t id);
+	bool take(const std::size_t id, std::function<void()>& task);
+public:
+	explicit disa_pool(std::size_t threads = 0); // 0: one per hardware thread
+	~disa_pool();
+
+	std::size_t size() const;
+
+	void submit(std::function<void()> task);
+	void wait(); // (not from inside a task)
+
+	// Runs fn(0) ... fn(count - 1) on the pool and waits for them
+	void run(const std::size_t count, const std::function<void(std::size_t)>& fn);
+};
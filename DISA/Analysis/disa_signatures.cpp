@@ -0,0 +1,384 @@
+#include "disa_signatures.hpp"
+#include "disa_pool.hpp"
+#include "disa_simd.hpp"
+#include <algorithm>
+
+// a thread scans this much at a time
+constexpr std::size_t DISA_SIGNATURES_CHUNK = 1024 * 1024;
+
+// how far before a hit the boundary check starts decoding
+constexpr std::size_t DISA_SIGNATURES_RESYNC = 64;
+
+// with more distinct anchors than this, the byte-pair bitmap is faster than vector compares
+constexpr std::size_t DISA_SIGNATURES_VECTOR_ANCHORS = 8;
+
+#ifdef DISA_SIMD
+constexpr std::size_t DISA_SIGNATURES_PAD = DISA_VECTOR_SIZE;
+#else
+constexpr std::size_t DISA_SIGNATURES_PAD = 1;
+#endif
+
+// Bytes that are everywhere in x86 code, and make poor anchors
+static bool is_common_byte(const std::uint8_t byte)
+{
+	switch (byte)
+	{
+	case 0x00: case 0x01: case 0x04: case 0x08: case 0x24: case 0x45: case 0x55:
+	case 0x83: case 0x85: case 0x89: case 0x8B: case 0x90: case 0xCC: case 0xE8: case 0xFF:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static int hex_digit(const char c)
+{
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+disa_signatures::disa_signatures(const disa_decoder& decoder)
+	: decoder(decoder)
+	, pairs(65536 / 64, 0)
+	, buckets(256)
+{
+}
+
+std::size_t disa_signatures::add(const std::string& pattern, const bool on_boundary)
+{
+	signature sig;
+
+	for (std::size_t i = 0; i < pattern.size();)
+	{
+		if (pattern[i] == ' ')
+		{
+			i++;
+			continue;
+		}
+
+		std::size_t end = i;
+
+		while (end < pattern.size() && pattern[end] != ' ')
+		{
+			end++;
+		}
+
+		const std::string token = pattern.substr(i, end - i);
+		i = end;
+
+		if (token == "?" || token == "??")
+		{
+			sig.value.push_back(0);
+			sig.mask.push_back(0);
+			continue;
+		}
+
+		if (token.size() != 2)
+		{
+			return INVALID;
+		}
+
+		std::uint8_t value = 0, mask = 0;
+
+		for (std::size_t j = 0; j < 2; j++)
+		{
+			const int shift = j ? 0 : 4;
+
+			if (token[j] != '?')
+			{
+				const int digit = hex_digit(token[j]);
+
+				if (digit < 0)
+				{
+					return INVALID;
+				}
+
+				value |= std::uint8_t(digit << shift);
+				mask |= std::uint8_t(0xF << shift);
+			}
+		}
+
+		sig.value.push_back(value);
+		sig.mask.push_back(mask);
+	}
+
+	if (sig.value.empty())
+	{
+		return INVALID;
+	}
+
+	sig.length = sig.value.size();
+	sig.on_boundary = on_boundary;
+
+	// the anchor: the byte without wildcards that's least likely to be everywhere
+	// (and followed by a byte that isn't either), the first one if it's a tie
+	sig.anchor = sig.length;
+	int best = 0;
+
+	for (std::size_t i = 0; i < sig.length; i++)
+	{
+		if (sig.mask[i] == 0xFF)
+		{
+			const bool next_known = i + 1 < sig.length && sig.mask[i + 1] == 0xFF;
+			const int score = (is_common_byte(sig.value[i]) ? 0 : 2) + (next_known && !is_common_byte(sig.value[i + 1]) ? 1 : 0);
+
+			if (sig.anchor == sig.length || score > best)
+			{
+				sig.anchor = i;
+				best = score;
+			}
+		}
+	}
+
+	const std::size_t padded = (sig.length + DISA_SIGNATURES_PAD - 1) / DISA_SIGNATURES_PAD * DISA_SIGNATURES_PAD;
+	sig.value.resize(padded, 0);
+	sig.mask.resize(padded, 0);
+
+	const std::size_t id = signatures.size();
+
+	if (sig.anchor == sig.length)
+	{
+		unanchored.push_back(id);
+	}
+	else
+	{
+		const anchor_key key = { sig.value[sig.anchor], sig.anchor + 1 < sig.length ? sig.value[sig.anchor + 1] : std::uint8_t(0), sig.anchor + 1 < sig.length ? sig.mask[sig.anchor + 1] : std::uint8_t(0) };
+		const std::uint8_t byte = key.value;
+
+		if (std::none_of(anchors.begin(), anchors.end(), [&key](const anchor_key& other)
+			{ return other.value == key.value && other.next_value == key.next_value && other.next_mask == key.next_mask; }))
+		{
+			anchors.push_back(key);
+
+			for (unsigned next = 0; next < 256; next++)
+			{
+				if ((next & key.next_mask) == key.next_value)
+				{
+					const unsigned pair = byte | (next << 8);
+					pairs[pair / 64] |= std::uint64_t(1) << (pair % 64);
+				}
+			}
+		}
+
+		buckets[byte].push_back(id);
+	}
+
+	signatures.push_back(std::move(sig));
+	return id;
+}
+
+// `left`: bytes readable from `at`
+bool disa_signatures::matches(const signature& sig, const std::uint8_t* at, const std::size_t left) const
+{
+	if (sig.length > left)
+	{
+		return false;
+	}
+
+#ifdef DISA_SIMD
+	// (the padding has a mask of 0 and a value of 0, so it always compares equal)
+	if (sig.value.size() <= left)
+	{
+		const std::uint32_t all = DISA_VECTOR_SIZE == 32 ? 0xFFFFFFFF : 0xFFFF;
+
+		for (std::size_t i = 0; i < sig.value.size(); i += DISA_VECTOR_SIZE)
+		{
+			const disa_vector bytes = disa_vand(disa_vload(at + i), disa_vload(sig.mask.data() + i));
+
+			if (disa_vmask(disa_veq(bytes, disa_vload(sig.value.data() + i))) != all)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+#endif
+
+	for (std::size_t i = 0; i < sig.length; i++)
+	{
+		if ((at[i] & sig.mask[i]) != sig.value[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Whether a linear sweep starting a little before `offset` has an instruction start there
+// (x86 code lines up again after a couple of instructions, so that's almost
+// always what a sweep of the whole region would find)
+bool disa_signatures::is_boundary(const std::uint8_t* buffer, const std::size_t size, const std::size_t offset, const std::uintptr_t address) const
+{
+	std::size_t at = offset > DISA_SIGNATURES_RESYNC ? offset - DISA_SIGNATURES_RESYNC : 0;
+	disa_record record;
+
+	while (at < offset)
+	{
+		at += decoder.decode(buffer + at, size - at, address + at, record);
+	}
+
+	return at == offset;
+}
+
+// Finds the hits whose anchor byte is in [begin, end)
+// (or whose start is, for signatures without an anchor)
+void disa_signatures::scan_chunk(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address,
+	const std::size_t begin, const std::size_t end, std::vector<disa_signature_hit>& hits) const
+{
+	const auto try_bucket = [&](const std::size_t at)
+	{
+		for (const auto id : buckets[buffer[at]])
+		{
+			const auto& sig = signatures[id];
+
+			if (at < sig.anchor)
+			{
+				continue;
+			}
+
+			const std::size_t start = at - sig.anchor;
+
+			if (matches(sig, buffer + start, size - start) && (!sig.on_boundary || is_boundary(buffer, size, start, address)))
+			{
+				hits.push_back({ address + start, id });
+			}
+		}
+	};
+
+	std::size_t at = begin;
+
+#ifdef DISA_SIMD
+	if (anchors.size() <= DISA_SIGNATURES_VECTOR_ANCHORS)
+	{
+		disa_vector values[DISA_SIGNATURES_VECTOR_ANCHORS], next_values[DISA_SIGNATURES_VECTOR_ANCHORS], next_masks[DISA_SIGNATURES_VECTOR_ANCHORS];
+		const std::size_t nanchors = anchors.size();
+
+		for (std::size_t i = 0; i < nanchors; i++)
+		{
+			values[i] = disa_vset(anchors[i].value);
+			next_values[i] = disa_vset(anchors[i].next_value);
+			next_masks[i] = disa_vset(anchors[i].next_mask);
+		}
+
+		for (; nanchors && at + DISA_VECTOR_SIZE + 1 <= end; at += DISA_VECTOR_SIZE)
+		{
+			const disa_vector bytes = disa_vload(buffer + at);
+			const disa_vector next = disa_vload(buffer + at + 1);
+			std::uint32_t mask = 0;
+
+			for (std::size_t i = 0; i < nanchors; i++)
+			{
+				mask |= disa_vmask(disa_vand(disa_veq(bytes, values[i]), disa_veq(disa_vand(next, next_masks[i]), next_values[i])));
+			}
+
+			for (; mask; mask &= mask - 1)
+			{
+				try_bucket(at + disa_lowest_bit(mask));
+			}
+		}
+	}
+#endif
+
+	for (; at < end && at + 1 < size; at++)
+	{
+		const unsigned pair = buffer[at] | (buffer[at + 1] << 8);
+
+		if ((pairs[pair / 64] >> (pair % 64)) & 1)
+		{
+			try_bucket(at);
+		}
+	}
+
+	// (the last byte of the buffer has no pair, it's always tried)
+	if (at < end)
+	{
+		try_bucket(at);
+	}
+
+	for (const auto id : unanchored)
+	{
+		const auto& sig = signatures[id];
+
+		for (std::size_t start = begin; start < end; start++)
+		{
+			if (matches(sig, buffer + start, size - start) && (!sig.on_boundary || is_boundary(buffer, size, start, address)))
+			{
+				hits.push_back({ address + start, id });
+			}
+		}
+	}
+}
+
+std::vector<disa_signature_hit> disa_signatures::scan(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const std::size_t threads) const
+{
+	const std::size_t nchunks = (size + DISA_SIGNATURES_CHUNK - 1) / DISA_SIGNATURES_CHUNK;
+
+	std::vector<std::vector<disa_signature_hit>> found(nchunks);
+
+	const auto scan_one = [&](const std::size_t i)
+	{
+		const std::size_t begin = i * DISA_SIGNATURES_CHUNK;
+		const std::size_t end = begin + DISA_SIGNATURES_CHUNK < size ? begin + DISA_SIGNATURES_CHUNK : size;
+
+		scan_chunk(buffer, size, address, begin, end, found[i]);
+	};
+
+	if (nchunks <= 1)
+	{
+		for (std::size_t i = 0; i < nchunks; i++)
+		{
+			scan_one(i);
+		}
+	}
+	else
+	{
+		disa_pool pool(threads);
+		pool.run(nchunks, scan_one);
+	}
+
+	std::vector<disa_signature_hit> hits;
+
+	for (const auto& list : found)
+	{
+		hits.insert(hits.end(), list.begin(), list.end());
+	}
+
+	// (a hit is found in the chunk of its anchor, which can be after the chunk of its start)
+	std::sort(hits.begin(), hits.end(), [](const disa_signature_hit& a, const disa_signature_hit& b)
+	{
+		return a.address != b.address ? a.address < b.address : a.signature < b.signature;
+	});
+
+	return hits;
+}
+
+std::vector<disa_signature_hit> disa_signatures::scan(const std::uintptr_t from, const std::uintptr_t to, const std::size_t threads) const
+{
+	return scan(reinterpret_cast<const std::uint8_t*>(from), (to > from) ? to - from : 0, from, threads);
+}
+
+std::vector<std::uintptr_t> disa_signatures::find(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const std::size_t threads) const
+{
+	std::vector<std::uintptr_t> first(signatures.size(), 0);
+	std::vector<std::uint8_t> seen(signatures.size(), 0);
+
+	for (const auto& hit : scan(buffer, size, address, threads))
+	{
+		if (!seen[hit.signature])
+		{
+			seen[hit.signature] = 1;
+			first[hit.signature] = hit.address;
+		}
+	}
+
+	return first;
+}
+
+std::vector<std::uintptr_t> disa_signatures::find(const std::uintptr_t from, const std::uintptr_t to, const std::size_t threads) const
+{
+	return find(reinterpret_cast<const std::uint8_t*>(from), (to > from) ? to - from : 0, from, threads);
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "../disa.hpp"
+
+struct disa_signature_hit
+{
+	std::uintptr_t address;
+	std::size_t signature; // as returned by disa_signatures::add
+};
+
+// Byte signatures (AOB), e.g. "55 8B EC ?? ?? 8B 45 08".
+// A byte is two hex digits; either digit can be a wildcard ('?'),
+// so "8?" matches 80 to 8F, and "??" (or "?") matches anything.
+//
+// All signatures are scanned for in one pass over the memory: each one
+// gets an anchor, a byte without wildcards (plus the byte after it), and
+// only where an anchor is found are the signatures that use it compared,
+// with masked vector compares. With a few distinct anchors, positions are
+// filtered with SSE2/AVX2 compares; with more, through a bitmap of every
+// byte pair an anchor can start with.
+class disa_signatures
+{
+private:
+	struct signature
+	{
+		std::vector<std::uint8_t> value; // (padded to at least one vector with zeroes, the mask is 0 there)
+		std::vector<std::uint8_t> mask;
+		std::size_t length;
+		std::size_t anchor; // index of the anchor byte, or length if every byte has a wildcard
+		bool on_boundary;
+	};
+
+	std::vector<signature> signatures;
+	disa_decoder decoder;
+
+	struct anchor_key
+	{
+		std::uint8_t value;
+		std::uint8_t next_value; // the byte after it, under next_mask
+		std::uint8_t next_mask;
+	};
+
+	std::vector<anchor_key> anchors; // the distinct anchors
+	std::vector<std::uint64_t> pairs; // bit (byte | next << 8) is set if an anchor can start with those two bytes
+	std::vector<std::vector<std::size_t>> buckets; // [byte]: the signatures anchored on it
+	std::vector<std::size_t> unanchored; // compared at every position
+
+	bool matches(const signature& sig, const std::uint8_t* at, const std::size_t left) const;
+	bool is_boundary(const std::uint8_t* buffer, const std::size_t size, const std::size_t offset, const std::uintptr_t address) const;
+	void scan_chunk(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address,
+		const std::size_t begin, const std::size_t end, std::vector<disa_signature_hit>& hits) const;
+public:
+	static constexpr std::size_t INVALID = static_cast<std::size_t>(-1);
+
+	explicit disa_signatures(const disa_decoder& decoder = disa_decoder());
+
+	// Returns the signature's number, or INVALID if the pattern can't be parsed.
+	// With `on_boundary`, a hit only counts if an instruction starts there, as
+	// seen by a linear sweep that starts a little before it
+	std::size_t add(const std::string& pattern, const bool on_boundary = false);
+
+	std::size_t size() const { return signatures.size(); }
+
+	// Every hit of every signature, sorted by address (then signature).
+	// `threads` = 0 uses one thread per hardware thread
+	std::vector<disa_signature_hit> scan(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const std::size_t threads = 0) const;
+	std::vector<disa_signature_hit> scan(const std::uintptr_t from, const std::uintptr_t to, const std::size_t threads = 0) const;
+
+	// The first hit of each signature (by number), or 0 if it wasn't found
+	std::vector<std::uintptr_t> find(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const std::size_t threads = 0) const;
+	std::vector<std::uintptr_t> find(const std::uintptr_t from, const std::uintptr_t to, const std::size_t threads = 0) const;
+};
@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// The few vector operations the byte scanners need, on whatever the
+// compiler targets: AVX2 (32 bytes) if enabled, else SSE2 (16 bytes).
+// DISA_SIMD is left undefined when neither is available, and the
+// scanners fall back to their byte loops.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define DISA_SIMD
+
+typedef __m256i disa_vector;
+constexpr std::size_t DISA_VECTOR_SIZE = 32;
+
+inline disa_vector disa_vload(const std::uint8_t* at) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(at)); }
+inline disa_vector disa_vset(const std::uint8_t byte) { return _mm256_set1_epi8(char(byte)); }
+inline disa_vector disa_veq(const disa_vector a, const disa_vector b) { return _mm256_cmpeq_epi8(a, b); }
+inline disa_vector disa_vand(const disa_vector a, const disa_vector b) { return _mm256_and_si256(a, b); }
+inline disa_vector disa_vor(const disa_vector a, const disa_vector b) { return _mm256_or_si256(a, b); }
+inline disa_vector disa_vandnot(const disa_vector a, const disa_vector b) { return _mm256_andnot_si256(a, b); } // ~a & b
+inline std::uint32_t disa_vmask(const disa_vector a) { return std::uint32_t(_mm256_movemask_epi8(a)); }
+
+// 64-bit lanes (for hashing)
+inline disa_vector disa_vxor(const disa_vector a, const disa_vector b) { return _mm256_xor_si256(a, b); }
+inline disa_vector disa_vadd64(const disa_vector a, const disa_vector b) { return _mm256_add_epi64(a, b); }
+inline disa_vector disa_vmul32(const disa_vector a, const disa_vector b) { return _mm256_mul_epu32(a, b); } // low 32 bits of each lane, 64-bit products
+inline disa_vector disa_vshr64(const disa_vector a) { return _mm256_srli_epi64(a, 32); } // high 32 bits of each lane
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DISA_SIMD
+
+typedef __m128i disa_vector;
+constexpr std::size_t DISA_VECTOR_SIZE = 16;
+
+inline disa_vector disa_vload(const std::uint8_t* at) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(at)); }
+inline disa_vector disa_vset(const std::uint8_t byte) { return _mm_set1_epi8(char(byte)); }
+inline disa_vector disa_veq(const disa_vector a, const disa_vector b) { return _mm_cmpeq_epi8(a, b); }
+inline disa_vector disa_vand(const disa_vector a, const disa_vector b) { return _mm_and_si128(a, b); }
+inline disa_vector disa_vor(const disa_vector a, const disa_vector b) { return _mm_or_si128(a, b); }
+inline disa_vector disa_vandnot(const disa_vector a, const disa_vector b) { return _mm_andnot_si128(a, b); } // ~a & b
+inline std::uint32_t disa_vmask(const disa_vector a) { return std::uint32_t(_mm_movemask_epi8(a)); }
+
+// 64-bit lanes (for hashing)
+inline disa_vector disa_vxor(const disa_vector a, const disa_vector b) { return _mm_xor_si128(a, b); }
+inline disa_vector disa_vadd64(const disa_vector a, const disa_vector b) { return _mm_add_epi64(a, b); }
+inline disa_vector disa_vmul32(const disa_vector a, const disa_vector b) { return _mm_mul_epu32(a, b); } // low 32 bits of each lane, 64-bit products
+inline disa_vector disa_vshr64(const disa_vector a) { return _mm_srli_epi64(a, 32); } // high 32 bits of each lane
+#endif
+
+// Index of the lowest set bit (mask != 0)
+inline std::size_t disa_lowest_bit(const std::uint32_t mask)
+{
+	std::size_t bit = 0;
+
+	while (!((mask >> bit) & 1))
+	{
+		bit++;
+	}
+
+	return bit;
+}
@@ -0,0 +1,419 @@
+#include "disa_snapshot.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+// The columns, in the order of the column table
+enum disa_snapshot_column
+{
+	COLUMN_ADDRESS,		// u64
+	COLUMN_LEN,			// u8
+	COLUMN_ROW,			// u16
+	COLUMN_PREFIX,		// u16
+	COLUMN_NOPERANDS,	// u8
+	COLUMN_SELECTOR,	// u16
+	COLUMN_OP_FLAGS,	// u32, x4 (one column per operand)
+	COLUMN_OP_VALUE = COLUMN_OP_FLAGS + 4,	// u32, x4
+	COLUMN_OP_MODE = COLUMN_OP_VALUE + 4,	// u8, x4
+	COLUMN_OP_BASE = COLUMN_OP_MODE + 4,	// u8, x4
+	COLUMN_OP_INDEX = COLUMN_OP_BASE + 4,	// u8, x4
+	COLUMN_OP_MUL = COLUMN_OP_INDEX + 4,	// u8, x4
+	COLUMN_FUNCTION = COLUMN_OP_MUL + 4,	// u64
+	COLUMN_XREF_TARGET,	// u64
+	COLUMN_XREF_SOURCE,	// u64
+	COLUMN_XREF_KIND,	// u8
+	COLUMN_COUNT
+};
+
+struct disa_snapshot_header
+{
+	char magic[8];
+	std::uint32_t version;
+	std::uint32_t mode;
+	std::uint64_t module_hash;
+	std::uint64_t module_address;
+	std::uint64_t module_size;
+	std::uint64_t count; // instructions
+	std::uint64_t nfunctions;
+	std::uint64_t nxrefs;
+	std::uint32_t ncolumns;
+	std::uint32_t reserved;
+
+	struct
+	{
+		std::uint64_t offset;
+		std::uint64_t size;
+	} columns[COLUMN_COUNT];
+};
+
+static const char DISA_SNAPSHOT_MAGIC[8] = { 'D', 'I', 'S', 'A', 'S', 'N', 'A', 'P' };
+
+static_assert(sizeof(disa_snapshot_header) % 8 == 0, "columns after the header stay aligned");
+
+// A temporary file next to `path` that no other save is writing, in this
+// process or another one (several tools can save the same snapshot at once)
+static std::string temporary_path(const std::string& path)
+{
+	static std::atomic<std::uint32_t> counter(0);
+
+#ifdef _WIN32
+	const long pid = static_cast<long>(_getpid());
+#else
+	const long pid = static_cast<long>(getpid());
+#endif
+
+	return path + "." + std::to_string(pid) + "." + std::to_string(counter++) + ".tmp";
+}
+
+// Bytes per element of a column
+static std::size_t column_width(const std::size_t id)
+{
+	switch (id)
+	{
+	case COLUMN_ADDRESS:
+	case COLUMN_FUNCTION:
+	case COLUMN_XREF_TARGET:
+	case COLUMN_XREF_SOURCE:
+		return 8;
+	case COLUMN_ROW:
+	case COLUMN_PREFIX:
+	case COLUMN_SELECTOR:
+		return 2;
+	default:
+		return (id >= COLUMN_OP_FLAGS && id < COLUMN_OP_MODE) ? 4 : 1;
+	}
+}
+
+static std::uint64_t rotate_left(const std::uint64_t x, const int n)
+{
+	return (x << n) | (x >> (64 - n));
+}
+
+std::uint64_t disa_module_hash(const std::uint8_t* buffer, const std::size_t size)
+{
+	constexpr std::uint64_t P1 = 0x9E3779B185EBCA87ull;
+	constexpr std::uint64_t P2 = 0xC2B2AE3D27D4EB4Full;
+	constexpr std::uint64_t P3 = 0x165667B19E3779F9ull;
+
+	std::uint64_t lanes[4] = { P1 + P2, P2, 0, 0 - P1 };
+	std::size_t at = 0;
+
+	for (; at + 32 <= size; at += 32)
+	{
+		for (std::size_t i = 0; i < 4; i++)
+		{
+			std::uint64_t word;
+			std::memcpy(&word, buffer + at + i * 8, 8);
+			lanes[i] = rotate_left(lanes[i] + word * P2, 31) * P1;
+		}
+	}
+
+	std::uint64_t hash = rotate_left(lanes[0], 1) + rotate_left(lanes[1], 7) + rotate_left(lanes[2], 12) + rotate_left(lanes[3], 18);
+	hash += static_cast<std::uint64_t>(size);
+
+	for (; at < size; at++)
+	{
+		hash = rotate_left(hash ^ (buffer[at] * P3), 11) * P1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= P2;
+	hash ^= hash >> 29;
+	hash *= P3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+disa_snapshot::disa_snapshot()
+	: count(0)
+	, nfunctions(0)
+	, nxrefs(0)
+	, mode(DISA_MODE_32)
+	, columns()
+{
+	static_assert(COLUMN_COUNT == sizeof(columns) / sizeof(columns[0]), "one pointer per column");
+}
+
+bool disa_snapshot::save(const std::string& path, const std::uint8_t* module, const std::size_t size, const std::uintptr_t address,
+	const std::vector<disa_record>& records, const std::vector<std::uintptr_t>& functions, const disa_xrefs* xrefs, const disa_mode mode)
+{
+	const std::size_t n = records.size();
+	const std::size_t nxrefs = xrefs ? xrefs->size() : 0;
+
+	disa_snapshot_header header = {};
+	std::memcpy(header.magic, DISA_SNAPSHOT_MAGIC, sizeof(header.magic));
+	header.version = VERSION;
+	header.mode = mode;
+	header.module_hash = disa_module_hash(module, size);
+	header.module_address = address;
+	header.module_size = size;
+	header.count = n;
+	header.nfunctions = functions.size();
+	header.nxrefs = nxrefs;
+	header.ncolumns = COLUMN_COUNT;
+
+	std::uint64_t offset = sizeof(header);
+
+	for (std::size_t id = 0; id < COLUMN_COUNT; id++)
+	{
+		const std::size_t elements = (id == COLUMN_FUNCTION) ? functions.size() : (id >= COLUMN_XREF_TARGET) ? nxrefs : n;
+
+		header.columns[id].offset = offset;
+		header.columns[id].size = elements * column_width(id);
+		offset += (header.columns[id].size + 7) / 8 * 8;
+	}
+
+	const std::string temporary = temporary_path(path);
+	std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+
+	if (!out)
+	{
+		return false;
+	}
+
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	// one column at a time, through a small buffer
+	std::vector<std::uint8_t> buffer;
+
+	const auto write_column = [&](const std::size_t id, const std::size_t elements, const auto& get)
+	{
+		const std::size_t width = column_width(id);
+		buffer.assign((header.columns[id].size + 7) / 8 * 8, 0);
+
+		for (std::size_t i = 0; i < elements; i++)
+		{
+			const std::uint64_t value = get(i);
+			std::memcpy(buffer.data() + i * width, &value, width); // (little-endian: the low bytes)
+		}
+
+		out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+	};
+
+	write_column(COLUMN_ADDRESS, n, [&](const std::size_t i) { return std::uint64_t(records[i].address); });
+	write_column(COLUMN_LEN, n, [&](const std::size_t i) { return std::uint64_t(records[i].len); });
+	write_column(COLUMN_ROW, n, [&](const std::size_t i) { return std::uint64_t(records[i].row); });
+	write_column(COLUMN_PREFIX, n, [&](const std::size_t i) { return std::uint64_t(records[i].prefix); });
+	write_column(COLUMN_NOPERANDS, n, [&](const std::size_t i) { return std::uint64_t(records[i].noperands); });
+	write_column(COLUMN_SELECTOR, n, [&](const std::size_t i) { return std::uint64_t(records[i].selector); });
+
+	for (std::size_t k = 0; k < 4; k++)
+	{
+		write_column(COLUMN_OP_FLAGS + k, n, [&](const std::size_t i) { return std::uint64_t(records[i].operands[k].flags); });
+	}
+
+	for (std::size_t k = 0; k < 4; k++)
+	{
+		write_column(COLUMN_OP_VALUE + k, n, [&](const std::size_t i) { return std::uint64_t(records[i].operands[k].value); });
+	}
+
+	for (std::size_t k = 0; k < 4; k++)
+	{
+		write_column(COLUMN_OP_MODE + k, n, [&](const std::size_t i) { return std::uint64_t(records[i].operands[k].opmode); });
+	}
+
+	for (std::size_t k = 0; k < 4; k++)
+	{
+		write_column(COLUMN_OP_BASE + k, n, [&](const std::size_t i) { return std::uint64_t(records[i].operands[k].reg[0]); });
+	}
+
+	for (std::size_t k = 0; k < 4; k++)
+	{
+		write_column(COLUMN_OP_INDEX + k, n, [&](const std::size_t i) { return std::uint64_t(records[i].operands[k].reg[1]); });
+	}
+
+	for (std::size_t k = 0; k < 4; k++)
+	{
+		write_column(COLUMN_OP_MUL + k, n, [&](const std::size_t i) { return std::uint64_t(records[i].operands[k].mul); });
+	}
+
+	write_column(COLUMN_FUNCTION, functions.size(), [&](const std::size_t i) { return std::uint64_t(functions[i]); });
+	write_column(COLUMN_XREF_TARGET, nxrefs, [&](const std::size_t i) { return std::uint64_t(xrefs->get_all()[i].target); });
+	write_column(COLUMN_XREF_SOURCE, nxrefs, [&](const std::size_t i) { return std::uint64_t(xrefs->get_all()[i].source); });
+	write_column(COLUMN_XREF_KIND, nxrefs, [&](const std::size_t i) { return std::uint64_t(xrefs->get_all()[i].kind); });
+
+	out.close();
+
+	if (!out)
+	{
+		std::remove(temporary.c_str());
+		return false;
+	}
+
+#ifdef _WIN32
+	std::remove(path.c_str()); // (rename doesn't replace on Windows)
+#endif
+
+	if (std::rename(temporary.c_str(), path.c_str()) != 0)
+	{
+		std::remove(temporary.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+// Maps the file and checks that it's complete; the module checks are up to the caller
+bool disa_snapshot::open_checked(const std::string& path)
+{
+	close();
+
+	if (!file.open(path) || file.size() < sizeof(disa_snapshot_header))
+	{
+		close();
+		return false;
+	}
+
+	disa_snapshot_header header;
+	std::memcpy(&header, file.data(), sizeof(header));
+
+	if (std::memcmp(header.magic, DISA_SNAPSHOT_MAGIC, sizeof(header.magic)) || header.version != VERSION || header.ncolumns != COLUMN_COUNT)
+	{
+		close();
+		return false;
+	}
+
+	for (std::size_t id = 0; id < COLUMN_COUNT; id++)
+	{
+		const std::uint64_t elements = (id == COLUMN_FUNCTION) ? header.nfunctions : (id >= COLUMN_XREF_TARGET) ? header.nxrefs : header.count;
+		const auto& entry = header.columns[id];
+
+		// (elements is checked first, so that a corrupt count can't overflow elements * width)
+		if (entry.offset % 8 || entry.offset > file.size() || elements > (file.size() - entry.offset) / column_width(id) || entry.size > file.size() - entry.offset || entry.size != elements * column_width(id))
+		{
+			close();
+			return false;
+		}
+
+		columns[id] = file.data() + entry.offset;
+	}
+
+	count = header.count;
+	nfunctions = header.nfunctions;
+	nxrefs = header.nxrefs;
+	mode = header.mode;
+	return true;
+}
+
+bool disa_snapshot::open(const std::string& path, const std::uint8_t* module, const std::size_t size, const std::uintptr_t address)
+{
+	if (!open_checked(path))
+	{
+		return false;
+	}
+
+	disa_snapshot_header header;
+	std::memcpy(&header, file.data(), sizeof(header));
+
+	if (header.module_size != size || header.module_address != address || header.module_hash != disa_module_hash(module, size))
+	{
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+bool disa_snapshot::open(const std::string& path, const std::uint64_t module_hash, const std::uintptr_t address)
+{
+	if (!open_checked(path))
+	{
+		return false;
+	}
+
+	disa_snapshot_header header;
+	std::memcpy(&header, file.data(), sizeof(header));
+
+	if (header.module_address != address || header.module_hash != module_hash)
+	{
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+void disa_snapshot::close()
+{
+	file.close();
+
+	count = 0;
+	nfunctions = 0;
+	nxrefs = 0;
+	mode = DISA_MODE_32;
+
+	for (auto& c : columns)
+	{
+		c = nullptr;
+	}
+}
+
+disa_span<std::uint64_t> disa_snapshot::get_starts() const
+{
+	const auto first = column<std::uint64_t>(COLUMN_ADDRESS);
+	return { first, first + count };
+}
+
+disa_record disa_snapshot::record(const std::size_t i) const
+{
+	disa_record rec;
+	rec.address = static_cast<std::uintptr_t>(column<std::uint64_t>(COLUMN_ADDRESS)[i]);
+	rec.len = column<std::uint8_t>(COLUMN_LEN)[i];
+	rec.row = column<std::uint16_t>(COLUMN_ROW)[i];
+	rec.prefix = column<std::uint16_t>(COLUMN_PREFIX)[i];
+	rec.noperands = column<std::uint8_t>(COLUMN_NOPERANDS)[i];
+	rec.selector = column<std::uint16_t>(COLUMN_SELECTOR)[i];
+
+	for (std::size_t k = 0; k < 4; k++)
+	{
+		auto& operand = rec.operands[k];
+		operand.flags = column<std::uint32_t>(COLUMN_OP_FLAGS + k)[i];
+		operand.value = column<std::uint32_t>(COLUMN_OP_VALUE + k)[i];
+		operand.opmode = column<std::uint8_t>(COLUMN_OP_MODE + k)[i];
+		operand.reg[0] = column<std::uint8_t>(COLUMN_OP_BASE + k)[i];
+		operand.reg[1] = column<std::uint8_t>(COLUMN_OP_INDEX + k)[i];
+		operand.mul = column<std::uint8_t>(COLUMN_OP_MUL + k)[i];
+	}
+
+	return rec;
+}
+
+std::size_t disa_snapshot::find(const std::uintptr_t address) const
+{
+	const auto starts = get_starts();
+	const auto it = std::lower_bound(starts.begin(), starts.end(), std::uint64_t(address));
+
+	return (it != starts.end() && *it == address) ? static_cast<std::size_t>(it - starts.begin()) : size();
+}
+
+disa_span<std::uint64_t> disa_snapshot::get_functions() const
+{
+	const auto first = column<std::uint64_t>(COLUMN_FUNCTION);
+	return { first, first + nfunctions };
+}
+
+disa_xref disa_snapshot::xref(const std::size_t i) const
+{
+	disa_xref x;
+	x.target = static_cast<std::uintptr_t>(column<std::uint64_t>(COLUMN_XREF_TARGET)[i]);
+	x.source = static_cast<std::uintptr_t>(column<std::uint64_t>(COLUMN_XREF_SOURCE)[i]);
+	x.kind = static_cast<disa_xref_kind>(column<std::uint8_t>(COLUMN_XREF_KIND)[i]);
+	return x;
+}
+
+disa_span<std::uint64_t> disa_snapshot::xref_sources(const std::uintptr_t target) const
+{
+	const auto targets = column<std::uint64_t>(COLUMN_XREF_TARGET);
+	const auto range = std::equal_range(targets, targets + nxrefs, std::uint64_t(target));
+	const auto sources = column<std::uint64_t>(COLUMN_XREF_SOURCE);
+
+	return { sources + (range.first - targets), sources + (range.second - targets) };
+}
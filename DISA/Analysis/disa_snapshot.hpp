@@ -0,0 +1,73 @@
+#pragma once
+#include "../disa.hpp"
+#include "disa_mapping.hpp"
+#include "disa_span.hpp"
+#include "disa_xrefs.hpp"
+
+// 64-bit hash of a module's bytes (not cryptographic; reads 32 bytes at a time)
+std::uint64_t disa_module_hash(const std::uint8_t* buffer, const std::size_t size);
+
+// The results of analysing a module, saved to a file that's mapped back
+// as is on the next run: the records (by column), the function starts
+// and the xrefs. Every column is a plain array at an 8-byte aligned
+// offset in the file, so opening it is a few checks and no parsing.
+// The file remembers the module's hash, address and size, and won't
+// open for a different module (or a different version of the format).
+//
+//   disa_snapshot snapshot;
+//   if (!snapshot.open(path, module, size, address))
+//   {
+//       ...analyse...
+//       disa_snapshot::save(path, module, size, address, records, functions, &xrefs);
+//       snapshot.open(path, module, size, address);
+//   }
+class disa_snapshot
+{
+private:
+	disa_mapping file;
+
+	std::uint64_t count;
+	std::uint64_t nfunctions;
+	std::uint64_t nxrefs;
+	std::uint32_t mode;
+	const std::uint8_t* columns[34];
+
+	template <typename T>
+	const T* column(const std::size_t id) const { return reinterpret_cast<const T*>(columns[id]); }
+
+	bool open_checked(const std::string& path);
+public:
+	static constexpr std::uint32_t VERSION = 1;
+
+	disa_snapshot();
+
+	// Saves to `path` (through a temporary file, so a reader never sees half of it).
+	// `records` sorted by address, `xrefs` may be null
+	static bool save(const std::string& path, const std::uint8_t* module, const std::size_t size, const std::uintptr_t address,
+		const std::vector<disa_record>& records, const std::vector<std::uintptr_t>& functions, const disa_xrefs* xrefs, const disa_mode mode = DISA_MODE_32);
+
+	// false if there's no file, or it isn't for these exact bytes at this address
+	bool open(const std::string& path, const std::uint8_t* module, const std::size_t size, const std::uintptr_t address);
+
+	// Without hashing the module (e.g. the hash was checked some other way)
+	bool open(const std::string& path, const std::uint64_t module_hash, const std::uintptr_t address);
+
+	void close();
+	bool is_open() const { return file.data() != nullptr; }
+
+	disa_mode get_mode() const { return static_cast<disa_mode>(mode); }
+
+	// Instructions
+	std::size_t size() const { return static_cast<std::size_t>(count); }
+	disa_span<std::uint64_t> get_starts() const; // sorted
+	disa_record record(const std::size_t i) const;
+	std::size_t find(const std::uintptr_t address) const; // index of the instruction at `address`, or size()
+
+	// Function starts, sorted
+	disa_span<std::uint64_t> get_functions() const;
+
+	// Xrefs, sorted by target and then source
+	std::size_t xref_count() const { return static_cast<std::size_t>(nxrefs); }
+	disa_xref xref(const std::size_t i) const;
+	disa_span<std::uint64_t> xref_sources(const std::uintptr_t target) const; // what refers to `target`
+};
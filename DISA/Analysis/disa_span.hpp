@@ -0,0 +1,16 @@
+#pragma once
+#include <cstddef>
+
+// A read-only view of part of an array (the results of analysis passes point into their own storage)
+template <typename T>
+struct disa_span
+{
+	const T* first;
+	const T* last;
+
+	const T* begin() const { return first; }
+	const T* end() const { return last; }
+	std::size_t size() const { return last - first; }
+	bool empty() const { return first == last; }
+	const T& operator[](const std::size_t i) const { return first[i]; }
+};
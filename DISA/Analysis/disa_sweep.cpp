@@ -0,0 +1,169 @@
+#include "disa_sweep.hpp"
+#include "disa_pool.hpp"
+#include <algorithm>
+
+// Chunks are never smaller than this, so the stitching stays
+// a tiny part of the work
+constexpr std::size_t DISA_SWEEP_MIN_CHUNK = 64 * 1024;
+
+// chunks per thread, so threads that finish early can steal
+constexpr std::size_t DISA_SWEEP_CHUNKS_PER_THREAD = 8;
+
+struct disa_sweep_region
+{
+	const disa_decoder& decoder;
+	const std::uint8_t* base;
+	std::size_t size;
+	std::uintptr_t address;
+	bool bounded; // never read past base + size
+
+	// decodes the instruction at `offset`, returns its length
+	std::size_t decode(const std::size_t offset, disa_record& record) const
+	{
+		const std::size_t n = bounded ? size - offset : sizeof(disa_inst::bytes);
+		decoder.decode(base + offset, n, address + offset, record);
+		return record.len;
+	}
+};
+
+struct disa_sweep_chunk
+{
+	std::size_t begin;
+	std::size_t end;
+	std::size_t exit; // offset after the last instruction decoded from `begin`
+
+	std::vector<disa_record> records; // decoded from `begin`
+
+	// filled in while stitching
+	std::vector<disa_record> resync; // decoded again from the real entry point
+	std::size_t keep; // records[keep...] are part of the result
+	std::size_t out; // where this chunk goes in the result
+};
+
+static void sweep_chunk(const disa_sweep_region& region, disa_sweep_chunk& chunk)
+{
+	chunk.records.reserve((chunk.end - chunk.begin) / 3);
+
+	std::size_t offset = chunk.begin;
+	disa_record record;
+
+	while (offset < chunk.end)
+	{
+		offset += region.decode(offset, record);
+		chunk.records.push_back(record);
+	}
+
+	chunk.exit = offset;
+}
+
+// Offset of the first instruction at or after `entry` that the serial sweep
+// and the chunk agree on. Everything before it is decoded into chunk.resync
+static std::size_t resync_chunk(const disa_sweep_region& region, disa_sweep_chunk& chunk, const std::size_t entry)
+{
+	const auto offset_of = [&region](const disa_record& record)
+	{
+		return static_cast<std::size_t>(record.address - region.address);
+	};
+
+	auto it = std::lower_bound(chunk.records.begin(), chunk.records.end(), entry, [&offset_of](const disa_record& record, const std::size_t offset)
+	{
+		return offset_of(record) < offset;
+	});
+
+	std::size_t offset = entry;
+	disa_record record;
+
+	while (offset < chunk.end)
+	{
+		while (it != chunk.records.end() && offset_of(*it) < offset)
+		{
+			it++;
+		}
+
+		if (it != chunk.records.end() && offset_of(*it) == offset)
+		{
+			// from here on, both decode the same instructions
+			chunk.keep = it - chunk.records.begin();
+			return chunk.exit;
+		}
+
+		offset += region.decode(offset, record);
+		chunk.resync.push_back(record);
+	}
+
+	// never lined up inside this chunk
+	chunk.keep = chunk.records.size();
+	return offset;
+}
+
+static std::vector<disa_record> parallel_sweep(const disa_sweep_region& region, std::size_t threads)
+{
+	std::vector<disa_record> result;
+
+	if (region.size == 0)
+	{
+		return result;
+	}
+
+	disa_pool pool(threads);
+	threads = pool.size();
+
+	const std::size_t chunk_size = std::max(DISA_SWEEP_MIN_CHUNK, region.size / (threads * DISA_SWEEP_CHUNKS_PER_THREAD) + 1);
+	const std::size_t nchunks = (region.size + chunk_size - 1) / chunk_size;
+
+	std::vector<disa_sweep_chunk> chunks(nchunks);
+
+	for (std::size_t i = 0; i < nchunks; i++)
+	{
+		chunks[i].begin = i * chunk_size;
+		chunks[i].end = std::min(region.size, chunks[i].begin + chunk_size);
+	}
+
+	pool.run(nchunks, [&region, &chunks](const std::size_t i)
+	{
+		sweep_chunk(region, chunks[i]);
+	});
+
+	// stitch the chunks together, in order
+	std::size_t entry = 0; // where the serial sweep enters the next chunk
+	std::size_t total = 0;
+
+	for (auto& chunk : chunks)
+	{
+		if (entry >= chunk.end)
+		{
+			// an instruction covers the whole chunk
+			chunk.keep = chunk.records.size();
+		}
+		else
+		{
+			entry = resync_chunk(region, chunk, entry);
+		}
+
+		chunk.out = total;
+		total += chunk.resync.size() + chunk.records.size() - chunk.keep;
+	}
+
+	result.resize(total);
+
+	pool.run(nchunks, [&chunks, &result](const std::size_t i)
+	{
+		const auto& chunk = chunks[i];
+		auto out = std::copy(chunk.resync.begin(), chunk.resync.end(), result.begin() + chunk.out);
+		std::copy(chunk.records.begin() + chunk.keep, chunk.records.end(), out);
+	});
+
+	return result;
+}
+
+std::vector<disa_record> disa_parallel_sweep(const std::uintptr_t from, const std::uintptr_t to, const std::size_t threads, const disa_decoder& decoder)
+{
+	const disa_sweep_region region = { decoder, reinterpret_cast<const std::uint8_t*>(from), (to > from) ? to - from : 0, from, false };
+	return parallel_sweep(region, threads);
+}
+
+std::vector<disa_record> disa_parallel_sweep(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const std::size_t threads, const disa_decoder& decoder)
+{
+	const disa_sweep_region region = { decoder, buffer, size, address, true };
+	return parallel_sweep(region, threads);
+}
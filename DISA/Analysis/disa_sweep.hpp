@@ -0,0 +1,18 @@
+#pragma once
+#include "../disa.hpp"
+
+// Linear sweep on several threads.
+// The region is split into chunks that are decoded in parallel, each one
+// starting as if an instruction began at its first byte. The chunks are
+// then stitched together in order: where the instruction that really
+// crosses into a chunk ends somewhere else than where the chunk started,
+// a few instructions are decoded again until the two line up.
+// The result is always exactly what a serial sweep gives
+// (disa_ranged_read/disa_stream over the same region).
+// `threads` = 0 uses one thread per hardware thread.
+
+// memory of the current process
+std::vector<disa_record> disa_parallel_sweep(const std::uintptr_t from, const std::uintptr_t to, const std::size_t threads = 0, const disa_decoder& decoder = disa_decoder());
+
+// a buffer that's located at `address` in the target
+std::vector<disa_record> disa_parallel_sweep(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const std::size_t threads = 0, const disa_decoder& decoder = disa_decoder());
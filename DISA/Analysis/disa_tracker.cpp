@@ -0,0 +1,307 @@
+#include "disa_tracker.hpp"
+#include "disa_simd.hpp"
+#include "disa_sweep.hpp"
+#include <algorithm>
+#include <cstring>
+
+// One key per 64-bit word of a block
+alignas(64) static const std::uint64_t DISA_BLOCK_KEYS[disa_tracker::BLOCK_SIZE / 8] =
+{
+	0xBE4BA423396CFEB8ull, 0x1CAD21F72C81017Cull, 0xDB979083E96DD4DEull, 0x1F67B3B7A4A44072ull,
+	0x78E5C0CC4EE679CBull, 0x2172FFCC7DD05A82ull, 0x8E2443F7744608B8ull, 0x4C263A81E69035E0ull,
+};
+
+// Each word, mixed with its key, is split into two halves that are multiplied
+// together; the products and the words themselves are summed. The same sum
+// with or without vectors
+static std::uint64_t block_hash(const std::uint8_t* block)
+{
+	std::uint64_t hash = 0;
+
+#ifdef DISA_SIMD
+	disa_vector sum = disa_vset(0);
+
+	for (std::size_t i = 0; i < disa_tracker::BLOCK_SIZE; i += DISA_VECTOR_SIZE)
+	{
+		const disa_vector data = disa_vload(block + i);
+		const disa_vector mixed = disa_vxor(data, disa_vload(reinterpret_cast<const std::uint8_t*>(DISA_BLOCK_KEYS) + i));
+		sum = disa_vadd64(sum, disa_vadd64(disa_vmul32(mixed, disa_vshr64(mixed)), data));
+	}
+
+	std::uint64_t lanes[DISA_VECTOR_SIZE / 8];
+	std::memcpy(lanes, &sum, sizeof(lanes));
+
+	for (const auto lane : lanes)
+	{
+		hash += lane;
+	}
+#else
+	for (std::size_t i = 0; i < disa_tracker::BLOCK_SIZE / 8; i++)
+	{
+		std::uint64_t word;
+		std::memcpy(&word, block + i * 8, 8);
+
+		const std::uint64_t mixed = word ^ DISA_BLOCK_KEYS[i];
+		hash += (mixed & 0xFFFFFFFF) * (mixed >> 32) + word;
+	}
+#endif
+
+	hash ^= hash >> 37;
+	hash *= 0x165667919E3779F9ull;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+disa_tracker::disa_tracker(const std::uintptr_t from, const std::uintptr_t to, const std::size_t threads, const disa_decoder& decoder)
+	: decoder(decoder)
+	, base(reinterpret_cast<const std::uint8_t*>(from))
+	, length((to > from) ? to - from : 0)
+	, address(from)
+	, bounded(false)
+	, count(0)
+{
+	load(threads);
+}
+
+disa_tracker::disa_tracker(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const std::size_t threads, const disa_decoder& decoder)
+	: decoder(decoder)
+	, base(buffer)
+	, length(size)
+	, address(address)
+	, bounded(true)
+	, count(0)
+{
+	load(threads);
+}
+
+void disa_tracker::load(const std::size_t threads)
+{
+	const auto records = bounded
+		? disa_parallel_sweep(base, length, address, threads, decoder)
+		: disa_parallel_sweep(address, address + length, threads, decoder);
+
+	pages.assign((length + PAGE_SIZE - 1) / PAGE_SIZE, {});
+
+	for (const auto& record : records)
+	{
+		pages[(record.address - address) / PAGE_SIZE].push_back(record);
+	}
+
+	count = records.size();
+
+	hashes.resize((length + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
+	for (std::size_t block = 0; block < hashes.size(); block++)
+	{
+		hashes[block] = hash_block(block);
+	}
+}
+
+std::uint64_t disa_tracker::hash_block(const std::size_t block) const
+{
+	const std::size_t offset = block * BLOCK_SIZE;
+
+	if (length - offset >= BLOCK_SIZE)
+	{
+		return block_hash(base + offset);
+	}
+
+	// the last block, padded with zeros
+	std::uint8_t tail[BLOCK_SIZE] = {};
+	std::memcpy(tail, base + offset, length - offset);
+	return block_hash(tail);
+}
+
+std::size_t disa_tracker::decode(const std::size_t offset, disa_record& record) const
+{
+	const std::size_t n = bounded ? length - offset : sizeof(disa_inst::bytes);
+	decoder.decode(base + offset, n, address + offset, record);
+	return record.len;
+}
+
+std::size_t disa_tracker::refresh()
+{
+	return refresh(address, address + length);
+}
+
+std::size_t disa_tracker::refresh(const std::uintptr_t from, const std::uintptr_t to)
+{
+	changes.clear();
+
+	const std::size_t first = (from > address) ? std::min<std::size_t>(from - address, length) : 0;
+	const std::size_t last = (to > address) ? std::min<std::size_t>(to - address, length) : 0;
+
+	// changed blocks, as runs of offsets
+	std::vector<std::pair<std::size_t, std::size_t>> runs;
+	std::size_t changed = 0;
+
+	for (std::size_t block = first / BLOCK_SIZE; block * BLOCK_SIZE < last; block++)
+	{
+		const std::uint64_t hash = hash_block(block);
+
+		if (hash == hashes[block])
+		{
+			continue;
+		}
+
+		hashes[block] = hash;
+		changed++;
+
+		const std::size_t begin = block * BLOCK_SIZE;
+		const std::size_t end = std::min(begin + BLOCK_SIZE, length);
+
+		if (!runs.empty() && runs.back().second == begin)
+		{
+			runs.back().second = end;
+		}
+		else
+		{
+			runs.emplace_back(begin, end);
+		}
+	}
+
+	for (std::size_t next = 0; next < runs.size();)
+	{
+		next = redecode(runs, next);
+	}
+
+	return changed;
+}
+
+// Decodes again from the instruction that covers the start of runs[next],
+// until past its end (and the end of any run reached on the way) where the
+// new instructions line up with the old ones. Returns the next run to do
+std::size_t disa_tracker::redecode(const std::vector<std::pair<std::size_t, std::size_t>>& runs, std::size_t next)
+{
+	const auto offset_of = [this](const disa_record& record)
+	{
+		return static_cast<std::size_t>(record.address - address);
+	};
+
+	const auto by_offset = [&offset_of](const disa_record& record, const std::size_t offset)
+	{
+		return offset_of(record) < offset;
+	};
+
+	const std::size_t changed = runs[next].first;
+	std::size_t end = runs[next].second;
+	next++;
+
+	// the last old instruction that starts at or before the change covers it
+	std::size_t start = 0;
+
+	for (std::size_t page = changed / PAGE_SIZE + 1; page-- > 0;)
+	{
+		const auto& records = pages[page];
+		const auto it = std::upper_bound(records.begin(), records.end(), changed, [&offset_of](const std::size_t offset, const disa_record& record)
+		{
+			return offset < offset_of(record);
+		});
+
+		if (it != records.begin())
+		{
+			start = offset_of(*(it - 1));
+			break;
+		}
+	}
+
+	// walks over the old instructions, to see where the new ones line up
+	std::size_t page = start / PAGE_SIZE;
+	std::size_t index = std::lower_bound(pages[page].begin(), pages[page].end(), start, by_offset) - pages[page].begin();
+
+	std::vector<disa_record> decoded;
+	std::size_t offset = start;
+	disa_record record;
+
+	while (offset < length)
+	{
+		while (next < runs.size() && runs[next].first <= offset)
+		{
+			end = std::max(end, runs[next].second);
+			next++;
+		}
+
+		while (page < pages.size() && (index == pages[page].size() || offset_of(pages[page][index]) < offset))
+		{
+			if (index == pages[page].size())
+			{
+				page++;
+				index = 0;
+			}
+			else
+			{
+				index++;
+			}
+		}
+
+		if (offset >= end && page < pages.size() && offset_of(pages[page][index]) == offset)
+		{
+			break; // from here on, the old instructions are still right
+		}
+
+		offset += decode(offset, record);
+		decoded.push_back(record);
+	}
+
+	// replace the old instructions in [start, offset), page by page
+	const std::size_t resync = offset;
+	const std::size_t last_page = std::min(pages.size(), (resync + PAGE_SIZE - 1) / PAGE_SIZE);
+	auto source = decoded.begin();
+
+	for (std::size_t p = start / PAGE_SIZE; p < last_page; p++)
+	{
+		auto& records = pages[p];
+		const auto low = std::lower_bound(records.begin(), records.end(), start, by_offset);
+		const auto high = std::lower_bound(low, records.end(), resync, by_offset);
+
+		const auto first = source;
+
+		while (source != decoded.end() && offset_of(*source) / PAGE_SIZE == p)
+		{
+			source++;
+		}
+
+		count -= high - low;
+		count += source - first;
+
+		records.insert(records.erase(low, high), first, source);
+	}
+
+	changes.emplace_back(address + start, address + resync);
+	return next;
+}
+
+disa_span<disa_record> disa_tracker::get_page(const std::size_t page) const
+{
+	const auto& records = pages[page];
+	return { records.data(), records.data() + records.size() };
+}
+
+std::vector<disa_record> disa_tracker::get_records() const
+{
+	std::vector<disa_record> records;
+	records.reserve(count);
+
+	for (const auto& page : pages)
+	{
+		records.insert(records.end(), page.begin(), page.end());
+	}
+
+	return records;
+}
+
+const disa_record* disa_tracker::find(const std::uintptr_t at) const
+{
+	if (at < address || at - address >= length)
+	{
+		return nullptr;
+	}
+
+	const auto& records = pages[(at - address) / PAGE_SIZE];
+	const auto it = std::lower_bound(records.begin(), records.end(), at, [](const disa_record& record, const std::uintptr_t a)
+	{
+		return record.address < a;
+	});
+
+	return (it != records.end() && it->address == at) ? &*it : nullptr;
+}
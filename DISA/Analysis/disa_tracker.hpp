@@ -0,0 +1,59 @@
+#pragma once
+#include "../disa.hpp"
+#include "disa_span.hpp"
+
+// Keeps a linear sweep of a region current while the code in it changes
+// (hooks, other tools, self-modifying code).
+// Every 64-byte block of the region has a hash; refresh() hashes the
+// blocks again, and only where a hash changed are instructions decoded
+// again: from the instruction that covers the first changed byte, past
+// the last one, until the new instructions line up with the old ones.
+// The instructions are kept per 4 KB page of the region, so replacing
+// some of them doesn't move the rest, and a refresh costs one pass of
+// hashing plus work proportional to the bytes that changed.
+// Not thread safe: refresh() and the readers must not run at the same time.
+class disa_tracker
+{
+private:
+	disa_decoder decoder;
+	const std::uint8_t* base;
+	std::size_t length;
+	std::uintptr_t address;
+	bool bounded; // never read past base + length
+
+	std::vector<std::uint64_t> hashes; // one per block
+	std::vector<std::vector<disa_record>> pages; // instructions by the page they start in
+	std::size_t count;
+
+	std::vector<std::pair<std::uintptr_t, std::uintptr_t>> changes;
+
+	void load(const std::size_t threads);
+	std::uint64_t hash_block(const std::size_t block) const;
+	std::size_t decode(const std::size_t offset, disa_record& record) const;
+	std::size_t redecode(const std::vector<std::pair<std::size_t, std::size_t>>& runs, std::size_t next);
+public:
+	static constexpr std::size_t BLOCK_SIZE = 64;
+	static constexpr std::size_t PAGE_SIZE = 4096;
+
+	// memory of the current process
+	disa_tracker(const std::uintptr_t from, const std::uintptr_t to, const std::size_t threads = 0, const disa_decoder& decoder = disa_decoder());
+
+	// a buffer that's located at `address` in the target (the tracker keeps pointing to it)
+	disa_tracker(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const std::size_t threads = 0, const disa_decoder& decoder = disa_decoder());
+
+	// Looks for changes in the whole region, returns the number of changed blocks
+	std::size_t refresh();
+
+	// Only in [from, to) (e.g. where a hook was just placed)
+	std::size_t refresh(const std::uintptr_t from, const std::uintptr_t to);
+
+	// Address ranges decoded again by the last refresh, in order
+	const std::vector<std::pair<std::uintptr_t, std::uintptr_t>>& get_changes() const { return changes; }
+
+	std::size_t size() const { return count; }
+	std::size_t page_count() const { return pages.size(); }
+	disa_span<disa_record> get_page(const std::size_t page) const; // instructions that start in a page, sorted
+	std::vector<disa_record> get_records() const; // all of them, sorted (a copy)
+
+	const disa_record* find(const std::uintptr_t at) const; // the instruction that starts at `at`, or nullptr
+};
@@ -0,0 +1,119 @@
+#include "disa_xrefs.hpp"
+#include "disa_flow.hpp"
+#include "disa_sweep.hpp"
+#include <algorithm>
+
+disa_xrefs::disa_xrefs(const std::vector<disa_record>& records, const std::uintptr_t module_begin, const std::uintptr_t module_end)
+	: module_begin(module_begin)
+	, module_end(module_end)
+{
+	build(records);
+}
+
+disa_xrefs::disa_xrefs(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const std::size_t threads, const disa_decoder& decoder)
+	: module_begin(address)
+	, module_end(address + size)
+{
+	build(disa_parallel_sweep(buffer, size, address, threads, decoder));
+}
+
+void disa_xrefs::build(const std::vector<disa_record>& records)
+{
+	const auto add = [this](const std::uintptr_t target, const std::uintptr_t source, const disa_xref_kind kind)
+	{
+		if (target >= module_begin && target < module_end)
+		{
+			xrefs.push_back({ target, source, kind });
+		}
+	};
+
+	xrefs.clear();
+
+	for (const auto& rec : records)
+	{
+		std::uintptr_t target;
+
+		if (rec.branch_target(target))
+		{
+			const auto flow = disa_flow(rec);
+			add(target, rec.address, flow == DISA_FLOW_CALL ? DISA_XREF_CALL : flow == DISA_FLOW_JMP ? DISA_XREF_JMP : DISA_XREF_JCC);
+		}
+
+		// [disp32], [rip+disp32] and moffs (an instruction has one memory operand at most)
+		if (rec.memory_target(target))
+		{
+			add(target, rec.address, DISA_XREF_MEMORY);
+		}
+
+		for (std::uint8_t i = 0; i < rec.noperands; i++)
+		{
+			const auto& operand = rec.operands[i];
+
+			// a memory operand's displacement is OP_DISP32 on its own, OP_IMM32 after a register;
+			// outside of [...], OP_DISP32 is an imm32 (or the offset of a ptr16:32) and OP_DISP64 an imm64
+			if (operand.flags & OP_MEM)
+			{
+				if ((operand.flags & (OP_DISP32 | OP_IMM32)) && operand.reg_count() != 0)
+				{
+					add(operand.value, rec.address, DISA_XREF_MEMORY);
+				}
+			}
+			else if ((operand.flags & (OP_DISP32 | OP_DISP64)) && operand.reg_count() == 0)
+			{
+				add(static_cast<std::uintptr_t>(rec.value64(i)), rec.address, DISA_XREF_IMMEDIATE);
+			}
+		}
+	}
+
+	std::sort(xrefs.begin(), xrefs.end(), [](const disa_xref& a, const disa_xref& b)
+	{
+		return a.target != b.target ? a.target < b.target : a.source < b.source;
+	});
+
+	xrefs.shrink_to_fit();
+}
+
+disa_span<disa_xref> disa_xrefs::to(const std::uintptr_t target) const
+{
+	return to(target, target + 1);
+}
+
+disa_span<disa_xref> disa_xrefs::to(const std::uintptr_t first, const std::uintptr_t last) const
+{
+	const auto by_target = [](const disa_xref& xref, const std::uintptr_t at) { return xref.target < at; };
+
+	const auto begin = std::lower_bound(xrefs.begin(), xrefs.end(), first, by_target);
+	const auto end = std::lower_bound(begin, xrefs.end(), last, by_target);
+
+	return { xrefs.data() + (begin - xrefs.begin()), xrefs.data() + (end - xrefs.begin()) };
+}
+
+std::vector<std::uintptr_t> disa_xrefs::callers(const std::uintptr_t target) const
+{
+	std::vector<std::uintptr_t> result;
+
+	for (const auto& xref : to(target))
+	{
+		if (xref.kind == DISA_XREF_CALL)
+		{
+			result.push_back(xref.source);
+		}
+	}
+
+	return result;
+}
+
+std::vector<std::uintptr_t> disa_xrefs::accesses(const std::uintptr_t target) const
+{
+	std::vector<std::uintptr_t> result;
+
+	for (const auto& xref : to(target))
+	{
+		if (xref.kind == DISA_XREF_MEMORY)
+		{
+			result.push_back(xref.source);
+		}
+	}
+
+	return result;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include "../disa.hpp"
+#include "disa_span.hpp"
+
+enum disa_xref_kind : std::uint8_t
+{
+	DISA_XREF_CALL,			// call rel32
+	DISA_XREF_JMP,			// jmp rel8/rel32
+	DISA_XREF_JCC,			// jcc, loop, jecxz
+	DISA_XREF_MEMORY,		// a [disp32], [reg+disp32], [rip+disp32] or moffs operand (mov eax,[00403010], mov eax,[00403010+ecx*4])
+	DISA_XREF_IMMEDIATE,	// an imm32 or imm64 operand (push 00403010, mov eax,00403010)
+};
+
+struct disa_xref
+{
+	std::uintptr_t target;
+	std::uintptr_t source; // address of the instruction
+	disa_xref_kind kind;
+};
+
+// Cross-references: every branch target, 32-bit displacement (or the target
+// of a [rip+disp32]) and 32/64-bit immediate that points into the module,
+// indexed by what it points to.
+// Built in one pass over the instructions; the xrefs are then kept in
+// one array sorted by target (then source), so a lookup is a binary search.
+class disa_xrefs
+{
+private:
+	std::vector<disa_xref> xrefs;
+	std::uintptr_t module_begin;
+	std::uintptr_t module_end;
+
+	void build(const std::vector<disa_record>& records);
+public:
+	// `records` from a sweep or a descent; only references into [module_begin, module_end) are kept
+	disa_xrefs(const std::vector<disa_record>& records, const std::uintptr_t module_begin, const std::uintptr_t module_end);
+
+	// Sweeps a buffer that's located at `address` in the target (with disa_parallel_sweep)
+	disa_xrefs(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const std::size_t threads = 0, const disa_decoder& decoder = disa_decoder());
+
+	std::size_t size() const { return xrefs.size(); }
+
+	disa_span<disa_xref> get_all() const { return { xrefs.data(), xrefs.data() + xrefs.size() }; }
+
+	// Everything that refers to `target`, sorted by source
+	disa_span<disa_xref> to(const std::uintptr_t target) const;
+
+	// Everything that refers to [first, last) (a struct, a table...), sorted by target
+	disa_span<disa_xref> to(const std::uintptr_t first, const std::uintptr_t last) const;
+
+	// The instructions that call `target` / read or write the global at `target`
+	std::vector<std::uintptr_t> callers(const std::uintptr_t target) const;
+	std::vector<std::uintptr_t> accesses(const std::uintptr_t target) const;
+};
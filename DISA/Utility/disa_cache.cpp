@@ -0,0 +1,324 @@
+#include "disa_cache.hpp"
+#include <cstring>
+#include <vector>
+
+// an instruction that starts this far before a range can still overlap it
+constexpr std::uintptr_t DISA_CACHE_MAX_LENGTH = 15;
+
+// ranges up to this size are invalidated address by address, bigger ones by going over every slot
+constexpr std::uintptr_t DISA_CACHE_PROBE_RANGE = 256;
+
+// the live caches, for invalidate_all
+static std::mutex& registry_lock()
+{
+	static std::mutex lock;
+	return lock;
+}
+
+static std::vector<disa_cache*>& registry()
+{
+	static std::vector<disa_cache*> caches;
+	return caches;
+}
+
+disa_cache::disa_cache(const std::size_t capacity, const disa_decoder& decoder)
+	: nsets(SHARDS)
+	, epoch(0)
+	, decoder(decoder)
+{
+	while (nsets * WAYS < capacity)
+	{
+		nsets *= 2;
+	}
+
+	slots.reset(new slot[nsets * WAYS]);
+	hands.reset(new std::uint8_t[nsets]());
+	shards.reset(new shard[SHARDS]);
+
+	for (std::size_t i = 0; i < nsets * WAYS; i++)
+	{
+		slot& s = slots[i];
+		s.sequence.store(0, std::memory_order_relaxed);
+		s.referenced.store(0, std::memory_order_relaxed);
+		s.address.store(0, std::memory_order_relaxed);
+
+		for (auto& word : s.words)
+		{
+			word.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	for (std::size_t i = 0; i < SHARDS; i++)
+	{
+		shards[i].hits.store(0, std::memory_order_relaxed);
+		shards[i].misses.store(0, std::memory_order_relaxed);
+		shards[i].evictions.store(0, std::memory_order_relaxed);
+		shards[i].invalidations.store(0, std::memory_order_relaxed);
+	}
+
+	std::lock_guard<std::mutex> guard(registry_lock());
+	registry().push_back(this);
+}
+
+disa_cache::~disa_cache()
+{
+	std::lock_guard<std::mutex> guard(registry_lock());
+	auto& caches = registry();
+
+	for (std::size_t i = 0; i < caches.size(); i++)
+	{
+		if (caches[i] == this)
+		{
+			caches.erase(caches.begin() + i);
+			break;
+		}
+	}
+}
+
+std::size_t disa_cache::set_of(const std::uintptr_t address) const
+{
+	// (Fibonacci hashing, so nearby addresses land in different sets)
+	return static_cast<std::size_t>((static_cast<std::uint64_t>(address) * 0x9E3779B97F4A7C15ull) >> 32) & (nsets - 1);
+}
+
+// Writes a record into a slot (or empties it, if `record` is null).
+// The shard has to be locked
+void disa_cache::write_slot(slot& s, const std::uintptr_t address, const disa_record* record)
+{
+	const std::uint32_t sequence = s.sequence.load(std::memory_order_relaxed);
+
+	s.sequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	s.address.store(record ? address : 0, std::memory_order_relaxed);
+	s.referenced.store(0, std::memory_order_relaxed);
+
+	if (record)
+	{
+		std::uint64_t words[WORDS] = { 0 };
+		std::memcpy(words, record, sizeof(disa_record));
+
+		for (std::size_t i = 0; i < WORDS; i++)
+		{
+			s.words[i].store(words[i], std::memory_order_relaxed);
+		}
+	}
+
+	s.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool disa_cache::find(const std::uintptr_t address, disa_record& record) const
+{
+	slot* const set = &slots[set_of(address) * WAYS];
+
+	for (std::size_t way = 0; way < WAYS; way++)
+	{
+		slot& s = set[way];
+
+		for (;;)
+		{
+			const std::uint32_t before = s.sequence.load(std::memory_order_acquire);
+
+			if (before & 1)
+			{
+				continue; // being written
+			}
+
+			if (s.address.load(std::memory_order_relaxed) != address)
+			{
+				break;
+			}
+
+			std::uint64_t words[WORDS];
+
+			for (std::size_t i = 0; i < WORDS; i++)
+			{
+				words[i] = s.words[i].load(std::memory_order_relaxed);
+			}
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			if (s.sequence.load(std::memory_order_relaxed) == before)
+			{
+				std::memcpy(&record, words, sizeof(disa_record));
+				s.referenced.store(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void disa_cache::insert(const std::uintptr_t address, const disa_record& record, const std::uint64_t seen_epoch)
+{
+	const std::size_t set = set_of(address);
+	slot* const ways = &slots[set * WAYS];
+	shard& sh = shard_of(set);
+
+	std::lock_guard<std::mutex> guard(sh.lock);
+
+	// memory may have changed while the record was being decoded
+	if (epoch.load(std::memory_order_acquire) != seen_epoch)
+	{
+		return;
+	}
+
+	std::size_t victim = WAYS;
+
+	for (std::size_t way = 0; way < WAYS; way++)
+	{
+		const std::uintptr_t at = ways[way].address.load(std::memory_order_relaxed);
+
+		if (at == address)
+		{
+			return; // another thread got there first
+		}
+
+		if (at == 0 && victim == WAYS)
+		{
+			victim = way;
+		}
+	}
+
+	if (victim == WAYS)
+	{
+		// CLOCK: the first slot that wasn't hit since the hand last passed it
+		std::uint8_t& hand = hands[set];
+
+		while (ways[hand].referenced.load(std::memory_order_relaxed))
+		{
+			ways[hand].referenced.store(0, std::memory_order_relaxed);
+			hand = (hand + 1) % WAYS;
+		}
+
+		victim = hand;
+		hand = (hand + 1) % WAYS;
+		sh.evictions.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	write_slot(ways[victim], address, &record);
+}
+
+// Empties the slots of a set whose instruction overlaps [first, last)
+void disa_cache::drop(const std::size_t set, const std::uintptr_t first, const std::uintptr_t last)
+{
+	slot* const ways = &slots[set * WAYS];
+	shard& sh = shard_of(set);
+
+	std::lock_guard<std::mutex> guard(sh.lock);
+
+	for (std::size_t way = 0; way < WAYS; way++)
+	{
+		slot& s = ways[way];
+		const std::uintptr_t at = s.address.load(std::memory_order_relaxed);
+
+		if (at == 0 || at >= last || at + DISA_CACHE_MAX_LENGTH <= first)
+		{
+			continue;
+		}
+
+		std::uint64_t words[WORDS];
+
+		for (std::size_t i = 0; i < WORDS; i++)
+		{
+			words[i] = s.words[i].load(std::memory_order_relaxed);
+		}
+
+		disa_record record;
+		std::memcpy(&record, words, sizeof(disa_record));
+
+		if (at + record.len > first)
+		{
+			write_slot(s, 0, nullptr);
+			sh.invalidations.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+disa_record disa_cache::read(const std::uintptr_t address)
+{
+	disa_record record;
+	shard& sh = shard_of(set_of(address));
+
+	if (find(address, record))
+	{
+		sh.hits.fetch_add(1, std::memory_order_relaxed);
+		return record;
+	}
+
+	sh.misses.fetch_add(1, std::memory_order_relaxed);
+
+	const std::uint64_t seen_epoch = epoch.load(std::memory_order_acquire);
+	decoder.decode(reinterpret_cast<const std::uint8_t*>(address), sizeof(disa_inst::bytes), address, record);
+
+	insert(address, record, seen_epoch);
+	return record;
+}
+
+bool disa_cache::lookup(const std::uintptr_t address, disa_record& record) const
+{
+	shard& sh = shard_of(set_of(address));
+
+	if (find(address, record))
+	{
+		sh.hits.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	sh.misses.fetch_add(1, std::memory_order_relaxed);
+	return false;
+}
+
+void disa_cache::invalidate(const std::uintptr_t from, const std::uintptr_t to)
+{
+	// (first, so a record decoded before the change can't be put in after it's dropped)
+	epoch.fetch_add(1, std::memory_order_acq_rel);
+
+	const std::uintptr_t first = from > DISA_CACHE_MAX_LENGTH ? from - DISA_CACHE_MAX_LENGTH + 1 : 0;
+
+	if (to - first <= DISA_CACHE_PROBE_RANGE)
+	{
+		for (std::uintptr_t at = first; at < to; at++)
+		{
+			drop(set_of(at), from, to);
+		}
+	}
+	else
+	{
+		for (std::size_t set = 0; set < nsets; set++)
+		{
+			drop(set, from, to);
+		}
+	}
+}
+
+void disa_cache::clear()
+{
+	invalidate(0, ~std::uintptr_t(0));
+}
+
+void disa_cache::invalidate_all(const std::uintptr_t from, const std::uintptr_t to)
+{
+	std::lock_guard<std::mutex> guard(registry_lock());
+
+	for (const auto cache : registry())
+	{
+		cache->invalidate(from, to);
+	}
+}
+
+disa_cache_stats disa_cache::get_stats() const
+{
+	disa_cache_stats stats;
+
+	for (std::size_t i = 0; i < SHARDS; i++)
+	{
+		stats.hits += shards[i].hits.load(std::memory_order_relaxed);
+		stats.misses += shards[i].misses.load(std::memory_order_relaxed);
+		stats.evictions += shards[i].evictions.load(std::memory_order_relaxed);
+		stats.invalidations += shards[i].invalidations.load(std::memory_order_relaxed);
+	}
+
+	return stats;
+}
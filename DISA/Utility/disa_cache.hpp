@@ -0,0 +1,91 @@
+#pragma once
+#include "../disa.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+struct disa_cache_stats
+{
+	std::uint64_t hits = 0;
+	std::uint64_t misses = 0;
+	std::uint64_t evictions = 0; // a record was replaced to make room
+	std::uint64_t invalidations = 0; // a record was dropped by invalidate()
+};
+
+// Cache of decoded instructions in the current process, keyed by address.
+// Meant for the addresses that get decoded over and over (hook sites,
+// prologues, whatever a UI keeps refreshing).
+//
+// The records live in a fixed number of slots, in sets of 8; an address
+// can only go in the slots of one set, and the set picks what to evict
+// with the CLOCK algorithm (slots that were hit since the hand last
+// passed get a second chance). Reading never takes a lock: every slot has
+// a sequence number that's odd while it's being written, and a read that
+// saw it change tries again. Writing locks one of 16 shards.
+//
+// The cache can't see memory change by itself: call invalidate() after
+// writing to code. The easy_hooks functions and disa_debug do that for
+// every live cache. Safe to use from any number of threads.
+class disa_cache
+{
+private:
+	static constexpr std::size_t WAYS = 8;
+	static constexpr std::size_t SHARDS = 16;
+	// rounded up: disa_record is 60 bytes where uintptr_t is 4
+	static constexpr std::size_t WORDS = (sizeof(disa_record) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+	static_assert(sizeof(disa_record) <= WORDS * sizeof(std::uint64_t), "a slot should hold a whole disa_record");
+
+	struct slot
+	{
+		std::atomic<std::uint32_t> sequence; // odd while being written
+		std::atomic<std::uint8_t> referenced; // for CLOCK: hit since the hand last passed
+		std::atomic<std::uintptr_t> address; // 0: empty
+		std::atomic<std::uint64_t> words[WORDS]; // the disa_record
+	};
+
+	struct alignas(64) shard
+	{
+		std::mutex lock; // for writers
+		std::atomic<std::uint64_t> hits;
+		std::atomic<std::uint64_t> misses;
+		std::atomic<std::uint64_t> evictions;
+		std::atomic<std::uint64_t> invalidations;
+	};
+
+	std::size_t nsets;
+	std::unique_ptr<slot[]> slots;
+	std::unique_ptr<std::uint8_t[]> hands; // CLOCK hand of every set
+	std::unique_ptr<shard[]> shards;
+	std::atomic<std::uint64_t> epoch; // bumped by every invalidate
+	disa_decoder decoder;
+
+	std::size_t set_of(const std::uintptr_t address) const;
+	shard& shard_of(const std::size_t set) const { return shards[set % SHARDS]; }
+
+	bool find(const std::uintptr_t address, disa_record& record) const;
+	void insert(const std::uintptr_t address, const disa_record& record, const std::uint64_t seen_epoch);
+	void drop(const std::size_t set, const std::uintptr_t first, const std::uintptr_t last);
+	static void write_slot(slot& s, const std::uintptr_t address, const disa_record* record);
+public:
+	// Room for about `capacity` records (rounded up to a power of 2, ~80 bytes each)
+	explicit disa_cache(const std::size_t capacity = 1 << 16, const disa_decoder& decoder = disa_decoder());
+	~disa_cache();
+
+	disa_cache(const disa_cache&) = delete;
+	disa_cache& operator=(const disa_cache&) = delete;
+
+	// The instruction at `address` in the current process, decoded if it isn't cached
+	disa_record read(const std::uintptr_t address);
+
+	// Only what's cached; false on a miss
+	bool lookup(const std::uintptr_t address, disa_record& record) const;
+
+	// Forgets every instruction that overlaps [from, to)
+	void invalidate(const std::uintptr_t from, const std::uintptr_t to);
+	void clear();
+
+	// invalidate() on every live cache (for code that writes to code)
+	static void invalidate_all(const std::uintptr_t from, const std::uintptr_t to);
+
+	disa_cache_stats get_stats() const;
+};
@@ -3,6 +3,7 @@
 #include <thread>
 #include "disa_debug.hpp"
 #include "easy_hooks.hpp"
+#include "disa_cache.hpp"
 
 using Clock = std::chrono::high_resolution_clock;
 
@@ -177,6 +178,14 @@ bool disa_debug::start(const bool suspend)
 
 	old_bytes = place_trampoline(address, current_hook, current_hook + size, true);
 
+	if (old_bytes.empty())
+	{
+		// there's no way to tell where the instructions at `address` end
+		VirtualFree(hook, 0, MEM_RELEASE);
+		current_hook = 0;
+		return false;
+	}
+
 	if (suspend)
 	{
 		const auto tick_start = Clock::now();
@@ -256,6 +265,7 @@ void disa_debug::stop(void)
 		VirtualProtect(reinterpret_cast<void*>(address), old_bytes.size(), PAGE_EXECUTE_READWRITE, &old);
 		std::memcpy(reinterpret_cast<void*>(address), old_bytes.data(), old_bytes.size());
 		VirtualProtect(reinterpret_cast<void*>(address), old_bytes.size(), old, &old);
+		disa_cache::invalidate_all(address, address + old_bytes.size());
 
 		VirtualFree(reinterpret_cast<void*>(current_hook), 0, MEM_RELEASE);
 	}
@@ -1,16 +1,41 @@
 #include "easy_hooks.hpp"
+#include "disa_cache.hpp"
 #include <Windows.h>
 
-std::vector<std::uint8_t> place_hook(const std::uintptr_t address_from, const std::uintptr_t address_to)
+// Number of bytes taken up by the whole instructions
+// that a 5-byte jmp at `address` would overwrite.
+// 0 if one of them can't be decoded
+static std::size_t hook_size(const std::uintptr_t address)
 {
-	std::vector<std::uint8_t>old_bytes = {};
-
 	std::size_t size = 0;
+
 	while (size < 5)
 	{
-		size += disa_read(address_from + size).front().len; // calculate number of nops
+		const std::size_t len = disa_length(reinterpret_cast<const std::uint8_t*>(address + size), 15);
+
+		if (len == 0)
+		{
+			return 0;
+		}
+
+		size += len;
 	}
 
+	return size;
+}
+
+std::vector<std::uint8_t> place_hook(const std::uintptr_t address_from, const std::uintptr_t address_to)
+{
+	const std::size_t size = hook_size(address_from); // calculate number of nops
+
+	if (size == 0)
+	{
+		return {};
+	}
+
+	std::vector<std::uint8_t>old_bytes;
+	old_bytes.resize(size);
+
 	std::memcpy(old_bytes.data(), reinterpret_cast<void*>(address_from), size);
 
 
@@ -27,17 +52,18 @@ std::vector<std::uint8_t> place_hook(const std::uintptr_t address_from, const st
 
 	VirtualProtect(reinterpret_cast<void*>(address_from), size, old, &old);
 
+	disa_cache::invalidate_all(address_from, address_from + size);
 
 	return old_bytes;
 }
 
 std::vector<std::uint8_t> place_trampoline(const std::uintptr_t address_from, const std::uintptr_t address_to, std::uintptr_t location_jmpback, const bool copy_old_bytes)
 {
-	std::size_t size = 0;
+	const std::size_t size = hook_size(address_from);
 
-	while (size < 5)
+	if (size == 0)
 	{
-		size += disa_read(address_from + size).front().len;
+		return {};
 	}
 
 	std::vector<std::uint8_t>old_bytes;
@@ -58,6 +84,8 @@ std::vector<std::uint8_t> place_trampoline(const std::uintptr_t address_from, co
 	*reinterpret_cast<std::uint8_t*>(location_jmpback) = 0xE9;
 	*reinterpret_cast<std::uint32_t*>(location_jmpback + 1) = (address_from - location_jmpback);
 
+	disa_cache::invalidate_all(location_jmpback - (copy_old_bytes ? size : 0), location_jmpback + 5);
+
 	DWORD old;
 	VirtualProtect(reinterpret_cast<void*>(address_from), size, PAGE_EXECUTE_READWRITE, &old);
 
@@ -72,6 +100,7 @@ std::vector<std::uint8_t> place_trampoline(const std::uintptr_t address_from, co
 
 	VirtualProtect(reinterpret_cast<void*>(address_from), size, old, &old);
 
+	disa_cache::invalidate_all(address_from, address_from + size);
 
 	return old_bytes;
 }
@@ -1,4 +1,6 @@
 #include "../disa.hpp"
 
+// Both return the bytes that were overwritten at `address_from`,
+// or nothing if the instructions there couldn't be decoded
 std::vector<std::uint8_t> place_trampoline(const std::uintptr_t address_from, const std::uintptr_t address_to, std::uintptr_t location_jmpback, const bool copy_old_bytes = false);
 std::vector<std::uint8_t> place_hook(const std::uintptr_t address_from, const std::uintptr_t address_to);
@@ -1,8 +1,11 @@
 #include "disa.hpp"
-#include <sstream>
-#include <iomanip>
+#include "disa_stats.hpp"
+#include <cstring>
+#include <climits>
+#include <array>
+#include <initializer_list>
 
-const enum disa_optypes : std::uint8_t
+enum disa_optypes : std::uint8_t
 {
 	AL,
 	AH,
@@ -99,940 +102,1254 @@ const enum disa_optypes : std::uint8_t
 };
 
 
-static std::vector<disa_opinfo> disa_optable = { };
+// Operand types of a table row, stored inline
+struct disa_opoperands
+{
+	std::uint8_t count;
+	std::uint8_t types[4];
+
+	constexpr disa_opoperands() : count(0), types{ 0 }
+	{
+	}
+
+	constexpr disa_opoperands(const std::initializer_list<std::uint8_t> list) : count(0), types{ 0 }
+	{
+		for (const auto type : list)
+		{
+			types[count++] = type;
+		}
+	}
+};
+
+constexpr std::uint8_t disa_hex(const char c)
+{
+	return static_cast<std::uint8_t>((c >= 'A') ? (c - 'A' + 10) : (c - '0'));
+}
+
+// A row of the opcode table.
+// `code` is parsed at compile time, so the table is plain
+// constant data and needs no initialization at runtime.
+struct disa_optable_entry
+{
+	const char* code;
+	const char* opcode_name;
+	disa_opoperands operands;
+	const char* description;
+
+	std::uint8_t bytes[4]; // opcode bytes in `code`
+	std::uint8_t nbytes;
+	char group; // 'r' (opcode byte determines the register), 'm' (ModRM.reg determines the opcode) or 0
+	std::uint8_t group_reg; // N in "+mN"
+
+	constexpr disa_optable_entry(const char* code, const char* opcode_name, const disa_opoperands operands, const char* description)
+		: code(code)
+		, opcode_name(opcode_name)
+		, operands(operands)
+		, description(description)
+		, bytes{ 0 }
+		, nbytes(0)
+		, group(0)
+		, group_reg(0)
+	{
+		// code may look like: "0F+C8+r", "83+m0", "66+0F+38+00"
+		for (std::size_t i = 0; code[i] != '\0'; i += 3)
+		{
+			if (code[i] == 'r' || code[i] == 'm')
+			{
+				group = code[i];
+				group_reg = (group == 'm') ? disa_hex(code[i + 1]) : 0;
+				break;
+			}
+
+			bytes[nbytes++] = (disa_hex(code[i]) << 4) | disa_hex(code[i + 1]);
+
+			if (code[i + 2] == '\0')
+			{
+				break;
+			}
+		}
+	}
+};
 
 // it was either: parse everything into this table from an external file
 // or, blow up your executable with ~20mb of assembly code
 // by hard-coding the opcode information...
 //Sorry guys.. I went with the latter
+static constexpr disa_optable_entry disa_optable[] =
+{
+	{ "00", "add", { r_m8, r8 },					"Add" },
+	{ "01", "add", { r_m16_32, r16_32 },			"Add" },
+	{ "02", "add", { r8, r_m8 },					"Add" },
+	{ "03", "add", { r16_32, r_m16_32 },			"Add" },
+	{ "04", "add", { AL, imm8 },					"Add" },
+	{ "05", "add", { EAX, imm16_32 },				"Add" },
+	{ "06", "push", { ES },							"Push Extra Segment onto the stack" },
+	{ "07", "pop", { ES },							"Pop Extra Segment off of the stack" },
+	{ "08", "or", { r_m8, r8 },						"Logical Inclusive OR" },
+	{ "09", "or", { r_m16_32, r16_32 },				"Logical Inclusive OR" },
+	{ "0A", "or", { r8, r_m8 },						"Logical Inclusive OR" },
+	{ "0B", "or", { r16_32, r_m16_32 },				"Logical Inclusive OR" },
+	{ "0C", "or", { AL, imm8 },						"Logical Inclusive OR" },
+	{ "0D", "or", { EAX, imm16_32 },				"Logical Inclusive OR" },
+	{ "0E", "push", { CS },							"Push Code Segment onto the stack" },
+	{ "0F+00+m0", "sldt", { r_m16_32 },				"Store Local Descriptor Table Register" },
+	{ "0F+00+m1", "str", { r_m16 },					"Store Task Register" },
+	{ "0F+00+m2", "lldt", { r_m16 },				"Load Local Descriptor Table Register" },
+	{ "0F+00+m3", "ltr", { r_m16 },					"Load Task Register" },
+	{ "0F+00+m4", "verr", { r_m16 },				"Verify a Segment for Reading" },
+	{ "0F+00+m5", "verw", { r_m16 },				"Verify a Segment for Writing" },
+	{ "0F+01+C1", "vmcall", {  },					"Call to VM Monitor" },
+	{ "0F+01+C2", "vmlaunch", {  },					"Launch Virtual Machine" },
+	{ "0F+01+C3", "vmresume", {  },					"Resume Virtual Machine" },
+	{ "0F+01+C4", "vmxoff", {  },					"Leave VMX Operation" },
+	{ "0F+01+C8", "monitor", {  },					"Set Up Monitor Address" },
+	{ "0F+01+C9", "mwait", {  },					"Monitor Wait" },
+	{ "0F+01+CA", "clac", {  },						"Clear AC flag in EFLAGS register" },
+	{ "0F+01+m0", "sgdt", { r_m16_32 },				"Store Global Descriptor Table Register" },
+	{ "0F+01+m1", "sidt", { r_m16_32 },				"Store Interrupt Descriptor Table Register" },
+	{ "0F+01+m2", "lgdt", { r_m16_32 },				"Load Global Descriptor Table Register" },
+	{ "0F+01+m3", "lidt", { r_m16_32 },				"Load Interrupt Descriptor Table Register" },
+	{ "0F+01+m4", "smsw", { r_m16_32 },				"Store Machine Status Word" },
+	{ "0F+01+m5", "smsw", { r_m16_32 },				"Store Machine Status Word" },
+	{ "0F+01+m6", "lmsw", { r_m16_32 },				"Load Machine Status Word" },
+	{ "0F+01+m7", "invplg", { r_m16_32 },			"Invalidate TLB Entry" },
+	{ "0F+02", "lar", { r16_32, m16 },				"Load Access Rights Byte" }, // possibly m8 or m16_32 ..
+	{ "0F+03", "lsl", { r16_32, m16 },				"Load Segment Limit" },  // possibly m8 or m16_32 ..
+	{ "0F+04", "ud", {  },							"Undefined Instruction" },
+	{ "0F+05", "syscall", {  },						"Fast System Call" },
+	{ "0F+06", "clts", { CR0 },						"Clear Task-Switched Flag in CR0" },
+	{ "0F+07", "sysret", {  },						"Return form fast system call" },
+	{ "0F+08", "invd", {  },						"Invalidate Internal Caches" },
+	{ "0F+09", "wbinvd", {  },						"Write Back and Invalidate Cache" },
+	{ "0F+0B", "ud2", {  },							"Undefined Instruction" },
+	{ "0F+0D", "nop", { r_m16_32 },					"No Operation" },
+	{ "0F+10", "movups", { xmm, xmm_m128 },			"Move Unaligned Packed Single-FP Values" },
+	{ "F3+0F+10", "movss", { xmm, xmm_m32 },		"Move Scalar Single-FP Values" },
+	{ "66+0F+10", "movupd", { xmm, xmm_m128 },		"Move Unaligned Packed Double-FP Value" },
+	{ "F2+0F+10", "movsd", { xmm, xmm_m64 },		"Move Scalar Double-FP Value" },
+	{ "0F+11", "movups", { xmm_m128, xmm },			"Move Unaligned Packed Single-FP Values" },
+	{ "F3+0F+11", "movss", { xmm_m32, xmm },		"Move Scalar Single-FP Values" },
+	{ "66+0F+11", "movupd", { xmm_m128, xmm },		"Move Unaligned Packed Double-FP Value" },
+	{ "F2+0F+11", "movsd", { xmm_m64, xmm },		"Move Scalar Double-FP Value" },
+	{ "0F+12", "movhlps", { xmm, xmm },				"Move Packed Single-FP Values High to Low" },
+	{ "0F+12", "movlps", { xmm, m64 },				"Move Low Packed Single-FP Values" },
+	{ "F3+0F+12", "movlpd", { xmm, m64 },			"Move Low Packed Double-FP Value" },
+	{ "66+0F+12", "movddup", { xmm, xmm_m64 },		"Move One Double-FP and Duplicate" },
+	{ "F2+0F+12", "movsldup", { xmm, xmm_m64 },		"Move Packed Single-FP Low and Duplicate" },
+	{ "0F+13", "movlps", { m64, xmm },				"Move Low Packed Single-FP Values" },
+	{ "66+0F+13", "movlpd", { m64, xmm },			"Move Low Packed Double-FP Value" },
+	{ "0F+14", "unpcklps", { xmm, xmm_m64 },		"Unpack and Interleave Low Packed Single-FP Values" },
+	{ "66+0F+14", "unpcklpd", { xmm, xmm_m128 },	"Unpack and Interleave Low Packed Double-FP Values" },
+	{ "0F+15", "unpckhps", { xmm, xmm_m64 },		"Unpack and Interleave High Packed Single-FP Values" },
+	{ "66+0F+15", "unpckhpd", { xmm, xmm_m128 },	"Unpack and Interleave High Packed Double-FP Values" },
+	{ "0F+16", "movlhps", { xmm, xmm },				"Move Packed Single-FP Values Low to High" },
+	{ "0F+16", "movhps", { xmm, m64 },				"Move High Packed Single-FP Values" },
+	{ "66+0F+16", "movhpd", { xmm, m64 },			"Move High Packed Double-FP Value" },
+	{ "F3+0F+16", "movshdup", { xmm, xmm_m64 },		"Move Packed Single-FP High and Duplicate" },
+	{ "0F+17", "movhps", { m64, xmm },				"Move High Packed Single-FP Values" },
+	{ "66+0F+17", "movhpd", { m64, xmm },			"Move High Packed Double-FP Value" },
+	{ "0F+18+m0", "prefetchnta", { m8 },			"Prefetch Data Into Caches" },
+	{ "0F+18+m1", "prefetcht0", { m8 },				"Prefetch Data Into Caches" },
+	{ "0F+18+m2", "prefetcht1", { m8 },				"Prefetch Data Into Caches" },
+	{ "0F+18+m3", "prefetcht2", { m8 },				"Prefetch Data Into Caches" },
+	{ "0F+18+m4", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+18+m5", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+18+m6", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+18+m7", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+19", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+1A", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+1B", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+1C", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+1D", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+1E", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+1F+m0", "nop", { r_m16_32 },				"No Operation" },
+	{ "0F+1F+m1", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+1F+m2", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+1F+m3", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+1F+m4", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+1F+m5", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+1F+m6", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+1F+m7", "hint_nop", { r_m16_32 },			"Hintable NOP" },
+	{ "0F+20", "mov", { r_m32, CRn },				"Move to/from Control Registers" },
+	{ "0F+21", "mov", { r_m32, DRn },				"Move to/from Debug Registers" },
+	{ "0F+22", "mov", { CRn, r_m32 },				"Move to/from Control Registers" },
+	{ "0F+23", "mov", { DRn, r_m32,  },				"Move to/from Debug Registers" },
+	{ "0F+28", "movaps", { xmm, xmm_m128,  },		"Move Aligned Packed Single-FP Values" },
+	{ "66+0F+28", "movapd", { xmm, xmm_m128,  },	"Move Aligned Packed Double-FP Values" },
+	{ "0F+29", "movaps", { xmm_m128, xmm,  },		"Move Aligned Packed Single-FP Values" },
+	{ "66+0F+29", "movapd", { xmm_m128, xmm,  },	"Move Aligned Packed Double-FP Values" },
+	{ "0F+2A", "cvtpi2ps", { xmm, mm_m64 },			"Convert Packed DW Integers to Single-FP Values" },
+	{ "F3+0F+2A", "cvtpi2ss", { xmm, r_m32 },		"Convert DW Integer to Scalar Single-FP Value" },
+	{ "66+0F+2A", "cvtpi2pd", { xmm, mm_m64 },		"Convert Packed DW Integers to Double-FP Values" },
+	{ "F2+0F+2A", "cvtpi2sd", { xmm, r_m32 },		"Convert DW Integer to Scalar Double-FP Value" },
+	{ "0F+2B", "movntps", { m128, xmm },			"Store Packed Single-FP Values Using Non-Temporal Hint" },
+	{ "66+0F+2B", "movntpd", { m128, xmm },			"Store Packed Double-FP Values Using Non-Temporal Hint" },
+	{ "0F+2C", "cvttps2pi", { mm, xmm_m64 },		"Convert with Trunc. Packed Single-FP Values to DW Integers" },
+	{ "F3+0F+2C", "cvttss2si", { r32, xmm_m32 },	"Convert with Trunc. Scalar Single-FP Value to DW Integer" },
+	{ "66+0F+2C", "cvttpd2pi", { mm, xmm_m128 },	"Convert with Trunc. Packed Double-FP Values to DW Integers" },
+	{ "F2+0F+2C", "cvttsd2si", { r32, xmm_m64 },	"Convert with Trunc. Scalar Double-FP Value to Signed DW Int" },
+	{ "0F+2D", "cvtps2pi", { mm, xmm_m64 },			"Convert Packed Single-FP Values to DW Integers" },
+	{ "F3+0F+2D", "cvtss2si", { r32, xmm_m32 },		"Convert Scalar Single-FP Value to DW Integer" },
+	{ "66+0F+2D", "cvtpd2pi", { mm, xmm_m128 },		"Convert Packed Double-FP Values to DW Integers" },
+	{ "F2+0F+2D", "cvtsd2si", { r32, xmm_m64 },		"Convert Scalar Double-FP Value to DW Integer" },
+	{ "0F+2E", "ucomiss", { xmm, xmm_m32 },			"Unordered Compare Scalar Ordered Single-FP Values and Set EFLAGS" },
+	{ "66+0F+2E", "ucomisd", { xmm, xmm_m64 },		"Unordered Compare Scalar Ordered Double-FP Values and Set EFLAGS" },
+	{ "0F+2F", "comiss", { xmm, xmm_m32 },			"Compare Scalar Ordered Single-FP Values and Set EFLAGS" },
+	{ "66+0F+2F", "comisd", { xmm, xmm_m64 },		"Compare Scalar Ordered Double-FP Values and Set EFLAGS" },
+	{ "0F+30", "wrmsr", {  },						"Write to Model Specific Register" },
+	{ "0F+31", "rdtsc", {  },						"Read Time-Stamp Counter" },
+	{ "0F+32", "rdmsr", {  },						"Read from Model Specific Register" },
+	{ "0F+33", "rdpmc", {  },						"Read Performance-Monitoring Counters" },
+	{ "0F+34", "sysenter", {  },					"Fast System Call" },
+	{ "0F+35", "sysexit", {  },						"Fast Return from Fast System Call" },
+	{ "0F+37", "getsec", {  },						"GETSEC Leaf Functions" },
+	{ "0F+38+00", "pshufb", { mm, mm_m64 },			"Packed Shuffle Bytes" },
+	{ "66+0F+38+00", "pshufb", { xmm, xmm_m128 },	"Packed Shuffle Bytes" },
+	{ "0F+38+01", "phaddw", { mm, mm_m64 },			"Packed Horizontal Add" },
+	{ "66+0F+38+01", "phaddw", { xmm, xmm_m128 },	"Packed Horizontal Add" },
+	{ "0F+38+02", "phaddd", { mm, mm_m64 },			"Packed Horizontal Add" },
+	{ "66+0F+38+02", "phaddd", { xmm, xmm_m128 },	"Packed Horizontal Add" },
+	{ "0F+38+03", "phaddsw", { mm, mm_m64 },		"Packed Horizontal Add and Saturate" },
+	{ "66+0F+38+03", "phaddsw", { xmm, xmm_m128 },	"Packed Horizontal Add and Saturate" },
+	{ "0F+38+04", "pmaddubsw", { mm, mm_m64 },		"Multiply and Add Packed Signed and Unsigned Bytes" },
+	{ "66+0F+38+04", "pmaddubsw", { xmm, xmm_m128 },"Multiply and Add Packed Signed and Unsigned Bytes" },
+	{ "0F+38+05", "phsubw", { mm, mm_m64 },			"Packed Horizontal Subtract" },
+	{ "66+0F+38+05", "phsubw", { xmm, xmm_m128 },	"Packed Horizontal Subtract" },
+	{ "0F+38+06", "phsubd", { mm, mm_m64 },			"Packed Horizontal Subtract" },
+	{ "66+0F+38+06", "phsubd", { xmm, xmm_m128 },	"Packed Horizontal Subtract" },
+	{ "0F+38+07", "phsubsw", { mm, mm_m64 },		"Packed Horizontal Subtract and Saturate" },
+	{ "66+0F+38+07", "phsubsw", { xmm, xmm_m128 },	"Packed Horizontal Subtract and Saturate" },
+	{ "0F+38+08", "psignb", { mm, mm_m64 },			"Packed SIGN" },
+	{ "66+0F+38+08", "psignb", { xmm, xmm_m128 },	"Packed SIGN" },
+	{ "0F+38+09", "psignw", { mm, mm_m64 },			"Packed SIGN" },
+	{ "66+0F+38+09", "psignw", { xmm, xmm_m128 },	"Packed SIGN" },
+	{ "0F+38+0A", "psignd", { mm, mm_m64 },			"Packed SIGN" },
+	{ "66+0F+38+0A", "psignd", { xmm, xmm_m128 },	"Packed SIGN" },
+	{ "0F+38+0B", "pmulhrsw", { mm, mm_m64 },		"Packed Multiply High with Round and Scale" },
+	{ "66+0F+38+0B", "pmulhrsw", { xmm, xmm_m128 },	"Packed Multiply High with Round and Scale" },
+	{ "66+0F+38+10", "pblendvb",{xmm,xmm_m128,xmm0},"Variable Blend Packed Bytes" },
+	{ "66+0F+38+14", "blendvps",{xmm,xmm_m128,xmm0},"Variable Blend Packed Single-FP Values" },
+	{ "66+0F+38+15", "blendvpd",{xmm,xmm_m128,xmm0},"Variable Blend Packed Double-FP Values" },
+	{ "66+0F+38+17", "ptest",{ xmm, xmm_m128 },		"Logical Compare" },
+	{ "0F+38+1C", "pabsb", { mm, mm_m64 },			"Packed Absolute Value" },
+	{ "66+0F+38+1C", "pabsb", { xmm, xmm_m128 },	"Packed Absolute Value" },
+	{ "0F+38+1D", "pabsw", { mm, mm_m64 },			"Packed Absolute Value" },
+	{ "66+0F+38+1D", "pabsw", { xmm, xmm_m128 },	"Packed Absolute Value" },
+	{ "0F+38+1E", "pabsd", { mm, mm_m64 },			"Packed Absolute Value" },
+	{ "66+0F+38+1E", "pabsd", { xmm, xmm_m128 },	"Packed Absolute Value" },
+	{ "66+0F+38+20", "pmovsxbw", { xmm, m64 },		"Packed Move with Sign Extend" },
+	{ "66+0F+38+21", "pmovsxbd", { xmm, m32 },		"Packed Move with Sign Extend" },
+	{ "66+0F+38+22", "pmovsxbq", { xmm, m16 },		"Packed Move with Sign Extend" },
+	{ "66+0F+38+23", "pmovsxbd", { xmm, m64 },		"Packed Move with Sign Extend" },
+	{ "66+0F+38+24", "pmovsxbq", { xmm, m32 },		"Packed Move with Sign Extend" },
+	{ "66+0F+38+25", "pmovsxdq", { xmm, m64 },		"Packed Move with Sign Extend" },
+	{ "66+0F+38+28", "pmuldq", { xmm, xmm_m128 },	"Multiply Packed Signed Dword Integers" },
+	{ "66+0F+38+29", "pcmpeqq", { xmm, xmm_m128 },	"Compare Packed Qword Data for Equal" },
+	{ "66+0F+38+2A", "movntdqa", { xmm, m128 },		"Load Double Quadword Non-Temporal Aligned Hint" },
+	{ "66+0F+38+2B", "packusdw", { xmm, xmm_m128 },	"Pack with Unsigned Saturation" },
+	{ "66+0F+38+30", "pmovzxbw", { xmm, m64 },		"Packed Move with Zero Extend" },
+	{ "66+0F+38+31", "pmovzxbd", { xmm, m32 },		"Packed Move with Zero Extend" },
+	{ "66+0F+38+32", "pmovzxbq", { xmm, m16 },		"Packed Move with Zero Extend" },
+	{ "66+0F+38+33", "pmovzxbd", { xmm, m64 },		"Packed Move with Zero Extend" },
+	{ "66+0F+38+34", "pmovzxbq", { xmm, m32 },		"Packed Move with Zero Extend" },
+	{ "66+0F+38+35", "pmovzxbq", { xmm, m64 },		"Packed Move with Zero Extend" },
+	{ "66+0F+38+37", "pcmpgtq", { xmm, xmm_m128 },	"Compare Packed Qword Data for Greater Than" },
+	{ "66+0F+38+38", "pminsb", { xmm, xmm_m128 },	"Minimum of Packed Signed Byte Integers" },
+	{ "66+0F+38+39", "pminsd", { xmm, xmm_m128 },	"Minimum of Packed Signed Dword Integers" },
+	{ "66+0F+38+3A", "pminuw", { xmm, xmm_m128 },	"Minimum of Packed Unsigned Word Integers" },
+	{ "66+0F+38+3B", "pminud", { xmm, xmm_m128 },	"Minimum of Packed Unsigned Dword Integers" },
+	{ "66+0F+38+3C", "pmaxsb", { xmm, xmm_m128 },	"Maximum of Packed Signed Byte Integers" },
+	{ "66+0F+38+3D", "pmaxsd", { xmm, xmm_m128 },	"Maximum of Packed Signed Dword Integers" },
+	{ "66+0F+38+3E", "pmaxuw", { xmm, xmm_m128 },	"Maximum of Packed Unsigned Word Integers" },
+	{ "66+0F+38+3F", "pmaxud", { xmm, xmm_m128 },	"Maximum of Packed Unsigned Dword Integers" },
+	{ "66+0F+38+40", "pmulld", { xmm, xmm_m128 },	"Multiply Packed Signed Dword Integers and Store Low Result" },
+	{ "66+0F+38+41", "phminposuw",{ xmm, xmm_m128 },"Packed Horizontal Word Minimum" },
+	{ "66+0F+38+80", "invept", { r32, m128 },		"Invalidate Translations Derived from EPT" },
+	{ "66+0F+38+81", "invvpid", { r32, m128 },		"Invalidate Translations Based on VPID" },
+	{ "0F+38+F0", "movbe", { r16_32, m16_32 },		"Move Data After Swapping Bytes" },
+	{ "F2+0F+38+F0", "crc32", { r32, r_m8 },		"Accumulate CRC32 Value" },
+	{ "0F+38+F1", "movbe", { m16_32, r16_32 },		"Move Data After Swapping Bytes" },
+	{ "F2+0F+38+F1", "crc32", { r32, r_m16_32 },	"Accumulate CRC32 Value" },
+	{ "66+0F+3A+08","roundps",{ xmm,xmm_m128,imm8 },"Round Packed Single-FP Values" },
+	{ "66+0F+3A+09","roundpd",{ xmm,xmm_m128,imm8 },"Round Packed Double-FP Values" },
+	{ "66+0F+3A+0A", "roundss",{ xmm,xmm_m32,imm8 },"Round Scalar Single-FP Values" },
+	{ "66+0F+3A+0B", "roundsd",{ xmm,xmm_m64,imm8 },"Round Scalar Double-FP Values" },
+	{ "66+0F+3A+0C","blendps",{ xmm,xmm_m128,imm8 },"Round Packed Single-FP Values" },
+	{ "66+0F+3A+0D","blendpd",{ xmm,xmm_m128,imm8 },"Round Packed Double-FP Values" },
+	{ "66+0F+3A+0E","pblendw",{ xmm,xmm_m128,imm8 },"Blend Packed Words" },
+	{ "0F+3A+0F", "palignr", { mm, mm_m64 },		"Packed Align Right" },
+	{ "66+0F+3A+0F", "palignr", { mm, xmm_m128 },	"Packed Align Right" },
+	{ "66+0F+3A+14", "pextrb", { m8, xmm, imm8 },	"Extract Byte" },
+	{ "66+0F+3A+15", "pextrw", { m16, xmm, imm8 },	"Extract Word" },
+	{ "66+0F+3A+16", "pextrd", { m32, xmm, imm8 },	"Extract Dword/Qword" },
+	{ "66+0F+3A+17", "extractps",{ m64, xmm, imm8 },"Extract Packed Single-FP Value" },
+	{ "66+0F+3A+20", "pinsrb", { xmm, m8, imm8 },	"Insert Byte" },
+	{ "66+0F+3A+21", "insertps", { xmm, m32, imm8 },"Insert Packed Single-FP Value" },
+	{ "66+0F+3A+22", "pinsrd", { xmm, m64, imm8 },	"Insert Dword/Qword" },
+	{ "66+0F+3A+40", "dpps", { xmm, xmm_m128 },		"Dot Product of Packed Single-FP Values" },
+	{ "66+0F+3A+41", "dppd", { xmm, xmm_m128 },		"Dot Product of Packed Double-FP Values" },
+	{ "66+0F+3A+42","mpsadbw",{xmm, xmm_m128, imm8},"Compute Multiple Packed Sums of Absolute Difference" },
+	{ "66+0F+3A+60","pcmpestrm",{xmm0,xmm,xmm_m128},"Packed Compare Explicit Length Strings, Return Mask" },
+	{ "66+0F+3A+61","pcmpestri",{ECX,xmm,xmm_m128},	"Packed Compare Explicit Length Strings, Return Index" },
+	{ "66+0F+3A+62","pcmpistrm",{xmm0,xmm,xmm_m128,imm8},"Packed Compare Implicit Length Strings, Return Mask" },
+	{ "66+0F+3A+63","pcmpistri",{ECX,xmm,xmm_m128, imm8},"Packed Compare Implicit Length Strings, Return Index" },
+	{ "0F+40", "cmovo", { r16_32, r_m16_32 },		"Conditional Move - overflow (OF=1)" },
+	{ "0F+41", "cmovno", { r16_32, r_m16_32 },		"Conditional Move - not overflow (OF=0)" },
+	{ "0F+42", "cmovb", { r16_32, r_m16_32 },		"Conditional Move - below/not above or equal/carry (CF=1)" },
+	{ "0F+43", "cmovnb", { r16_32, r_m16_32 },		"Conditional Move - onot below/above or equal/not carry (CF=0)" },
+	{ "0F+44", "cmove", { r16_32, r_m16_32 },		"Conditional Move - zero/equal (ZF=1)" },
+	{ "0F+45", "cmovne", { r16_32, r_m16_32 },		"Conditional Move - not zero/not equal (ZF=0)" },
+	{ "0F+46", "cmovbe", { r16_32, r_m16_32 },		"Conditional Move - below or equal/not above (CF=1 OR ZF=1)" },
+	{ "0F+47", "cmova", { r16_32, r_m16_32 },		"Conditional Move - not below or equal/above (CF=0 AND ZF=0)" },
+	{ "0F+48", "cmovs", { r16_32, r_m16_32 },		"Conditional Move - sign (SF=1)" },
+	{ "0F+49", "cmovns", { r16_32, r_m16_32 },		"Conditional Move - not sign (SF=0)" },
+	{ "0F+4A", "cmovp", { r16_32, r_m16_32 },		"Conditional Move - parity/parity even (PF=1)" },
+	{ "0F+4B", "cmovnp", { r16_32, r_m16_32 },		"Conditional Move - not parity/parity odd (PF=0)" },
+	{ "0F+4C", "cmovl", { r16_32, r_m16_32 },		"Conditional Move - less/not greater (SF!=OF)" },
+	{ "0F+4D", "cmovge", { r16_32, r_m16_32 },		"Conditional Move - not less/greater or equal (SF=OF)" },
+	{ "0F+4E", "cmovng", { r16_32, r_m16_32 },		"Conditional Move - less or equal/not greater ((ZF=1) OR (SF!=OF))" },
+	{ "0F+4F", "cmovg", { r16_32, r_m16_32 },		"Conditional Move - not less nor equal/greater ((ZF=0) AND (SF=OF))" },
+	{ "0F+50", "movmskps", { r32, xmm },			"Extract Packed Single-FP Sign Mask" },
+	{ "66+0F+50", "movmskpd", { r32, xmm },			"Extract Packed Double-FP Sign Mask" },
+	{ "66+0F+50", "movmskpd", { r32, xmm },			"Extract Packed Double-FP Sign Mask" },
+	{ "0F+51", "sqrtps", { xmm, xmm_m128 },			"Compute Square Roots of Packed Single-FP Values" },
+	{ "F3+0F+51", "sqrtss", { xmm, xmm_m32 },		"Compute Square Root of Scalar Single-FP Value" },
+	{ "66+0F+51", "sqrtpd", { xmm, xmm_m128 },		"Compute Square Roots of Packed Double-FP Values" },
+	{ "F2+0F+51", "sqrtsd", { xmm, xmm_m64 },		"Compute Square Root of Scalar Double-FP Value" },
+	{ "0F+52", "rsqrtps", { xmm, xmm_m128 },		"Compute Recipr. of Square Roots of Packed Single-FP Values" },
+	{ "F3+0F+52", "rsqrtss", { xmm, xmm_m32 },		"Compute Recipr. of Square Root of Scalar Single-FP Value" },
+	{ "0F+53", "rcpps", { xmm, xmm_m128 },			"Compute Reciprocals of Packed Single-FP Values" },
+	{ "F3+0F+53", "rcpss", { xmm, xmm_m32 },		"Compute Reciprocal of Scalar Single-FP Values" },
+	{ "0F+54", "andps", { xmm, xmm_m128 },			"Bitwise Logical AND of Packed Single-FP Values" },
+	{ "66+0F+54", "andpd", { xmm, xmm_m128 },		"Bitwise Logical AND of Packed Double-FP Values" },
+	{ "0F+55", "andnps", { xmm, xmm_m128 },			"Bitwise Logical AND NOT of Packed Single-FP Values" },
+	{ "66+0F+55", "andnpd", { xmm, xmm_m128 },		"Bitwise Logical AND NOT of Packed Double-FP Values" },
+	{ "0F+56", "orps", { xmm, xmm_m128 },			"Bitwise Logical OR of Packed Single-FP Values" },
+	{ "66+0F+56", "orpd", { xmm, xmm_m128 },		"Bitwise Logical OR of Packed Double-FP Values" },
+	{ "0F+57", "xorps", { xmm, xmm_m128 },			"Bitwise Logical XOR of Packed Single-FP Values" },
+	{ "66+0F+57", "xorpd", { xmm, xmm_m128 },		"Bitwise Logical XOR of Packed Double-FP Values" },
+	{ "0F+58", "addps", { xmm, xmm_m128 },			"Add Packed Single-FP Values" },
+	{ "F3+0F+58", "addss", { xmm, xmm_m32 },		"Add Scalar Single-FP Values" },
+	{ "66+0F+58", "addpd", { xmm, xmm_m128 },		"Add Packed Double-FP Values" },
+	{ "F2+0F+58", "addsd", { xmm, xmm_m64 },		"Add Scalar Double-FP Values" },
+	{ "0F+59", "mulps", { xmm, xmm_m128 },			"Multiply Packed Single-FP Values" },
+	{ "F3+0F+59", "mulss", { xmm, xmm_m32 },		"Multiply Scalar Single-FP Value" },
+	{ "66+0F+59", "mulpd", { xmm, xmm_m128 },		"Multiply Packed Double-FP Values" },
+	{ "F2+0F+59", "addsd", { xmm, xmm_m64 },		"Multiply Scalar Double-FP Values" },
+	{ "0F+5A", "cvtps2pd", { xmm, xmm_m128 },		"Convert Packed Single-FP Values to Double-FP Values" },
+	{ "F3+0F+5A", "cvtpd2ps", { xmm, xmm_m128 },	"Convert Packed Double-FP Values to Single-FP Values" },
+	{ "66+0F+5A", "cvtss2sd", { xmm, xmm_m32 },		"Convert Scalar Single-FP Value to Scalar Double-FP Value" },
+	{ "F2+0F+5A", "cvtsd2ss", { xmm, xmm_m64 },		"Convert Scalar Double-FP Value to Scalar Single-FP Value" },
+	{ "0F+5B", "cvtdq2ps", { xmm, xmm_m128 },		"Convert Packed DW Integers to Single-FP Values" },
+	{ "66+0F+5B", "cvtps2dq", { xmm, xmm_m128 },	"Convert Packed Single-FP Values to DW Integers" },
+	{ "F3+0F+5B", "cvttps2dq", { xmm, xmm_m128 },	"Convert with Trunc. Packed Single-FP Values to DW Integers" },
+	{ "0F+5C", "subps", { xmm, xmm_m128 },			"Subtract Packed Single-FP Values" },
+	{ "F3+0F+5C", "subss", { xmm, xmm_m32 },		"Subtract Scalar Single-FP Values" },
+	{ "66+0F+5C", "subpd", { xmm, xmm_m128 },		"Subtract Packed Double-FP Values" },
+	{ "F2+0F+5C", "subsd", { xmm, xmm_m64 },		"Subtract Scalar Double-FP Values" },
+	{ "0F+5D", "minps", { xmm, xmm_m128 },			"Return Minimum Packed Single-FP Values" },
+	{ "F3+0F+5D", "minss", { xmm, xmm_m32 },		"Return Minimum Scalar Single-FP Values" },
+	{ "66+0F+5D", "minpd", { xmm, xmm_m128 },		"Return Minimum Packed Double-FP Values" },
+	{ "F2+0F+5D", "minsd", { xmm, xmm_m64 },		"Return Minimum Scalar Double-FP Values" },
+	{ "0F+5E", "divps", { xmm, xmm_m128 },			"Divide Packed Single-FP Values" },
+	{ "F3+0F+5E", "divss", { xmm, xmm_m32 },		"Divide Scalar Single-FP Values" },
+	{ "66+0F+5E", "divpd", { xmm, xmm_m128 },		"Divide Packed Double-FP Values" },
+	{ "F2+0F+5E", "divsd", { xmm, xmm_m64 },		"Divide Scalar Double-FP Values" },
+	{ "0F+5F", "maxps", { xmm, xmm_m128 },			"Return Maximum Packed Single-FP Values" },
+	{ "F3+0F+5F", "maxss", { xmm, xmm_m32 },		"Return Maximum Scalar Single-FP Values" },
+	{ "66+0F+5F", "maxpd", { xmm, xmm_m128 },		"Return Maximum Packed Double-FP Values" },
+	{ "F2+0F+5F", "maxsd", { xmm, xmm_m64 },		"Return Maximum Scalar Double-FP Values" },
+	{ "0F+60", "punpcklbw", { mm, mm_m64 },			"Unpack Low Data" },
+	{ "66+0F+60", "punpcklbw", { xmm, xmm_m128 },	"Unpack Low Data" },
+	{ "0F+61", "punpcklbd", { mm, mm_m64 },			"Unpack Low Data" },
+	{ "66+0F+61", "punpcklbd", { xmm, xmm_m128 },	"Unpack Low Data" },
+	{ "0F+62", "punpcklbq", { mm, mm_m64 },			"Unpack Low Data" },
+	{ "66+0F+62", "punpcklbq", { xmm, xmm_m128 },	"Unpack Low Data" },
+	{ "0F+63", "packsswb", { mm, mm_m64 },			"Pack with Signed Saturation" },
+	{ "66+0F+63", "packsswb", { xmm, xmm_m128 },	"Pack with Signed Saturation" },
+	{ "0F+64", "pcmpgtb", { mm, mm_m64 },			"Compare Packed Signed Integers for Greater Than" },
+	{ "66+0F+64", "pcmpgtb", { xmm, xmm_m128 },		"Compare Packed Signed Integers for Greater Than" },
+	{ "0F+65", "pcmpgtw", { mm, mm_m64 },			"Compare Packed Signed Integers for Greater Than" },
+	{ "66+0F+65", "pcmpgtw", { xmm, xmm_m128 },		"Compare Packed Signed Integers for Greater Than" },
+	{ "0F+66", "pcmpgtd", { mm, mm_m64 },			"Compare Packed Signed Integers for Greater Than" },
+	{ "66+0F+66", "pcmpgtd", { xmm, xmm_m128 },		"Compare Packed Signed Integers for Greater Than" },
+	{ "0F+67", "packuswb", { mm, mm_m64 },			"Pack with Unsigned Saturation" },
+	{ "66+0F+67", "packuswb", { xmm, xmm_m128 },	"Pack with Unsigned Saturation" },
+	{ "0F+68", "punpckhbw", { mm, mm_m64 },			"Unpack High Data" },
+	{ "66+0F+68", "punpckhbw", { xmm, xmm_m128 },	"Unpack High Data" },
+	{ "0F+69", "punpckhwd", { mm, mm_m64 },			"Unpack High Data" },
+	{ "66+0F+69", "punpckhwd", { xmm, xmm_m128 },	"Unpack High Data" },
+	{ "0F+6A", "punpckhdq", { mm, mm_m64 },			"Unpack High Data" },
+	{ "66+0F+6A", "punpckhdq", { xmm, xmm_m128 },	"Unpack High Data" },
+	{ "0F+6B", "packssdw", { mm, mm_m64 },			"Pack with Signed Saturation" },
+	{ "66+0F+6B", "packssdw", { xmm, xmm_m128 },	"Pack with Signed Saturation" },
+	{ "66+0F+6C", "punpcklqdq", { xmm, xmm_m128 },	"Unpack Low Data" },
+	{ "66+0F+6D", "punpckhqdq", { xmm, xmm_m128 },	"Unpack High Data" },
+	{ "0F+6E", "movd", { xmm, r_m32 },				"Move Doubleword" },
+	{ "66+0F+6E", "movd", { xmm, r_m32 },			"Move Doubleword" },
+	{ "0F+6F", "movq", { xmm, mm_m64 },				"Move Quadword" },
+	{ "66+0F+6F", "movdqa", { xmm, xmm_m128 },		"Move Aligned Double Quadword" },
+	{ "F3+0F+6F", "movdqu", { xmm, xmm_m128 },		"Move Unaligned Double Quadword" },
+	{ "0F+70", "pshufw", { mm_m64, imm8 },			"Shuffle Packed Words" },
+	{ "F3+0F+70", "pshuflw", { xmm_m128, imm8 },	"Shuffle Packed Low Words" },
+	{ "66+0F+70", "pshufhw", { xmm_m128, imm8 },	"Shuffle Packed High Words" },
+	{ "F2+0F+70", "pshufd", { xmm_m128, imm8 },		"Shuffle Packed Doublewords" },
+	{ "0F+71+m2", "psrlw", { mm, imm8 },			"Shift Packed Data Right Logical" },
+	{ "66+0F+71+m2", "psrlw", { xmm, imm8 },		"Shift Packed Data Right Logical" },
+	{ "0F+71+m4", "psraw", { mm, imm8 },			"Shift Packed Data Right Arithmetic" },
+	{ "66+0F+71+m4", "psraw", { xmm, imm8 },		"Shift Packed Data Right Arithmetic" },
+	{ "0F+71+m6", "psllw", { mm, imm8 },			"Shift Packed Data Left Logical" },
+	{ "66+0F+71+m6", "psllw", { xmm, imm8 },		"Shift Packed Data Left Logical" },
+	{ "0F+72+m2", "psrld", { mm, imm8 },			"Shift Double Quadword Right Logical" },
+	{ "66+0F+72+m2", "psrld", { xmm, imm8 },		"Shift Double Quadword Right Logical" },
+	{ "0F+72+m4", "psrad", { mm, imm8 },			"Shift Packed Data Right Arithmetic" },
+	{ "66+0F+72+m4", "psrad", { xmm, imm8 },		"Shift Packed Data Right Arithmetic" },
+	{ "0F+72+m6", "pslld", { mm, imm8 },			"Shift Packed Data Left Logical" },
+	{ "66+0F+72+m6", "pslld", { xmm, imm8 },		"Shift Packed Data Left Logical" },
+	{ "0F+73+m2", "psrld", { mm, imm8 },			"Shift Packed Data Right Logical" },
+	{ "66+0F+73+m2", "psrld", { xmm, imm8 },		"Shift Packed Data Right Logical" },
+	{ "0F+73+m3", "psrad", { mm, imm8 },			"Shift Double Quadword Right Logical" },
+	{ "66+0F+73+m6", "psrad", { xmm, imm8 },		"Shift Packed Data Left Logical" },
+	{ "0F+73+m6", "pslld", { mm, imm8 },			"Shift Packed Data Left Logical" },
+	{ "66+0F+73+m7", "pslld", { xmm, imm8 },		"Shift Double Quadword Left Logical" },
+	{ "0F+74", "pcmpeqb", { mm, mm_m64 },			"Compare Packed Data for Equal" },
+	{ "66+0F+74", "pcmpeqb", { xmm, xmm_m128 },		"Compare Packed Data for Equal" },
+	{ "0F+75", "pcmpeqw", { mm, mm_m64 },			"Compare Packed Data for Equal" },
+	{ "66+0F+75", "pcmpeqw", { xmm, xmm_m128 },		"Compare Packed Data for Equal" },
+	{ "0F+76", "pcmpeqd", { mm, mm_m64 },			"Compare Packed Data for Equal" },
+	{ "66+0F+76", "pcmpeqd", { xmm, xmm_m128 },		"Compare Packed Data for Equal" },
+	{ "0F+77", "emms", {  },						"Empty MMX Technology State" },
+	{ "0F+78", "vmread", {  },						"Read Field from Virtual-Machine Control Structure" },
+	{ "0F+79", "vmwrite", {  },						"Write Field to Virtual-Machine Control Structure" },
+	{ "66+0F+7C", "haddpd", { xmm, xmm_m128 },		"Packed Double-FP Horizontal Add" },
+	{ "F2+0F+7C", "haddps", { xmm, xmm_m128 },		"Packed Single-FP Horizontal Add" },
+	{ "66+0F+7D", "hsubpd", { xmm, xmm_m128 },		"Packed Double-FP Horizontal Subtract" },
+	{ "F2+0F+7D", "hsubps", { xmm, xmm_m128 },		"Packed Single-FP Horizontal Subtract" },
+	{ "0F+7E", "movd", { r_m32, mm },				"Move Doubleword" },
+	{ "66+0F+7E", "movd", { r_m32, xmm },			"Move Doubleword" },
+	{ "F3+0F+7E", "movq", { xmm, xmm_m64 },			"Move Quadword" },
+	{ "0F+7F", "movq", { xmm_m64, mm },				"Move Quadword" },
+	{ "66+0F+7F", "movdqa", { xmm_m128, xmm },		"Move Aligned Double Quadword" },
+	{ "F3+0F+7F", "movdqu", { xmm_m128, xmm },		"Move Unaligned Double Quadword" },
+	{ "0F+80", "long jo", { rel16_32 },				"Jump far if overflow (OF=1)" },
+	{ "0F+81", "long jno", { rel16_32 },			"Jump far if not overflow (OF=0)" },
+	{ "0F+82", "long jb", { rel16_32 },				"Jump far if below/not above or equal/carry (CF=1)" },
+	{ "0F+83", "long jnb", { rel16_32 },			"Jump far if not below/above or equal/not carry (CF=0)" },
+	{ "0F+84", "long je", { rel16_32 },				"Jump far if zero/equal (ZF=1)" },
+	{ "0F+85", "long jne", { rel16_32 },			"Jump far if not zero/not equal (ZF=0)" },
+	{ "0F+86", "long jna", { rel16_32 },			"Jump far if below or equal/not above (CF=1 OR ZF=1)" },
+	{ "0F+87", "long ja", { rel16_32 },				"Jump far if not below or equal/above (CF=0 AND ZF=0)" },
+	{ "0F+88", "long js", { rel16_32 },				"Jump far if sign (SF=1)" },
+	{ "0F+89", "long jns", { rel16_32 },			"Jump far if not sign (SF=0)" },
+	{ "0F+8A", "long jp", { rel16_32 },				"Jump far if parity/parity even (PF=1)" },
+	{ "0F+8B", "long jnp", { rel16_32 },			"Jump far if not parity/parity odd (PF=0)" },
+	{ "0F+8C", "long jl", { rel16_32 },				"Jump far if less/not greater (SF!=OF)" },
+	{ "0F+8D", "long jnl", { rel16_32 },			"Jump far if not less/greater or equal (SF=OF)" },
+	{ "0F+8E", "long jng", { rel16_32 },			"Jump far if less or equal/not greater ((ZF=1) OR (SF!=OF))" },
+	{ "0F+8F", "long jg", { rel16_32 },				"Jump far if not less nor equal/greater ((ZF=0) AND (SF=OF))" },
+	{ "0F+90", "seto", { r_m8 },					"Set Byte on Condition - overflow (OF=1)" },
+	{ "0F+91", "setno", { r_m8 },					"Set Byte on Condition - not overflow (OF=0)" },
+	{ "0F+92", "setb", { r_m8 },					"Set Byte on Condition - below/not above or equal/carry (CF=1)" },
+	{ "0F+93", "setnb", { r_m8 },					"Set Byte on Condition - not below/above or equal/not carry (CF=0)" },
+	{ "0F+94", "sete", { r_m8 },					"Set Byte on Condition - zero/equal (ZF=1)" },
+	{ "0F+95", "setne", { r_m8 },					"Set Byte on Condition - not zero/not equal (ZF=0)" },
+	{ "0F+96", "setna", { r_m8 },					"Set Byte on Condition - below or equal/not above (CF=1 OR ZF=1)" },
+	{ "0F+97", "seta", { r_m8 },					"Set Byte on Condition - not below or equal/above (CF=0 AND ZF=0)" },
+	{ "0F+98", "sets", { r_m8 },					"Set Byte on Condition - sign (SF=1)" },
+	{ "0F+99", "setns", { r_m8 },					"Set Byte on Condition - not sign (SF=0)" },
+	{ "0F+9A", "setp", { r_m8 },					"Set Byte on Condition - parity/parity even (PF=1)" },
+	{ "0F+9B", "setnp", { r_m8 },					"Set Byte on Condition - not parity/parity odd (PF=0)" },
+	{ "0F+9C", "setl", { r_m8 },					"Set Byte on Condition - less/not greater (SF!=OF)" },
+	{ "0F+9D", "setnl", { r_m8 },					"Set Byte on Condition - not less/greater or equal (SF=OF)" },
+	{ "0F+9E", "setng", { r_m8 },					"Set Byte on Condition - less or equal/not greater ((ZF=1) OR (SF!=OF))" },
+	{ "0F+9F", "setg", { r_m8 },					"Set Byte on Condition - not less nor equal/greater ((ZF=0) AND (SF=OF))" },
+	{ "0F+A0", "push", { FS },						"Push Word, Doubleword or Quadword Onto the Stack" },
+	{ "0F+A1", "pop", { FS },						"Pop a Value from the Stack" },
+	{ "0F+A2", "cpuid", { IA32_BIOS },				"CPU Identification" },
+	{ "0F+A3", "bt", { r_m16_32, r16_32 },			"Bit Test" },
+	{ "0F+A4", "shld", { r_m16_32, r16_32, imm8 },	"Double Precision Shift Left" },
+	{ "0F+A5", "shld", { r_m16_32, r16_32, CL },	"Double Precision Shift Left" },
+	{ "0F+A8", "push", { GS },						"Push Word, Doubleword or Quadword Onto the Stack" },
+	{ "0F+A9", "pop", { GS },						"Pop a Value from the Stack" },
+	{ "0F+AA", "rsm", {  },							"Resume from System Management Mode" },
+	{ "0F+AB", "bts", { r_m16_32, r16_32 },			"Bit Test and Set" },
+	{ "0F+AC", "shrd", { r_m16_32, r16_32, imm8 },	"Double Precision Shift Right" },
+	{ "0F+AD", "shrd", { r_m16_32, r16_32, CL },	"Double Precision Shift Right" },
+	{ "0F+AE+m0", "fxsave", { m512, ST, ST1 },		"Save x87 FPU, MMX, XMM, and MXCSR State" },
+	{ "0F+AE+m1", "fxrstor", { ST, ST1, ST2 },		"Restore x87 FPU, MMX, XMM, and MXCSR State" },
+	{ "0F+AE+m2", "ldmxcsr", { m32 },				"Load MXCSR Register" },
+	{ "0F+AE+m3", "stmxcsr", { m32 },				"Store MXCSR Register State" },
+	{ "0F+AE+m4", "xsave", { m, EDX, EAX },			"Save Processor Extended States" },
+	{ "0F+AE+m5", "lfence", {  },					"Load Fence" },
+	{ "0F+AE+m5", "xrstor", { ST, ST1, ST2 },		"Restore Processor Extended States" },
+	{ "0F+AE+m6", "mfence", {  },					"Memory Fence" },
+	{ "0F+AE+m7", "sfence", {  },					"Store Fence" },
+	{ "0F+AE+m7", "clflush", { m8 },				"Flush Cache Line" },
+	{ "0F+AF", "imul", { r16_32, r_m16_32 },		"Signed Multiply" },
+	{ "0F+B0", "cmpxchg", { r_m8, AL, r8 },			"Compare and Exchange" },
+	{ "0F+B1", "cmpxchg", { r_m16_32, EAX, r16_32 },"Compare and Exchange" },
+	{ "0F+B2", "lss",{SS, r16_32, m16_32_and_16_32},"Load Far Pointer" },
+	{ "0F+B3", "btr", { r_m16_32, r16_32 },			"Bit Test and Reset" },
+	{ "0F+B4", "lfs",{FS,r_m16_32,m16_32_and_16_32},"Load Far Pointer" },
+	{ "0F+B5", "lgs",{GS,r_m16_32,m16_32_and_16_32},"Load Far Pointer" },
+	{ "0F+B6", "movzx", { r16_32, r_m8 },			"Move with Zero-Extend" },
+	{ "0F+B7", "movzx", { r16_32, r_m16 },			"Move with Zero-Extend" },
+	{ "F3+0F+B8", "popcnt", { r16_32, r_m16_32 },	"Bit Population Count" },
+	{ "0F+B9", "ud", {  },							"Undefined Instruction" },
+	{ "0F+BA+m4", "bt", { r_m16_32, imm8 },			"Bit Test" },
+	{ "0F+BA+m5", "bts", { r_m16_32, imm8 },		"Bit Test and Set" },
+	{ "0F+BA+m6", "btr", { r_m16_32, imm8 },		"Bit Test and Reset" },
+	{ "0F+BA+m7", "btc", { r_m16_32, imm8 },		"Bit Test and Complement" },
+	{ "0F+BB", "btc", { r_m16_32, r16_32 },			"Bit Test and Complement" },
+	{ "0F+BC", "bsf", { r16_32, r_m16_32 },			"Bit Scan Forward" },
+	{ "0F+BD", "bsr", { r16_32, r_m16_32 },			"Bit Scan Reverse" },
+	{ "0F+BE", "movsx", { r16_32, r_m8 },			"Move with Sign-Extension" },
+	{ "0F+BF", "movsx", { r16_32, r_m16 },			"Move with Sign-Extension" },
+	{ "0F+C0", "xadd", { r_m8, r8 },				"Exchange and Add" },
+	{ "0F+C1", "xadd", { r_m16_32, r16_32 },		"Exchange and Add" },
+	{ "0F+C2", "cmpps", { xmm, xmm_m128, imm8 },	"Compare Packed Single-FP Values" },
+	{ "F3+0F+C2", "cmpss", { xmm, xmm_m32, imm8 },	"Compare Scalar Single-FP Values" },
+	{ "66+0F+C2", "cmppd", { xmm, xmm_m128, imm8 },	"Compare Packed Double-FP Values" },
+	{ "F2+0F+C2", "cmpsd", { xmm, xmm_m64, imm8 },	"Compare Scalar Double-FP Values" },
+	{ "0F+C3", "movnti", { m32, r32 },				"Store Doubleword Using Non-Temporal Hint" },
+	{ "0F+C4", "pinsrw", { mm, m16, imm8 },			"Insert Word" },
+	{ "66+0F+C4", "pinsrw", { xmm, m16, imm8 },		"Insert Word" },
+	{ "0F+C5", "pextrw", { r32, mm, imm8 },			"Extract Word" },
+	{ "66+0F+C5", "pextrw", { r32, xmm, imm8 },		"Extract Word" },
+	{ "0F+C6", "shufps", { xmm, xmm_m128, imm8 },	"Shuffle Packed Single-FP Values" },
+	{ "66+0F+C6", "shufpd", { xmm, xmm_m128, imm8 },"Shuffle Packed Double-FP Values" },
+	{ "0F+C7+m1", "cmpxchg8b", { m64, EAX, EDX },	"Compare and Exchange Bytes" },
+	{ "0F+C7+m6", "vmptrld", { m64 },				"Load Pointer to Virtual-Machine Control Structure" },
+	{ "66+0F+C7+m6", "vmclean", { m64 },			"Clear Virtual-Machine Control Structure" },
+	{ "F3+0F+C7+m6", "vmxon", { m64 },				"Enter VMX Operation" },
+	{ "0F+C7+m7", "vmptrst", { m64 },				"Store Pointer to Virtual-Machine Control Structure" },
+	{ "0F+C8+r", "bswap", { r16_32 },				"Byte Swap" },
+	{ "66+0F+D0", "addsubpd", { xmm, xmm_m128 },	"Packed Double-FP Add/Subtract" },
+	{ "F2+0F+D0", "addsubpd", { xmm, xmm_m128 },	"Packed Single-FP Add/Subtract" },
+	{ "0F+D1", "psrlw", { mm, mm_m64 },				"Shift Packed Data Right Logical" },
+	{ "66+0F+D1", "psrlw", { xmm, xmm_m128 },		"Shift Packed Data Right Logical" },
+	{ "0F+D2", "psrld", { mm, mm_m64 },				"Shift Packed Data Right Logical" },
+	{ "66+0F+D2", "psrld", { xmm, xmm_m128 },		"Shift Packed Data Right Logical" },
+	{ "0F+D3", "psrlq", { mm, mm_m64 },				"Shift Packed Data Right Logical" },
+	{ "66+0F+D3", "psrlq", { xmm, xmm_m128 },		"Shift Packed Data Right Logical" },
+	{ "0F+D4", "paddq", { mm, mm_m64 },				"Add Packed Quadword Integers" },
+	{ "66+0F+D4", "paddq", { xmm, xmm_m128 },		"Add Packed Quadword Integers" },
+	{ "0F+D5", "pmullw", { mm, mm_m64 },			"Multiply Packed Signed Integers and Store Low Result" },
+	{ "66+0F+D5", "pmullw", { xmm, xmm_m128 },		"Multiply Packed Signed Integers and Store Low Result" },
+	{ "66+0F+D6", "movq", { xmm_m64, xmm },			"Move Quadword" },
+	{ "F3+0F+D6", "movq2dq", { xmm, mm },			"Move Quadword from MMX Technology to XMM Register" },
+	{ "F2+0F+D6", "movdq2q", { mm, xmm },			"Move Quadword from XMM to MMX Technology Register" },
+	{ "0F+D7", "pmovmskb", { r32, mm },				"Move Byte Mask" },
+	{ "66+0F+D7", "pmovmskb", { r32, xmm },			"Move Byte Mask" },
+	{ "0F+D8", "psubusb", { mm, mm_m64 },			"Subtract Packed Unsigned Integers with Unsigned Saturation" },
+	{ "66+0F+D8", "psubusb", { xmm, xmm_m128 },		"Subtract Packed Unsigned Integers with Unsigned Saturation" },
+	{ "0F+D9", "psubusw", { mm, mm_m64 },			"Subtract Packed Unsigned Integers with Unsigned Saturation" },
+	{ "66+0F+D9", "psubusw", { xmm, xmm_m128 },		"Subtract Packed Unsigned Integers with Unsigned Saturation" },
+	{ "0F+DA", "pminub", { mm, mm_m64 },			"Minimum of Packed Unsigned Byte Integers" },
+	{ "66+0F+DA", "pminub", { xmm, xmm_m128 },		"Minimum of Packed Unsigned Byte Integers" },
+	{ "0F+DB", "pand", { mm, mm_m64 },				"Logical AND" },
+	{ "66+0F+DB", "pand", { xmm, xmm_m128 },		"Logical AND" },
+	{ "0F+DC", "paddusb", { mm, mm_m64 },			"Add Packed Unsigned Integers with Unsigned Saturation" },
+	{ "66+0F+DC", "paddusb", { xmm, xmm_m128 },		"Add Packed Unsigned Integers with Unsigned Saturation" },
+	{ "0F+DD", "paddusw", { mm, mm_m64 },			"Add Packed Unsigned Integers with Unsigned Saturation" },
+	{ "66+0F+DD", "paddusw", { xmm, xmm_m128 },		"Add Packed Unsigned Integers with Unsigned Saturation" },
+	{ "0F+DE", "pmaxub", { mm, mm_m64 },			"Maximum of Packed Unsigned Byte Integers" },
+	{ "66+0F+DE", "pmaxub", { xmm, xmm_m128 },		"Maximum of Packed Unsigned Byte Integers" },
+	{ "0F+DF", "pandn", { mm, mm_m64 },				"Logical AND NOT" },
+	{ "66+0F+DF", "pandn", { xmm, xmm_m128 },		"Logical AND NOT" },
+	{ "0F+E0", "pavgb", { mm, mm_m64 },				"Average Packed Integers" },
+	{ "66+0F+E0", "pavgb", { xmm, xmm_m128 },		"Average Packed Integers" },
+	{ "0F+E1", "psraw", { mm, mm_m64 },				"Shift Packed Data Right Arithmetic" },
+	{ "66+0F+E1", "psraw", { xmm, xmm_m128 },		"Shift Packed Data Right Arithmetic" },
+	{ "0F+E2", "psrad", { mm, mm_m64 },				"Shift Packed Data Right Arithmetic" },
+	{ "66+0F+E2", "psrad", { xmm, xmm_m128 },		"Shift Packed Data Right Arithmetic" },
+	{ "0F+E3", "pavgw", { mm, mm_m64 },				"Average Packed Integers" },
+	{ "66+0F+E3", "pavgw", { xmm, xmm_m128 },		"Average Packed Integers" },
+	{ "0F+E4", "pmulhuw", { mm, mm_m64 },			"Multiply Packed Unsigned Integers and Store High Result" },
+	{ "66+0F+E4", "pmulhuw", { xmm, xmm_m128 },		"Multiply Packed Unsigned Integers and Store High Result" },
+	{ "0F+E5", "pmulhw", { mm, mm_m64 },			"Multiply Packed Signed Integers and Store High Result" },
+	{ "66+0F+E5", "pmulhw", { xmm, xmm_m128 },		"Multiply Packed Signed Integers and Store High Result" },
+	{ "F2+0F+E6", "cvtpd2dq", { xmm, xmm_m128 },	"Convert Packed Double-FP Values to DW Integers" },
+	{ "66+0F+E6", "cvttpd2dq", { xmm, xmm_m128 },	"Convert with Trunc. Packed Double-FP Values to DW Integers" },
+	{ "F3+0F+E6", "cvtdq2pd", { xmm, xmm_m128 },	"Convert Packed DW Integers to Double-FP Values" },
+	{ "0F+E7", "movntq", { m64, mm },				"Store of Quadword Using Non-Temporal Hint" },
+	{ "66+0F+E7", "movntdq", { m128, xmm },			"Store Double Quadword Using Non-Temporal Hint" },
+	{ "0F+E8", "psubsb", { mm, mm_m64 },			"Subtract Packed Signed Integers with Signed Saturation" },
+	{ "66+0F+E8", "psubsb", { xmm, xmm_m128 },		"Subtract Packed Signed Integers with Signed Saturation" },
+	{ "0F+E9", "psubsw", { mm, mm_m64 },			"Subtract Packed Signed Integers with Signed Saturation" },
+	{ "66+0F+E9", "psubsw", { xmm, xmm_m128 },		"Subtract Packed Signed Integers with Signed Saturation" },
+	{ "0F+EA", "pminsw", { mm, mm_m64 },			"Minimum of Packed Signed Word Integers" },
+	{ "66+0F+EA", "pminsw", { xmm, xmm_m128 },		"Minimum of Packed Signed Word Integers" },
+	{ "0F+EB", "por", { mm, mm_m64 },				"Bitwise Logical OR" },
+	{ "66+0F+EB", "por", { xmm, xmm_m128 },			"Bitwise Logical OR" },
+	{ "0F+EC", "paddsb", { mm, mm_m64 },			"Add Packed Signed Integers with Signed Saturation" },
+	{ "66+0F+EC", "paddsb", { xmm, xmm_m128 },		"Add Packed Signed Integers with Signed Saturation" },
+	{ "0F+ED", "paddsw", { mm, mm_m64 },			"Add Packed Signed Integers with Signed Saturation" },
+	{ "66+0F+ED", "paddsw", { xmm, xmm_m128 },		"Add Packed Signed Integers with Signed Saturation" },
+	{ "0F+EE", "pmaxsw", { mm, mm_m64 },			"Maximum of Packed Signed Word Integers" },
+	{ "66+0F+EE", "pmaxsw", { xmm, xmm_m128 },		"Maximum of Packed Signed Word Integers" },
+	{ "0F+EF", "pxor", { mm, mm_m64 },				"Logical Exclusive OR" },
+	{ "66+0F+EF", "pxor", { xmm, xmm_m128 },		"Logical Exclusive OR" },
+	{ "F2+0F+F0", "lddqu", { xmm, m128 },			"Load Unaligned Integer 128 Bits" },
+	{ "0F+F1", "psllw", { mm, mm_m64 },				"Shift Packed Data Left Logical" },
+	{ "66+0F+F1", "psllw", { xmm, xmm_m128 },		"Shift Packed Data Left Logical" },
+	{ "0F+F2", "pslld", { mm, mm_m64 },				"Shift Packed Data Left Logical" },
+	{ "66+0F+F2", "pslld", { xmm, xmm_m128 },		"Shift Packed Data Left Logical" },
+	{ "0F+F3", "psllq", { mm, mm_m64 },				"Shift Packed Data Left Logical" },
+	{ "66+0F+F3", "psllq", { xmm, xmm_m128 },		"Shift Packed Data Left Logical" },
+	{ "0F+F4", "pmuludq", { mm, mm_m64 },			"Multiply Packed Unsigned DW Integers" },
+	{ "66+0F+F4", "pmuludq", { xmm, xmm_m128 },		"Multiply Packed Unsigned DW Integers" },
+	{ "0F+F5", "pmaddwd", { mm, mm_m64 },			"Multiply and Add Packed Integers" },
+	{ "66+0F+F5", "pmaddwd", { xmm, xmm_m128 },		"Multiply and Add Packed Integers" },
+	{ "0F+F6", "psadbw", { mm, mm_m64 },			"Compute Sum of Absolute Differences" },
+	{ "66+0F+F6", "psadbw", { xmm, xmm_m128 },		"Compute Sum of Absolute Differences" },
+	{ "0F+F7", "maskmovq", { m64, mm, mm },			"Store Selected Bytes of Quadword" },
+	{ "66+0F+F7", "maskmovdqu", { m128, xmm, xmm },	"Store Selected Bytes of Double Quadword" },
+	{ "0F+F8", "psubb", { mm, mm_m64 },				"Subtract Packed Integers" },
+	{ "66+0F+F8", "psubb", { xmm, xmm_m128 },		"Subtract Packed Integers" },
+	{ "0F+F9", "psubw", { mm, mm_m64 },				"Subtract Packed Integers" },
+	{ "66+0F+F9", "psubw", { xmm, xmm_m128 },		"Subtract Packed Integers" },
+	{ "0F+FA", "psubd", { mm, mm_m64 },				"Subtract Packed Integers" },
+	{ "66+0F+FA", "psubd", { xmm, xmm_m128 },		"Subtract Packed Integers" },
+	{ "0F+FB", "psubq", { mm, mm_m64 },				"Subtract Packed Quadword Integers" },
+	{ "66+0F+FB", "psubq", { xmm, xmm_m128 },		"Subtract Packed Quadword Integers" },
+	{ "0F+FC", "paddb", { mm, mm_m64 },				"Add Packed Integers" },
+	{ "66+0F+FC", "paddb", { xmm, xmm_m128 },		"Add Packed Integers" },
+	{ "0F+FD", "paddw", { mm, mm_m64 },				"Add Packed Integers" },
+	{ "66+0F+FD", "paddw", { xmm, xmm_m128 },		"Add Packed Integers" },
+	{ "0F+FE", "paddd", { mm, mm_m64 },				"Add Packed Integers" },
+	{ "66+0F+FE", "paddd", { xmm, xmm_m128 },		"Add Packed Integers" },
+	{ "10", "adc", { r_m8, r8 },					"Add with Carry" },
+	{ "11", "adc", { r_m16_32, r16_32 },			"Add with Carry" },
+	{ "12", "adc", { r8, r_m8 },					"Add with Carry" },
+	{ "13", "adc", { r16_32, r_m16_32 },			"Add with Carry" },
+	{ "14", "adc", { AL, imm8 },					"Add with Carry" },
+	{ "15", "adc", { EAX, imm16_32 },				"Add with Carry" },
+	{ "16", "push", { SS },							"Push Stack Segment onto the stack" },
+	{ "17", "pop", { SS },							"Pop Stack Segment off of the stack" },
+	{ "18", "sbb", { r_m8, r8 },					"Integer Subtraction with Borrow" },
+	{ "19", "sbb", { r_m16_32, r16_32 },			"Integer Subtraction with Borrow" },
+	{ "1A", "sbb", { r8, r_m8 },					"Integer Subtraction with Borrow" },
+	{ "1B", "sbb", { r16_32, r_m16_32 },			"Integer Subtraction with Borrow" },
+	{ "1C", "sbb", { AL, imm8 },					"Integer Subtraction with Borrow" },
+	{ "1D", "sbb", { EAX, imm16_32 },				"Integer Subtraction with Borrow" },
+	{ "1E", "push", { DS },							"Push Data Segment onto the stack" },
+	{ "1F", "pop", { DS },							"Pop Data Segment off of the stack" },
+	{ "20", "and", { r_m8, r8 },					"Logical AND" },
+	{ "21", "and", { r_m16_32, r16_32 },			"Logical AND" },
+	{ "22", "and", { r8, r_m8 },					"Logical AND" },
+	{ "23", "and", { r16_32, r_m16_32 },			"Logical AND" },
+	{ "24", "and", { AL, imm8 },					"Logical AND" },
+	{ "25", "and", { EAX, imm16_32 },				"Logical AND" },
+	{ "27", "daa", { AL },							"Decimal Adjust AL after Addition" },
+	{ "28", "sub", { r_m8, r8 },					"Subtract" },
+	{ "29", "sub", { r_m16_32, r16_32 },			"Subtract" },
+	{ "2A", "sub", { r8, r_m8 },					"Subtract" },
+	{ "2B", "sub", { r16_32, r_m16_32 },			"Subtract" },
+	{ "2C", "sub", { AL, imm8 },					"Subtract" },
+	{ "2D", "sub", { EAX, imm16_32 },				"Subtract" },
+	{ "2F", "das", { AL },							"Decimal Adjust AL after Subtraction" },
+	{ "30", "xor", { r_m8, r8 },					"Logical Exclusive OR" },
+	{ "31", "xor", { r_m16_32, r16_32 },			"Logical Exclusive OR" },
+	{ "32", "xor", { r8, r_m8 },					"Logical Exclusive OR" },
+	{ "33", "xor", { r16_32, r_m16_32 },			"Logical Exclusive OR" },
+	{ "34", "xor", { AL, imm8 },					"Logical Exclusive OR" },
+	{ "35", "xor", { EAX, imm16_32 },				"Logical Exclusive OR" },
+	{ "37", "aaa", { AL, AH },						"ASCII Adjust After Addition" },
+	{ "38", "cmp", { r_m8, r8 },					"Compare Two Operands" },
+	{ "39", "cmp", { r_m16_32, r16_32 },			"Compare Two Operands" },
+	{ "3A", "cmp", { r8, r_m8 },					"Compare Two Operands" },
+	{ "3B", "cmp", { r16_32, r_m16_32 },			"Compare Two Operands" },
+	{ "3C", "cmp", { AL, imm8 },					"Compare Two Operands" },
+	{ "3D", "cmp", { EAX, imm16_32 },				"Compare Two Operands" },
+	{ "3F", "aas", { AL, AH },						"ASCII Adjust AL After Subtraction" },
+	{ "40+r", "inc", { r16_32 },					"Increment by 1" },
+	{ "48+r", "dec", { r16_32 },					"Decrement by 1" },
+	{ "50+r", "push", { r16_32 },					"Push Word, Doubleword or Quadword Onto the Stack" },
+	{ "58+r", "pop", { r16_32 },					"Pop a Value from the Stack" },
+	{ "60", "pushad", {  },							"Push All General-Purpose Registers" },
+	{ "61", "popad", {  },							"Pop All General-Purpose Registers" },
+	{ "62", "bound", { r16_32, m16_32_and_16_32 },	"Check Array Index Against Bounds" },
+	{ "63", "arpl", { r_m16, r16 },					"Adjust RPL Field of Segment Selector" },
+	{ "63", "arpl", { r_m16, r16 },					"Adjust RPL Field of Segment Selector" },
+	{ "68", "push", { imm16_32 },					"Push Word, Doubleword or Quadword Onto the Stack" },
+	{ "69", "imul", { r16_32, r_m16_32, imm16_32 },	"Signed Multiply" },
+	{ "6A", "push", { imm8 },						"Push Word, Doubleword or Quadword Onto the Stack" },
+	{ "6B", "imul", { r16_32, r_m16_32, imm8 },		"Signed Multiply" },
+	{ "6C", "insb", {  },							"Input from Port to String" },
+	{ "6D", "insd", {  },							"Input from Port to String" },
+	{ "6E", "outsb", {  },							"Output String to Port" },
+	{ "6F", "outsd", {  },							"Output String to Port" },
+	{ "70", "jo short", { rel8 },					"Jump short if overflow (OF=1)" },
+	{ "71", "jno short", { rel8 },					"Jump short if not overflow (OF=0))" },
+	{ "72", "jb short", { rel8 },					"Jump short if below/not above or equal/carry (CF=1)" },
+	{ "73", "jae short", { rel8 },					"Jump short if not below/above or equal/not carry (CF=0))" },
+	{ "74", "je short", { rel8 },					"Jump short if zero/equal (ZF=1)" },
+	{ "75", "jne short", { rel8 },					"Jump short if not zero/not equal (ZF=0)" },
+	{ "76", "jna short", { rel8 },					"Jump short if below or equal/not above (CF=1 OR ZF=1)" },
+	{ "77", "ja short", { rel8 },					"Jump short if not below or equal/above (CF=0 AND ZF=0)" },
+	{ "78", "js short", { rel8 },					"Jump short if sign (SF=1)" },
+	{ "79", "jns short", { rel8 },					"Jump short if not sign (SF=0)" },
+	{ "7A", "jp short", { rel8 },					"Jump short if parity/parity even (PF=1)" },
+	{ "7B", "jnp short", { rel8 },					"Jump short if not parity/parity odd (PF=0)" },
+	{ "7C", "jl short", { rel8 },					"Jump short if less/not greater (SF!=OF)" },
+	{ "7D", "jge short", { rel8 },					"Jump short if not less/greater or equal (SF=OF)" },
+	{ "7E", "jle short", { rel8 },					"Jump short if less or equal/not greater ((ZF=1) OR (SF!=OF))" },
+	{ "7F", "jg short", { rel8 },					"Jump short if not less nor equal/greater ((ZF=0) AND (SF=OF))" },
+	{ "80+m0", "add", { r_m8, imm8 },				"Add" },
+	{ "80+m1", "or", { r_m8, imm8 },				"Logical Inclusive OR" },
+	{ "80+m2", "adc", { r_m8, imm8 },				"Add with Carry" },
+	{ "80+m3", "sbb", { r_m8, imm8 },				"Integer Subtraction with Borrow" },
+	{ "80+m4", "and", { r_m8, imm8 },				"Logical AND" },
+	{ "80+m5", "sub", { r_m8, imm8 },				"Subtract" },
+	{ "80+m6", "xor", { r_m8, imm8 },				"Logical Exclusive OR" },
+	{ "80+m7", "cmp", { r_m8, imm8 },				"Compare Two Operands" },
+	{ "81+m0", "add", { r_m16_32, imm16_32 },		"Add" },
+	{ "81+m1", "or", { r_m16_32, imm16_32 },		"Logical Inclusive OR" },
+	{ "81+m2", "adc", { r_m16_32, imm16_32 },		"Add with Carry" },
+	{ "81+m3", "sbb", { r_m16_32, imm16_32 },		"Integer Subtraction with Borrow" },
+	{ "81+m4", "and", { r_m16_32, imm16_32 },		"Logical AND" },
+	{ "81+m5", "sub", { r_m16_32, imm16_32 },		"Subtract" },
+	{ "81+m6", "xor", { r_m16_32, imm16_32 },		"Logical Exclusive OR" },
+	{ "81+m7", "cmp", { r_m16_32, imm16_32 },		"Compare Two Operands" },
+	{ "82+m0", "add", { r_m8, imm8 },				"Add" },
+	{ "82+m1", "or", { r_m8, imm8 },				"Logical Inclusive OR" },
+	{ "82+m2", "adc", { r_m8, imm8 },				"Add with Carry" },
+	{ "82+m3", "sbb", { r_m8, imm8 },				"Integer Subtraction with Borrow" },
+	{ "82+m4", "and", { r_m8, imm8 },				"Logical AND" },
+	{ "82+m5", "sub", { r_m8, imm8 },				"Subtract" },
+	{ "82+m6", "xor", { r_m8, imm8 },				"Logical Exclusive OR" },
+	{ "82+m7", "cmp", { r_m8, imm8 },				"Compare Two Operands" },
+	{ "83+m0", "add", { r_m16_32, imm8 },			"Add" },
+	{ "83+m1", "or", { r_m16_32, imm8 },			"Logical Inclusive OR" },
+	{ "83+m2", "adc", { r_m16_32, imm8 },			"Add with Carry" },
+	{ "83+m3", "sbb", { r_m16_32, imm8 },			"Integer Subtraction with Borrow" },
+	{ "83+m4", "and", { r_m16_32, imm8 },			"Logical AND" },
+	{ "83+m5", "sub", { r_m16_32, imm8 },			"Subtract" },
+	{ "83+m6", "xor", { r_m16_32, imm8 },			"Logical Exclusive OR" },
+	{ "83+m7", "cmp", { r_m16_32, imm8 },			"Compare Two Operands" },
+	{ "84", "test", { r_m8, r8 },					"Logical Compare" },
+	{ "85", "test", { r_m16_32, r16_32 },			"Logical Compare" },
+	{ "86", "xchg", { r_m8, r8 },					"Exchange Register/Memory with Register" },
+	{ "87", "xchg", { r_m16_32, r16_32 },			"Exchange Register/Memory with Register" },
+	{ "88", "mov", { r_m8, r8 },					"Move" },
+	{ "89", "mov", { r_m16_32, r16_32 },			"Move" },
+	{ "8A", "mov", { r8, r_m8 },					"Move" },
+	{ "8B", "mov", { r16_32, r_m16_32 },			"Move" },
+	{ "8C", "mov", { m16, Sreg },					"Move" },
+	{ "8D", "lea", { r16_32, m32 },					"Load Effective Address" },
+	{ "8E", "mov", { Sreg, r_m16 },					"Move" },
+	{ "8F", "pop", { r_m16_32 },					"Pop a Value from the Stack" },
+	{ "90", "nop", {  },							"No Operation" },
+	{ "90+r", "xchg", { EAX, r16_32 },				"Exchange Register/Memory with Register" },
+	{ "98", "cbw", { AX, AL },						"Convert Byte to Word" },
+	{ "99", "cwd", { AX, AL },						"Convert Doubleword to Quadword" },
+	{ "9A", "callf", { ptr16_32 },					"Call Procedure" },
+	{ "9B", "fwait", {  },							"Check pending unmasked floating-point exceptions" },
+	{ "9C", "pushfd", {  },							"Push EFLAGS Register onto the Stack" },
+	{ "9D", "popfd", {  },							"Pop Stack into EFLAGS Register" },
+	{ "9E", "sahf", { AH },							"Store AH into Flags" },
+	{ "9F", "lahf", { AH },							"Load Status Flags into AH Register" },
+	{ "A0", "mov", { AL, moffs8 },					"Move" },
+	{ "A1", "mov", { EAX, moffs16_32 },				"Move" },
+	{ "A2", "mov", { moffs8, AL },					"Move" },
+	{ "A3", "mov", { moffs16_32, EAX },				"Move" },
+	{ "A4", "movsb", {  },							"Move Data from String to String" },
+	{ "A5", "movsw", {  },							"Move Data from String to String" },
+	{ "A6", "cmpsb", {  },							"Compare String Operands" },
+	{ "A7", "cmpsw", {  },							"Compare String Operands" },
+	{ "A8", "test", { AL, imm8 },					"Logical Compare" },
+	{ "A9", "test", { EAX, imm16_32 },				"Logical Compare" },
+	{ "AA", "stosb", {  },							"Store String" },
+	{ "AB", "stosw", {  },							"Store String" },
+	{ "AC", "lodsb", {  },							"Load String" },
+	{ "AD", "lodsw", {  },							"Load String" },
+	{ "AE", "scasb", {  },							"Scan String" },
+	{ "AF", "scasw", {  },							"Scan String" },
+	{ "B0+r", "mov", { r8, imm8 },					"Move" },
+	{ "B8+r", "mov", { r16_32, imm16_32 },			"Move" },
+	{ "C0+m0", "rol", { r_m8, imm8 },				"Rotate" },
+	{ "C0+m1", "ror", { r_m8, imm8 },				"Rotate" },
+	{ "C0+m2", "rcl", { r_m8, imm8 },				"Rotate" },
+	{ "C0+m3", "rcr", { r_m8, imm8 },				"Rotate" },
+	{ "C0+m4", "shl", { r_m8, imm8 },				"Shift" },
+	{ "C0+m5", "shr", { r_m8, imm8 },				"Shift" },
+	{ "C0+m6", "sal", { r_m8, imm8 },				"Shift" },
+	{ "C0+m7", "sar", { r_m8, imm8 },				"Shift" },
+	{ "C1+m0", "rol", { r_m16_32, imm8 },			"Rotate" },
+	{ "C1+m1", "ror", { r_m16_32, imm8 },			"Rotate" },
+	{ "C1+m2", "rcl", { r_m16_32, imm8 },			"Rotate" },
+	{ "C1+m3", "rcr", { r_m16_32, imm8 },			"Rotate" },
+	{ "C1+m4", "shl", { r_m16_32, imm8 },			"Shift" },
+	{ "C1+m5", "shr", { r_m16_32, imm8 },			"Shift" },
+	{ "C1+m6", "sal", { r_m16_32, imm8 },			"Shift" },
+	{ "C1+m7", "sar", { r_m16_32, imm8 },			"Shift" },
+	{ "C2", "ret", { imm16 },						"Return from procedure" },
+	{ "C3", "retn", {  },							"Return from procedure" },
+	{ "C4", "les", { ES, r16_32, m16_32_and_16_32 },"Load Far Pointer" },
+	{ "C5", "lds", { DS, r16_32, m16_32_and_16_32 },"Load Far Pointer" },
+	{ "C6", "mov", { r_m8, imm8 },					"Move" },
+	{ "C7", "mov", { r_m16_32, imm16_32 },			"Move" },
+	{ "66+C7", "mov", { r_m16_32, imm16 },			"Move" },
+	{ "C8", "enter", { EBP, imm16, imm8 },			"Make Stack Frame for Procedure Parameters" },
+	{ "C9", "leave", { EBP },						"High Level Procedure Exit" },
+	{ "CA", "retf", { imm16 },						"Return from procedure" },
+	{ "CB", "retf", {  },							"Return from procedure" },
+	{ "CC", "int 3", {  },							"Call to Interrupt Procedure" },
+	{ "CD", "int", { imm8 },						"Call to Interrupt Procedure" },
+	{ "CE", "into", {  },							"Call to Interrupt Procedure" },
+	{ "CF", "iretd", {  },							"Interrupt Return" },
+	{ "D0+m0", "rol", { r_m8, one },				"Rotate" },
+	{ "D0+m1", "ror", { r_m8, one },				"Rotate" },
+	{ "D0+m2", "rcl", { r_m8, one },				"Rotate" },
+	{ "D0+m3", "rcr", { r_m8, one },				"Rotate" },
+	{ "D0+m4", "shl", { r_m8, one },				"Shift" },
+	{ "D0+m5", "shr", { r_m8, one },				"Shift" },
+	{ "D0+m6", "shl", { r_m8, one },				"Shift" },
+	{ "D0+m7", "shr", { r_m8, one },				"Shift" },
+	{ "D1+m0", "rol", { r_m16_32, one },			"Rotate" },
+	{ "D1+m1", "ror", { r_m16_32, one },			"Rotate" },
+	{ "D1+m2", "rcl", { r_m16_32, one },			"Rotate" },
+	{ "D1+m3", "rcr", { r_m16_32, one },			"Rotate" },
+	{ "D1+m4", "shl", { r_m16_32, one },			"Shift" },
+	{ "D1+m5", "shr", { r_m16_32, one },			"Shift" },
+	{ "D1+m6", "shl", { r_m16_32, one },			"Shift" },
+	{ "D1+m7", "shr", { r_m16_32, one },			"Shift" },
+	{ "D2+m0", "rol", { r_m8, CL },					"Rotate" },
+	{ "D2+m1", "ror", { r_m8, CL },					"Rotate" },
+	{ "D2+m2", "rcl", { r_m8, CL },					"Rotate" },
+	{ "D2+m3", "rcr", { r_m8, CL },					"Rotate" },
+	{ "D2+m4", "shl", { r_m8, CL },					"Shift" },
+	{ "D2+m5", "shr", { r_m8, CL },					"Shift" },
+	{ "D2+m6", "shl", { r_m8, CL },					"Shift" },
+	{ "D2+m7", "shr", { r_m8, CL },					"Shift" },
+	{ "D3+m0", "rol", { r_m16_32, CL },				"Rotate" },
+	{ "D3+m1", "ror", { r_m16_32, CL },				"Rotate" },
+	{ "D3+m2", "rcl", { r_m16_32, CL },				"Rotate" },
+	{ "D3+m3", "rcr", { r_m16_32, CL },				"Rotate" },
+	{ "D3+m4", "shl", { r_m16_32, CL },				"Shift" },
+	{ "D3+m5", "shr", { r_m16_32, CL },				"Shift" },
+	{ "D3+m6", "shl", { r_m16_32, CL },				"Shift" },
+	{ "D3+m7", "shr", { r_m16_32, CL },				"Shift" },
+	{ "D4", "aam", { AL, AH, imm8 },				"ASCII Adjust AX After Multiply" },
+	{ "D5", "aad", { AL, AH, imm8 },				"ASCII Adjust AX Before Division" },
+	{ "D6", "setalc", { AL },						"Set AL If Carry" },
+	{ "D7", "xlatb", { AL },						"Table Look-up Translation" },
+	{ "D8+m8", "fadd", { ST, STi },					"Add" },
+	{ "D8+m9", "fmul", { ST, STi },					"Multiply" },
+	{ "D8+mA", "fcom", { ST, STi },					"Compare Real" },
+	{ "D8+mB", "fcomp", { ST, STi },				"Compare Real and Pop" },
+	{ "D8+mC", "fsub", { ST, STi },					"Subtract" },
+	{ "D8+mD", "fsubr", { ST, STi },				"Reverse Subtract" },
+	{ "D8+mE", "fdiv", { ST, STi },					"Divide" },
+	{ "D8+mF", "fdivr", { ST, STi },				"Reverse Divide" },
+	{ "D8+m0", "fadd", { STi },						"Add" },
+	{ "D8+m1", "fmul", { STi },						"Multiply" },
+	{ "D8+m2", "fcom", { STi },						"Compare Real" },
+	{ "D8+m3", "fcomp", { STi },					"Compare Real and Pop" },
+	{ "D8+m4", "fsub", { STi },						"Subtract" },
+	{ "D8+m5", "fsubr", { STi },					"Reverse Subtract" },
+	{ "D8+m6", "fdiv", { STi },						"Divide" },
+	{ "D8+m7", "fdivr", { STi },					"Reverse Divide" },
+	{ "D9+m0", "fld", { STi },						"Load Floating Point Value" },
+	{ "D9+m1", "fxch", { STi },						"Exchange Register Contents" },
+	{ "D9+m2", "fst", { STi },						"Store Floating Point Value" },
+	{ "D9+m3", "fstp", { STi },						"Store Floating Point Value and Pop" },
+	{ "D9+m4", "fldenv", { STi },					"Load x87 FPU Environment" },
+	{ "D9+m5", "fldcw", { STi },					"Load x87 FPU Control Word" },
+	{ "D9+m6", "fnstenv", { STi },					"Store x87 FPU Environment" },
+	{ "D9+m7", "fnstcw", { STi },					"Store x87 FPU Control Word" },
+	{ "DA+m8", "fcmovb", { ST, STi },				"FP Conditional Move - below (CF=1)" },
+	{ "DA+m9", "fcmove", { ST, STi },				"FP Conditional Move - equal (ZF=1)" },
+	{ "DA+mA", "fcmovbe", { ST, STi },				"FP Conditional Move - below or equal (CF=1 or ZF=1)" },
+	{ "DA+mB", "fcmovu", { ST, STi },				"FP Conditional Move - unordered (PF=1)" },
+	{ "DA+mC", "fisub", { ST, STi },				"Subtract" },
+	{ "DA+mD", "fisubr", { ST, STi },				"Reverse Subtract" },
+	{ "DA+mE", "fidiv", { ST, STi },				"Divide" },
+	{ "DA+mF", "fidivr", { ST, STi },				"Reverse Divide" },
+	{ "DA+m0", "fiadd", { STi },					"Add" },
+	{ "DA+m1", "fimul", { STi },					"Multiply" },
+	{ "DA+m2", "ficom", { STi },					"Compare Real" },
+	{ "DA+m3", "ficomp", { STi },					"Compare Real and Pop" },
+	{ "DA+m4", "fisub", { STi },					"Subtract" },
+	{ "DA+m5", "fisubr", { STi },					"Reverse Subtract" },
+	{ "DA+m6", "fidiv", { STi },					"Divide" },
+	{ "DA+m7", "fidivr", { STi },					"Reverse Divide" },
+	{ "DB+m8", "fcmovnb", { ST, STi },				"FP Conditional Move - not below (CF=0)" },
+	{ "DB+m9", "fcmovne", { ST, STi },				"FP Conditional Move - not equal (ZF=0)" },
+	{ "DB+mA", "fcmovnbe", { ST, STi },				"FP Conditional Move - below or equal (CF=0 and ZF=0)" },
+	{ "DB+mB", "fcmovnu", { ST, STi },				"FP Conditional Move - not unordered (PF=0)" },
+	{ "DB+m0", "fild", { STi },						"Load Integer" },
+	{ "DB+m1", "fisttp", { STi },					"Store Integer with Truncation and Pop" },
+	{ "DB+m2", "fist", { STi },						"Store Integer" },
+	{ "DB+m3", "fistp", { STi },					"Store Integer and Pop" },
+	{ "DB+m4", "finit", { STi },					"Initialize Floating-Point Unit" },
+	{ "DB+m5", "fucomi", { STi },					"Unordered Compare Floating Point Values and Set EFLAGS" },
+	{ "DB+m6", "fcomi", { STi },					"Compare Floating Point Values and Set EFLAGS" },
+	{ "DB+m7", "fstp", { STi },						"Store Floating Point Value and Pop" },
+	{ "DC+m8", "fadd", { STi, ST },					"Add" },
+	{ "DC+m9", "fmul", { STi, ST },					"Multiply" },
+	{ "DC+mA", "fcom", { STi, ST },					"Compare Real" },
+	{ "DC+mB", "fcomp", { STi, ST },				"Compare Real and Pop" },
+	{ "DC+mC", "fsub", { STi, ST },					"Subtract" },
+	{ "DC+mD", "fsubr", { STi, ST },				"Reverse Subtract" },
+	{ "DC+mE", "fdiv", { STi, ST },					"Divide" },
+	{ "DC+mF", "fdivr", { STi, ST },				"Reverse Divide" },
+	{ "DC+m0", "fadd", { STi },						"Add" },
+	{ "DC+m1", "fmul", { STi },						"Multiply" },
+	{ "DC+m2", "fcom", { STi },						"Compare Real" },
+	{ "DC+m3", "fcomp", { STi },					"Compare Real and Pop" },
+	{ "DC+m4", "fsub", { STi },						"Subtract" },
+	{ "DC+m5", "fsubr", { STi },					"Reverse Subtract" },
+	{ "DC+m6", "fdiv", { STi },						"Divide" },
+	{ "DC+m7", "fdivr", { STi },					"Reverse Divide" },
+	{ "DD+m8", "ffree", { STi },					"Free Floating-Point Register" },
+	{ "DD+m0", "fld", { STi },						"Load Floating Point Value" },
+	{ "DD+m1", "fisttp", { STi },					"Store Integer with Truncation and Pop" },
+	{ "DD+m2", "fst", { STi },						"Store Floating Point Value" },
+	{ "DD+m3", "fstp", { STi },						"Store Floating Point Value and Pop" },
+	{ "DD+m4", "frstor", { STi },					"Restore x87 FPU State" },
+	{ "DD+m5", "fucomp", { STi },					"Unordered Compare Floating Point Values and Pop" },
+	{ "DD+m6", "fnsave", { STi },					"Store x87 FPU State" },
+	{ "DD+m7", "fnstsw", { STi },					"Store x87 FPU Status Word" },
+	{ "DE+m8", "faddp", { ST, STi },				"Add and Pop" },
+	{ "DE+m9", "fmulp", { ST, STi },				"Multiply and Pop" },
+	{ "DE+mA", "ficom", { ST, STi },				"Compare Real" },
+	{ "DE+mB", "ficomp", { ST, STi },				"Compare Real and Pop" },
+	{ "DE+mC", "fsubrp", { ST, STi },				"Reverse Subtract and Pop" },
+	{ "DE+mD", "fsubp", { ST, STi },				"Subtract and Pop" },
+	{ "DE+mE", "fdivrp", { ST, STi },				"Reverse Divide and Pop" },
+	{ "DE+mF", "fdivp", { ST, STi },				"Divide and Pop" },
+	{ "DE+m0", "fiadd", { STi },					"Add" },
+	{ "DE+m1", "fimul", { STi },					"Multiply" },
+	{ "DE+m2", "ficom", { STi },					"Compare Real" },
+	{ "DE+m3", "ficomp", { STi },					"Compare Real and Pop" },
+	{ "DE+m4", "fisub", { STi },					"Subtract" },
+	{ "DE+m5", "fisubr", { STi },					"Reverse Subtract" },
+	{ "DE+m6", "fidiv", { STi },					"Divide" },
+	{ "DE+m7", "fdivr", { STi },					"Reverse Divide" },
+	{ "DF+m8", "ffreep", { STi },					"Free Floating-Point Register and Pop" },
+	{ "DF+m9", "fisttp", { r32 },					"Store Integer with Truncation and Pop" },
+	{ "DF+mA", "fist", { STi },						"Store Integer" },
+	{ "DF+mB", "fistp", { STi },					"Store Integer and Pop" },
+	{ "DF+mC", "fnstsw", { STi },					"Store x87 FPU Status Word" },
+	{ "DF+mD", "fucomip", { ST, STi },				"Unordered Compare Floating Point Values and Set EFLAGS and Pop" },
+	{ "DF+mE", "fcomip", { ST, STi },				"Compare Floating Point Values and Set EFLAGS and Pop" },
+	{ "DF+mF", "fistp", { r64 },					"Store Integer and Pop" },
+	{ "DF+m0", "fild", { STi },						"Load Integer" },
+	{ "DF+m1", "fisttp", { STi },					"Store Integer with Truncation and Pop" },
+	{ "DF+m2", "fist", { STi },						"Store Integer" },
+	{ "DF+m3", "fistp", { STi },					"Store Integer and Pop" },
+	{ "DF+m4", "fbld", { STi },						"Load Binary Coded Decimal" },
+	{ "DF+m5", "fild", { STi },						"Load Integer" },
+	{ "DF+m6", "fbstp", { STi },					"Store BCD Integer and Pop" },
+	{ "DF+m7", "fistp", { STi },					"Store Integer and Pop" },
+	{ "E0", "loopne", { ECX, rel8 },				"Decrement count; Jump short if count!=0 and ZF=0" },
+	{ "E1", "loope", { ECX, rel8 },					"Decrement count; Jump short if count!=0 and ZF=1" },
+	{ "E2", "loop", { ECX, rel8 },					"Decrement count; Jump short if count!=0" },
+	{ "E3", "jecxz", { rel8 },						"Jump short if eCX register is 0" },
+	{ "E4", "in", { AL, imm8 },						"Input from Port" },
+	{ "E5", "in", { EAX, imm8 },					"Input from Port" },
+	{ "E6", "out", { imm8, AL },					"Output to Port" },
+	{ "E7", "out", { imm8, EAX },					"Output to Port" },
+	{ "E8", "call", { rel16_32 },					"Call Procedure" },
+	{ "E9", "jmp", { rel16_32 },					"Jump" },
+	{ "EA", "jmpf", { ptr16_32 },					"Jump" },
+	{ "EB", "jmp short", { rel8 },					"Jump" },
+	{ "EC", "in", { AL, DX },						"Input from Port" },
+	{ "ED", "in", { EAX, DX },						"Input from Port" },
+	{ "EE", "out", { DX, AL },						"Output to Port" },
+	{ "EF", "out", { DX, EAX },						"Output to Port" },
+	{ "F1", "int 1", {  },							"Call to Interrupt Procedure" },
+	{ "F4", "hlt", {  },							"Halt" },
+	{ "F5", "cmc", {  },							"Complement Carry Flag" },
+	{ "F6+m0", "test", { r_m8, imm8 },				"Logical Compare" },
+	{ "F6+m1", "test", { r_m8, imm8 },				"Logical Compare" },
+	{ "F6+m2", "not", { r_m8 },						"One's Complement Negation" },
+	{ "F6+m3", "neg", { r_m8 },						"Two's Complement Negation" },
+	{ "F6+m4", "mul", { AX, AL, r_m8 },				"Unsigned Multiply" },
+	{ "F6+m5", "imul", { AX, AL, r_m8 },			"Signed Multiply" },
+	{ "F6+m6", "div", { AX, AL, AX, r_m8 },			"Unigned Divide" },
+	{ "F6+m7", "idiv", { AX, AL, AX, r_m8 },		"Signed Divide" },
+	{ "F7+m0", "test", { r_m16_32, imm16_32 },		"Logical Compare" },
+	{ "F7+m1", "test", { r_m16_32, imm16_32 },		"Logical Compare" },
+	{ "F7+m2", "not", { r_m16_32 },					"One's Complement Negation" },
+	{ "F7+m3", "neg", { r_m16_32 },					"Two's Complement Negation" },
+	{ "F7+m4", "mul", { EDX, EAX, r_m16_32 },		"Unsigned Multiply" },
+	{ "F7+m5", "imul", { EDX, EAX, r_m16_32 },		"Signed Multiply" },
+	{ "F7+m6", "div", { EDX, EAX, r_m16_32 },		"Unigned Divide" },
+	{ "F7+m7", "idiv", { EDX, EAX, r_m16_32 },		"Signed Divide" },
+	{ "F8", "clc", {  },							"Clear Carry Flag" },
+	{ "F9", "stc", {  },							"Set Carry Flag" },
+	{ "FA", "cli", {  },							"Clear Interrupt Flag" },
+	{ "FB", "sti", {  },							"Set Interrupt Flag" },
+	{ "FC", "cld", {  },							"Clear Direction Flag" },
+	{ "FD", "std", {  },							"Set Direction Flag" },
+	{ "FE+m0", "inc", { r_m8 },						"Increment by 1" },
+	{ "FE+m1", "dec", { r_m8 },						"Decrement by 1" },
+	{ "FE+mE", "inc", { r_m8 },						"Increment by 1" },
+	{ "FE+mF", "dec", { r_m8 },						"Decrement by 1" },
+	{ "FF+m0", "inc", { r_m16_32 },					"Increment by 1" },
+	{ "FF+m1", "dec", { r_m16_32 },					"Decrement by 1" },
+	{ "FF+m2", "call", { r_m16_32 },				"Call Procedure" },
+	{ "FF+m3", "callf", { m16_32_and_16_32 },		"Call Procedure" },
+	{ "FF+m4", "jmp", { r_m16_32 },					"Jump" },
+	{ "FF+m5", "jmpf", { m16_32_and_16_32 },		"Jump" },
+	{ "FF+m6", "push", { r_m16_32 },				"Push Word, Doubleword or Quadword Onto the Stack" },
+	{ "FF+m7", "push", { r_m16_32 },				"Push Word, Doubleword or Quadword Onto the Stack" },
+
+	{ "63", "movsxd", { r16_32, r_m32 },			"Move with Sign-Extension" }, // 64-bit mode only (arpl in 32-bit mode)
+};
+
+
+// Compiled dispatch index for disa_optable.
+// Every node maps the next instruction byte to the earliest
+// row in the table that matches at that point, and/or to a
+// deeper node when more bytes are needed to tell rows apart.
+// Node 0 is the primary (one-byte) map. The 0F, 0F 38 and 0F 3A
+// maps and the ModRM sub-tables of "+m" groups are its children.
+struct disa_opnode_entry
+{
+	std::uint16_t row;
+	std::uint16_t next;
+};
+
+typedef std::array<disa_opnode_entry, 256> disa_opnode;
+
+constexpr std::uint16_t DISA_NO_NODE = 0xFFFF;
+
+constexpr std::size_t disa_optable_size = sizeof(disa_optable) / sizeof(disa_optable[0]);
+
+constexpr bool disa_streq(const char* a, const char* b)
+{
+	while (*a && *a == *b)
+	{
+		a++;
+		b++;
+	}
+
+	return *a == *b;
+}
+
+// disa_ids.hpp is generated from the table (Tools/disa_ids.py)
+constexpr bool disa_ids_match()
+{
+	for (std::size_t n = 0; n < disa_optable_size; n++)
+	{
+		if (!disa_streq(disa_mnemonic_names[disa_form_mnemonics[n]], disa_optable[n].opcode_name))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static_assert(FORM_COUNT == disa_optable_size, "disa_ids.hpp is out of date, run Tools/disa_ids.py");
+static_assert(FORM_NONE == DISA_NO_ROW, "FORM_NONE should be DISA_NO_ROW");
+static_assert(disa_ids_match(), "disa_ids.hpp is out of date, run Tools/disa_ids.py");
+
+static std::uint16_t disa_new_node(std::vector<disa_opnode>& nodes, const std::uint16_t fallback_row)
+{
+	disa_opnode node;
+	node.fill({ fallback_row, DISA_NO_NODE });
+
+	nodes.push_back(node);
+	return static_cast<std::uint16_t>(nodes.size() - 1);
+}
+
+// makes `row` the match for every byte sequence
+// that passes through this entry
+static void disa_paint(std::vector<disa_opnode>& nodes, const std::uint16_t node, const std::uint8_t b, const std::uint16_t row)
+{
+	nodes[node][b].row = row;
+
+	const auto next = nodes[node][b].next;
+	if (next != DISA_NO_NODE)
+	{
+		for (std::size_t i = 0; i < 256; i++)
+		{
+			disa_paint(nodes, next, static_cast<std::uint8_t>(i), row);
+		}
+	}
+}
+
+static std::uint16_t disa_child(std::vector<disa_opnode>& nodes, const std::uint16_t node, const std::uint8_t b)
+{
+	if (nodes[node][b].next == DISA_NO_NODE)
+	{
+		// whatever matched here already still matches
+		// when the next byte doesn't lead anywhere else
+		const auto next = disa_new_node(nodes, nodes[node][b].row);
+		nodes[node][b].next = next;
+	}
+
+	return nodes[node][b].next;
+}
+
+// One-byte opcodes that don't exist in 64-bit mode (besides 40-4F,
+// which are REX prefixes there). C4 and C5 are VEX prefixes
+static bool disa_invalid_64(const std::uint8_t opcode)
+{
+	switch (opcode)
+	{
+	case 0x06: case 0x07: case 0x0E: case 0x16: case 0x17: case 0x1E: case 0x1F:
+	case 0x27: case 0x2F: case 0x37: case 0x3F: case 0x60: case 0x61: case 0x62:
+	case 0x82: case 0x9A: case 0xC4: case 0xC5: case 0xCE: case 0xD4: case 0xD5:
+	case 0xD6: case 0xEA:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Whether row `n` of the table exists in `mode`.
+// In 64-bit mode 63 is movsxd rather than arpl
+static bool disa_row_in_mode(const std::size_t n, const disa_mode mode)
+{
+	if (mode != DISA_MODE_64)
+	{
+		return n != FORM_MOVSXD_R16_32_RM32;
+	}
+
+	const std::uint8_t opcode = disa_optable[n].bytes[0];
+
+	if (opcode == 0x63)
+	{
+		return n == FORM_MOVSXD_R16_32_RM32;
+	}
+
+	return !disa_invalid_64(opcode) && (opcode & 0xF0) != 0x40;
+}
+
+static std::vector<disa_opnode> disa_compile(const disa_mode mode)
+{
+	std::vector<disa_opnode> nodes;
+	nodes.reserve(128);
+
+	disa_new_node(nodes, DISA_NO_ROW);
+
+	// Rows are compiled in reverse, so that earlier rows overwrite
+	// later ones. This keeps the first-match order of the table.
+	for (std::size_t n = disa_optable_size; n-- > 0;)
+	{
+		if (!disa_row_in_mode(n, mode))
+		{
+			continue;
+		}
+
+		const auto row = static_cast<std::uint16_t>(n);
+		const auto& op_info = disa_optable[n];
+
+		std::uint16_t node = 0;
+		for (std::size_t i = 0; i < op_info.nbytes - 1u; i++)
+		{
+			node = disa_child(nodes, node, op_info.bytes[i]);
+		}
+
+		const std::uint8_t last = op_info.bytes[op_info.nbytes - 1];
+
+		if (op_info.group == 'r')
+		{
+			// this simple check can simplify instructons like inc/dec/push/pop
+			// All we have to put is put `40+r` (rather than 40, 41, 42, 43,...)
+			for (std::uint8_t r = 0; r < 8; r++)
+			{
+				disa_paint(nodes, node, static_cast<std::uint8_t>(last + r), row);
+			}
+		}
+		else if (op_info.group == 'm')
+		{
+			// for every +8 it switches to a different opcode out of 8.
+			// m8-mF only apply IF the mode is 3 / the byte is >= 0xC0
+			const std::uint8_t n_reg = op_info.group_reg;
+
+			node = disa_child(nodes, node, last);
+
+			for (std::size_t modrm = 0; modrm < 256; modrm++)
+			{
+				if (n_reg < 8 ? (modrm / 8 % 8 == n_reg) : (modrm / 8 % 8 == n_reg - 8u && modrm >= 0xC0))
+				{
+					disa_paint(nodes, node, static_cast<std::uint8_t>(modrm), row);
+				}
+			}
+		}
+		else
+		{
+			disa_paint(nodes, node, last, row);
+		}
+	}
+
+	nodes.shrink_to_fit();
+	return nodes;
+}
+
+// The compiled dispatch index. It's never changed once it's built,
+// so any number of threads and disa_decoder objects can share it
+struct disa_index
+{
+	std::vector<disa_opnode> nodes;
+	disa_mode mode;
+};
+
+// One per mode, compiled on first use (thread-safe static init)
+static const disa_index& disa_mode_index(const disa_mode mode)
+{
+	if (mode == DISA_MODE_64)
+	{
+		static const disa_index index = { disa_compile(DISA_MODE_64), DISA_MODE_64 };
+		return index;
+	}
+
+	static const disa_index index = { disa_compile(DISA_MODE_32), DISA_MODE_32 };
+	return index;
+}
+
+// Returns the row in disa_optable for the opcode at `at`
+// (after any skipped prefix), or DISA_NO_ROW
+static std::uint16_t disa_lookup(const disa_index& index, const std::uint8_t* at)
+{
+	const auto& nodes = index.nodes;
+	std::uint16_t row = DISA_NO_ROW;
+
+	for (std::uint16_t node = 0; node != DISA_NO_NODE; at++)
+	{
+		const auto& entry = nodes[node][*at];
+		row = entry.row;
+		node = entry.next;
+	}
+
+	return row;
+}
+
 bool disa_load()
 {
-	disa_optable = 
-	{
-		{ "00", "add", { r_m8, r8 },					"Add" },
-		{ "01", "add", { r_m16_32, r16_32 },			"Add" },
-		{ "02", "add", { r8, r_m8 },					"Add" },
-		{ "03", "add", { r16_32, r_m16_32 },			"Add" },
-		{ "04", "add", { AL, imm8 },					"Add" },
-		{ "05", "add", { EAX, imm16_32 },				"Add" },
-		{ "06", "push", { ES },							"Push Extra Segment onto the stack" },
-		{ "07", "pop", { ES },							"Pop Extra Segment off of the stack" },
-		{ "08", "or", { r_m8, r8 },						"Logical Inclusive OR" },
-		{ "09", "or", { r_m16_32, r16_32 },				"Logical Inclusive OR" },
-		{ "0A", "or", { r8, r_m8 },						"Logical Inclusive OR" },
-		{ "0B", "or", { r16_32, r_m16_32 },				"Logical Inclusive OR" },
-		{ "0C", "or", { AL, imm8 },						"Logical Inclusive OR" },
-		{ "0D", "or", { EAX, imm16_32 },				"Logical Inclusive OR" },
-		{ "0E", "push", { CS },							"Push Code Segment onto the stack" },
-		{ "0F+00+m0", "sldt", { r_m16_32 },				"Store Local Descriptor Table Register" },
-		{ "0F+00+m1", "str", { r_m16 },					"Store Task Register" },
-		{ "0F+00+m2", "lldt", { r_m16 },				"Load Local Descriptor Table Register" },
-		{ "0F+00+m3", "ltr", { r_m16 },					"Load Task Register" },
-		{ "0F+00+m4", "verr", { r_m16 },				"Verify a Segment for Reading" },
-		{ "0F+00+m5", "verw", { r_m16 },				"Verify a Segment for Writing" },
-		{ "0F+01+C1", "vmcall", {  },					"Call to VM Monitor" },
-		{ "0F+01+C2", "vmlaunch", {  },					"Launch Virtual Machine" },
-		{ "0F+01+C3", "vmresume", {  },					"Resume Virtual Machine" },
-		{ "0F+01+C4", "vmxoff", {  },					"Leave VMX Operation" },
-		{ "0F+01+C8", "monitor", {  },					"Set Up Monitor Address" },
-		{ "0F+01+C9", "mwait", {  },					"Monitor Wait" },
-		{ "0F+01+CA", "clac", {  },						"Clear AC flag in EFLAGS register" },
-		{ "0F+01+m0", "sgdt", { r_m16_32 },				"Store Global Descriptor Table Register" },
-		{ "0F+01+m1", "sidt", { r_m16_32 },				"Store Interrupt Descriptor Table Register" },
-		{ "0F+01+m2", "lgdt", { r_m16_32 },				"Load Global Descriptor Table Register" },
-		{ "0F+01+m3", "lidt", { r_m16_32 },				"Load Interrupt Descriptor Table Register" },
-		{ "0F+01+m4", "smsw", { r_m16_32 },				"Store Machine Status Word" },
-		{ "0F+01+m5", "smsw", { r_m16_32 },				"Store Machine Status Word" },
-		{ "0F+01+m6", "lmsw", { r_m16_32 },				"Load Machine Status Word" },
-		{ "0F+01+m7", "invplg", { r_m16_32 },			"Invalidate TLB Entry" },
-		{ "0F+02", "lar", { r16_32, m16 },				"Load Access Rights Byte" }, // possibly m8 or m16_32 ..
-		{ "0F+03", "lsl", { r16_32, m16 },				"Load Segment Limit" },  // possibly m8 or m16_32 ..
-		{ "0F+04", "ud", {  },							"Undefined Instruction" },
-		{ "0F+05", "syscall", {  },						"Fast System Call" },
-		{ "0F+06", "clts", { CR0 },						"Clear Task-Switched Flag in CR0" },
-		{ "0F+07", "sysret", {  },						"Return form fast system call" },
-		{ "0F+08", "invd", {  },						"Invalidate Internal Caches" },
-		{ "0F+09", "wbinvd", {  },						"Write Back and Invalidate Cache" },
-		{ "0F+0B", "ud2", {  },							"Undefined Instruction" },
-		{ "0F+0D", "nop", { r_m16_32 },					"No Operation" },
-		{ "0F+10", "movups", { xmm, xmm_m128 },			"Move Unaligned Packed Single-FP Values" },
-		{ "F3+0F+10", "movss", { xmm, xmm_m32 },		"Move Scalar Single-FP Values" },
-		{ "66+0F+10", "movupd", { xmm, xmm_m128 },		"Move Unaligned Packed Double-FP Value" },
-		{ "F2+0F+10", "movsd", { xmm, xmm_m64 },		"Move Scalar Double-FP Value" },
-		{ "0F+11", "movups", { xmm_m128, xmm },			"Move Unaligned Packed Single-FP Values" },
-		{ "F3+0F+11", "movss", { xmm_m32, xmm },		"Move Scalar Single-FP Values" },
-		{ "66+0F+11", "movupd", { xmm_m128, xmm },		"Move Unaligned Packed Double-FP Value" },
-		{ "F2+0F+11", "movsd", { xmm_m64, xmm },		"Move Scalar Double-FP Value" },
-		{ "0F+12", "movhlps", { xmm, xmm },				"Move Packed Single-FP Values High to Low" },
-		{ "0F+12", "movlps", { xmm, m64 },				"Move Low Packed Single-FP Values" },
-		{ "F3+0F+12", "movlpd", { xmm, m64 },			"Move Low Packed Double-FP Value" },
-		{ "66+0F+12", "movddup", { xmm, xmm_m64 },		"Move One Double-FP and Duplicate" },
-		{ "F2+0F+12", "movsldup", { xmm, xmm_m64 },		"Move Packed Single-FP Low and Duplicate" },
-		{ "0F+13", "movlps", { m64, xmm },				"Move Low Packed Single-FP Values" },
-		{ "66+0F+13", "movlpd", { m64, xmm },			"Move Low Packed Double-FP Value" },
-		{ "0F+14", "unpcklps", { xmm, xmm_m64 },		"Unpack and Interleave Low Packed Single-FP Values" },
-		{ "66+0F+14", "unpcklpd", { xmm, xmm_m128 },	"Unpack and Interleave Low Packed Double-FP Values" },
-		{ "0F+15", "unpckhps", { xmm, xmm_m64 },		"Unpack and Interleave High Packed Single-FP Values" },
-		{ "66+0F+15", "unpckhpd", { xmm, xmm_m128 },	"Unpack and Interleave High Packed Double-FP Values" },
-		{ "0F+16", "movlhps", { xmm, xmm },				"Move Packed Single-FP Values Low to High" },
-		{ "0F+16", "movhps", { xmm, m64 },				"Move High Packed Single-FP Values" },
-		{ "66+0F+16", "movhpd", { xmm, m64 },			"Move High Packed Double-FP Value" },
-		{ "F3+0F+16", "movshdup", { xmm, xmm_m64 },		"Move Packed Single-FP High and Duplicate" },
-		{ "0F+17", "movhps", { m64, xmm },				"Move High Packed Single-FP Values" },
-		{ "66+0F+17", "movhpd", { m64, xmm },			"Move High Packed Double-FP Value" },
-		{ "0F+18+m0", "prefetchnta", { m8 },			"Prefetch Data Into Caches" },
-		{ "0F+18+m1", "prefetcht0", { m8 },				"Prefetch Data Into Caches" },
-		{ "0F+18+m2", "prefetcht1", { m8 },				"Prefetch Data Into Caches" },
-		{ "0F+18+m3", "prefetcht2", { m8 },				"Prefetch Data Into Caches" },
-		{ "0F+18+m4", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+18+m5", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+18+m6", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+18+m7", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+19", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+1A", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+1B", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+1C", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+1D", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+1E", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+1F+m0", "nop", { r_m16_32 },				"No Operation" },
-		{ "0F+1F+m1", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+1F+m2", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+1F+m3", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+1F+m4", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+1F+m5", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+1F+m6", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+1F+m7", "hint_nop", { r_m16_32 },			"Hintable NOP" },
-		{ "0F+20", "mov", { r_m32, CRn },				"Move to/from Control Registers" },
-		{ "0F+21", "mov", { r_m32, DRn },				"Move to/from Debug Registers" },
-		{ "0F+22", "mov", { CRn, r_m32 },				"Move to/from Control Registers" },
-		{ "0F+23", "mov", { DRn, r_m32,  },				"Move to/from Debug Registers" },
-		{ "0F+28", "movaps", { xmm, xmm_m128,  },		"Move Aligned Packed Single-FP Values" },
-		{ "66+0F+28", "movapd", { xmm, xmm_m128,  },	"Move Aligned Packed Double-FP Values" },
-		{ "0F+29", "movaps", { xmm_m128, xmm,  },		"Move Aligned Packed Single-FP Values" },
-		{ "66+0F+29", "movapd", { xmm_m128, xmm,  },	"Move Aligned Packed Double-FP Values" },
-		{ "0F+2A", "cvtpi2ps", { xmm, mm_m64 },			"Convert Packed DW Integers to Single-FP Values" },
-		{ "F3+0F+2A", "cvtpi2ss", { xmm, r_m32 },		"Convert DW Integer to Scalar Single-FP Value" },
-		{ "66+0F+2A", "cvtpi2pd", { xmm, mm_m64 },		"Convert Packed DW Integers to Double-FP Values" },
-		{ "F2+0F+2A", "cvtpi2sd", { xmm, r_m32 },		"Convert DW Integer to Scalar Double-FP Value" },
-		{ "0F+2B", "movntps", { m128, xmm },			"Store Packed Single-FP Values Using Non-Temporal Hint" },
-		{ "66+0F+2B", "movntpd", { m128, xmm },			"Store Packed Double-FP Values Using Non-Temporal Hint" },
-		{ "0F+2C", "cvttps2pi", { mm, xmm_m64 },		"Convert with Trunc. Packed Single-FP Values to DW Integers" },
-		{ "F3+0F+2C", "cvttss2si", { r32, xmm_m32 },	"Convert with Trunc. Scalar Single-FP Value to DW Integer" },
-		{ "66+0F+2C", "cvttpd2pi", { mm, xmm_m128 },	"Convert with Trunc. Packed Double-FP Values to DW Integers" },
-		{ "F2+0F+2C", "cvttsd2si", { r32, xmm_m64 },	"Convert with Trunc. Scalar Double-FP Value to Signed DW Int" },
-		{ "0F+2D", "cvtps2pi", { mm, xmm_m64 },			"Convert Packed Single-FP Values to DW Integers" },
-		{ "F3+0F+2D", "cvtss2si", { r32, xmm_m32 },		"Convert Scalar Single-FP Value to DW Integer" },
-		{ "66+0F+2D", "cvtpd2pi", { mm, xmm_m128 },		"Convert Packed Double-FP Values to DW Integers" },
-		{ "F2+0F+2D", "cvtsd2si", { r32, xmm_m64 },		"Convert Scalar Double-FP Value to DW Integer" },
-		{ "0F+2E", "ucomiss", { xmm, xmm_m32 },			"Unordered Compare Scalar Ordered Single-FP Values and Set EFLAGS" },
-		{ "66+0F+2E", "ucomisd", { xmm, xmm_m64 },		"Unordered Compare Scalar Ordered Double-FP Values and Set EFLAGS" },
-		{ "0F+2F", "comiss", { xmm, xmm_m32 },			"Compare Scalar Ordered Single-FP Values and Set EFLAGS" },
-		{ "66+0F+2F", "comisd", { xmm, xmm_m64 },		"Compare Scalar Ordered Double-FP Values and Set EFLAGS" },
-		{ "0F+30", "wrmsr", {  },						"Write to Model Specific Register" },
-		{ "0F+31", "rdtsc", {  },						"Read Time-Stamp Counter" },
-		{ "0F+32", "rdmsr", {  },						"Read from Model Specific Register" },
-		{ "0F+33", "rdpmc", {  },						"Read Performance-Monitoring Counters" },
-		{ "0F+34", "sysenter", {  },					"Fast System Call" },
-		{ "0F+35", "sysexit", {  },						"Fast Return from Fast System Call" },
-		{ "0F+37", "getsec", {  },						"GETSEC Leaf Functions" },
-		{ "0F+38+00", "pshufb", { mm, mm_m64 },			"Packed Shuffle Bytes" },
-		{ "66+0F+38+00", "pshufb", { xmm, xmm_m128 },	"Packed Shuffle Bytes" },
-		{ "0F+38+01", "phaddw", { mm, mm_m64 },			"Packed Horizontal Add" },
-		{ "66+0F+38+01", "phaddw", { xmm, xmm_m128 },	"Packed Horizontal Add" },
-		{ "0F+38+02", "phaddd", { mm, mm_m64 },			"Packed Horizontal Add" },
-		{ "66+0F+38+02", "phaddd", { xmm, xmm_m128 },	"Packed Horizontal Add" },
-		{ "0F+38+03", "phaddsw", { mm, mm_m64 },		"Packed Horizontal Add and Saturate" },
-		{ "66+0F+38+03", "phaddsw", { xmm, xmm_m128 },	"Packed Horizontal Add and Saturate" },
-		{ "0F+38+04", "pmaddubsw", { mm, mm_m64 },		"Multiply and Add Packed Signed and Unsigned Bytes" },
-		{ "66+0F+38+04", "pmaddubsw", { xmm, xmm_m128 },"Multiply and Add Packed Signed and Unsigned Bytes" },
-		{ "0F+38+05", "phsubw", { mm, mm_m64 },			"Packed Horizontal Subtract" },
-		{ "66+0F+38+05", "phsubw", { xmm, xmm_m128 },	"Packed Horizontal Subtract" },
-		{ "0F+38+06", "phsubd", { mm, mm_m64 },			"Packed Horizontal Subtract" },
-		{ "66+0F+38+06", "phsubd", { xmm, xmm_m128 },	"Packed Horizontal Subtract" },
-		{ "0F+38+07", "phsubsw", { mm, mm_m64 },		"Packed Horizontal Subtract and Saturate" },
-		{ "66+0F+38+07", "phsubsw", { xmm, xmm_m128 },	"Packed Horizontal Subtract and Saturate" },
-		{ "0F+38+08", "psignb", { mm, mm_m64 },			"Packed SIGN" },
-		{ "66+0F+38+08", "psignb", { xmm, xmm_m128 },	"Packed SIGN" },
-		{ "0F+38+09", "psignw", { mm, mm_m64 },			"Packed SIGN" },
-		{ "66+0F+38+09", "psignw", { xmm, xmm_m128 },	"Packed SIGN" },
-		{ "0F+38+0A", "psignd", { mm, mm_m64 },			"Packed SIGN" },
-		{ "66+0F+38+0A", "psignd", { xmm, xmm_m128 },	"Packed SIGN" },
-		{ "0F+38+0B", "pmulhrsw", { mm, mm_m64 },		"Packed Multiply High with Round and Scale" },
-		{ "66+0F+38+0B", "pmulhrsw", { xmm, xmm_m128 },	"Packed Multiply High with Round and Scale" },
-		{ "66+0F+38+10", "pblendvb",{xmm,xmm_m128,xmm0},"Variable Blend Packed Bytes" },
-		{ "66+0F+38+14", "blendvps",{xmm,xmm_m128,xmm0},"Variable Blend Packed Single-FP Values" },
-		{ "66+0F+38+15", "blendvpd",{xmm,xmm_m128,xmm0},"Variable Blend Packed Double-FP Values" },
-		{ "66+0F+38+17", "ptest",{ xmm, xmm_m128 },		"Logical Compare" },
-		{ "0F+38+1C", "pabsb", { mm, mm_m64 },			"Packed Absolute Value" },
-		{ "66+0F+38+1C", "pabsb", { xmm, xmm_m128 },	"Packed Absolute Value" },
-		{ "0F+38+1D", "pabsw", { mm, mm_m64 },			"Packed Absolute Value" },
-		{ "66+0F+38+1D", "pabsw", { xmm, xmm_m128 },	"Packed Absolute Value" },
-		{ "0F+38+1E", "pabsd", { mm, mm_m64 },			"Packed Absolute Value" },
-		{ "66+0F+38+1E", "pabsd", { xmm, xmm_m128 },	"Packed Absolute Value" },
-		{ "66+0F+38+20", "pmovsxbw", { xmm, m64 },		"Packed Move with Sign Extend" },
-		{ "66+0F+38+21", "pmovsxbd", { xmm, m32 },		"Packed Move with Sign Extend" },
-		{ "66+0F+38+22", "pmovsxbq", { xmm, m16 },		"Packed Move with Sign Extend" },
-		{ "66+0F+38+23", "pmovsxbd", { xmm, m64 },		"Packed Move with Sign Extend" },
-		{ "66+0F+38+24", "pmovsxbq", { xmm, m32 },		"Packed Move with Sign Extend" },
-		{ "66+0F+38+25", "pmovsxdq", { xmm, m64 },		"Packed Move with Sign Extend" },
-		{ "66+0F+38+28", "pmuldq", { xmm, xmm_m128 },	"Multiply Packed Signed Dword Integers" },
-		{ "66+0F+38+29", "pcmpeqq", { xmm, xmm_m128 },	"Compare Packed Qword Data for Equal" },
-		{ "66+0F+38+2A", "movntdqa", { xmm, m128 },		"Load Double Quadword Non-Temporal Aligned Hint" },
-		{ "66+0F+38+2B", "packusdw", { xmm, xmm_m128 },	"Pack with Unsigned Saturation" },
-		{ "66+0F+38+30", "pmovzxbw", { xmm, m64 },		"Packed Move with Zero Extend" },
-		{ "66+0F+38+31", "pmovzxbd", { xmm, m32 },		"Packed Move with Zero Extend" },
-		{ "66+0F+38+32", "pmovzxbq", { xmm, m16 },		"Packed Move with Zero Extend" },
-		{ "66+0F+38+33", "pmovzxbd", { xmm, m64 },		"Packed Move with Zero Extend" },
-		{ "66+0F+38+34", "pmovzxbq", { xmm, m32 },		"Packed Move with Zero Extend" },
-		{ "66+0F+38+35", "pmovzxbq", { xmm, m64 },		"Packed Move with Zero Extend" },
-		{ "66+0F+38+37", "pcmpgtq", { xmm, xmm_m128 },	"Compare Packed Qword Data for Greater Than" },
-		{ "66+0F+38+38", "pminsb", { xmm, xmm_m128 },	"Minimum of Packed Signed Byte Integers" },
-		{ "66+0F+38+39", "pminsd", { xmm, xmm_m128 },	"Minimum of Packed Signed Dword Integers" },
-		{ "66+0F+38+3A", "pminuw", { xmm, xmm_m128 },	"Minimum of Packed Unsigned Word Integers" },
-		{ "66+0F+38+3B", "pminud", { xmm, xmm_m128 },	"Minimum of Packed Unsigned Dword Integers" },
-		{ "66+0F+38+3C", "pmaxsb", { xmm, xmm_m128 },	"Maximum of Packed Signed Byte Integers" },
-		{ "66+0F+38+3D", "pmaxsd", { xmm, xmm_m128 },	"Maximum of Packed Signed Dword Integers" },
-		{ "66+0F+38+3E", "pmaxuw", { xmm, xmm_m128 },	"Maximum of Packed Unsigned Word Integers" },
-		{ "66+0F+38+3F", "pmaxud", { xmm, xmm_m128 },	"Maximum of Packed Unsigned Dword Integers" },
-		{ "66+0F+38+40", "pmulld", { xmm, xmm_m128 },	"Multiply Packed Signed Dword Integers and Store Low Result" },
-		{ "66+0F+38+41", "phminposuw",{ xmm, xmm_m128 },"Packed Horizontal Word Minimum" },
-		{ "66+0F+38+80", "invept", { r32, m128 },		"Invalidate Translations Derived from EPT" },
-		{ "66+0F+38+81", "invvpid", { r32, m128 },		"Invalidate Translations Based on VPID" },
-		{ "0F+38+F0", "movbe", { r16_32, m16_32 },		"Move Data After Swapping Bytes" },
-		{ "F2+0F+38+F0", "crc32", { r32, r_m8 },		"Accumulate CRC32 Value" },
-		{ "0F+38+F1", "movbe", { m16_32, r16_32 },		"Move Data After Swapping Bytes" },
-		{ "F2+0F+38+F1", "crc32", { r32, r_m16_32 },	"Accumulate CRC32 Value" },
-		{ "66+0F+3A+08","roundps",{ xmm,xmm_m128,imm8 },"Round Packed Single-FP Values" },
-		{ "66+0F+3A+09","roundpd",{ xmm,xmm_m128,imm8 },"Round Packed Double-FP Values" },
-		{ "66+0F+3A+0A", "roundss",{ xmm,xmm_m32,imm8 },"Round Scalar Single-FP Values" },
-		{ "66+0F+3A+0B", "roundsd",{ xmm,xmm_m64,imm8 },"Round Scalar Double-FP Values" },
-		{ "66+0F+3A+0C","blendps",{ xmm,xmm_m128,imm8 },"Round Packed Single-FP Values" },
-		{ "66+0F+3A+0D","blendpd",{ xmm,xmm_m128,imm8 },"Round Packed Double-FP Values" },
-		{ "66+0F+3A+0E","pblendw",{ xmm,xmm_m128,imm8 },"Blend Packed Words" },
-		{ "0F+3A+0F", "palignr", { mm, mm_m64 },		"Packed Align Right" },
-		{ "66+0F+3A+0F", "palignr", { mm, xmm_m128 },	"Packed Align Right" },
-		{ "66+0F+3A+14", "pextrb", { m8, xmm, imm8 },	"Extract Byte" },
-		{ "66+0F+3A+15", "pextrw", { m16, xmm, imm8 },	"Extract Word" },
-		{ "66+0F+3A+16", "pextrd", { m32, xmm, imm8 },	"Extract Dword/Qword" },
-		{ "66+0F+3A+17", "extractps",{ m64, xmm, imm8 },"Extract Packed Single-FP Value" },
-		{ "66+0F+3A+20", "pinsrb", { xmm, m8, imm8 },	"Insert Byte" },
-		{ "66+0F+3A+21", "insertps", { xmm, m32, imm8 },"Insert Packed Single-FP Value" },
-		{ "66+0F+3A+22", "pinsrd", { xmm, m64, imm8 },	"Insert Dword/Qword" },
-		{ "66+0F+3A+40", "dpps", { xmm, xmm_m128 },		"Dot Product of Packed Single-FP Values" },
-		{ "66+0F+3A+41", "dppd", { xmm, xmm_m128 },		"Dot Product of Packed Double-FP Values" },
-		{ "66+0F+3A+42","mpsadbw",{xmm, xmm_m128, imm8},"Compute Multiple Packed Sums of Absolute Difference" },
-		{ "66+0F+3A+60","pcmpestrm",{xmm0,xmm,xmm_m128},"Packed Compare Explicit Length Strings, Return Mask" },
-		{ "66+0F+3A+61","pcmpestri",{ECX,xmm,xmm_m128},	"Packed Compare Explicit Length Strings, Return Index" },
-		{ "66+0F+3A+62","pcmpistrm",{xmm0,xmm,xmm_m128,imm8},"Packed Compare Implicit Length Strings, Return Mask" },
-		{ "66+0F+3A+63","pcmpistri",{ECX,xmm,xmm_m128, imm8},"Packed Compare Implicit Length Strings, Return Index" },
-		{ "0F+40", "cmovo", { r16_32, r_m16_32 },		"Conditional Move - overflow (OF=1)" },
-		{ "0F+41", "cmovno", { r16_32, r_m16_32 },		"Conditional Move - not overflow (OF=0)" },
-		{ "0F+42", "cmovb", { r16_32, r_m16_32 },		"Conditional Move - below/not above or equal/carry (CF=1)" },
-		{ "0F+43", "cmovnb", { r16_32, r_m16_32 },		"Conditional Move - onot below/above or equal/not carry (CF=0)" },
-		{ "0F+44", "cmove", { r16_32, r_m16_32 },		"Conditional Move - zero/equal (ZF=1)" },
-		{ "0F+45", "cmovne", { r16_32, r_m16_32 },		"Conditional Move - not zero/not equal (ZF=0)" },
-		{ "0F+46", "cmovbe", { r16_32, r_m16_32 },		"Conditional Move - below or equal/not above (CF=1 OR ZF=1)" },
-		{ "0F+47", "cmova", { r16_32, r_m16_32 },		"Conditional Move - not below or equal/above (CF=0 AND ZF=0)" },
-		{ "0F+48", "cmovs", { r16_32, r_m16_32 },		"Conditional Move - sign (SF=1)" },
-		{ "0F+49", "cmovns", { r16_32, r_m16_32 },		"Conditional Move - not sign (SF=0)" },
-		{ "0F+4A", "cmovp", { r16_32, r_m16_32 },		"Conditional Move - parity/parity even (PF=1)" },
-		{ "0F+4B", "cmovnp", { r16_32, r_m16_32 },		"Conditional Move - not parity/parity odd (PF=0)" },
-		{ "0F+4C", "cmovl", { r16_32, r_m16_32 },		"Conditional Move - less/not greater (SF!=OF)" },
-		{ "0F+4D", "cmovge", { r16_32, r_m16_32 },		"Conditional Move - not less/greater or equal (SF=OF)" },
-		{ "0F+4E", "cmovng", { r16_32, r_m16_32 },		"Conditional Move - less or equal/not greater ((ZF=1) OR (SF!=OF))" },
-		{ "0F+4F", "cmovg", { r16_32, r_m16_32 },		"Conditional Move - not less nor equal/greater ((ZF=0) AND (SF=OF))" },
-		{ "0F+50", "movmskps", { r32, xmm },			"Extract Packed Single-FP Sign Mask" },
-		{ "66+0F+50", "movmskpd", { r32, xmm },			"Extract Packed Double-FP Sign Mask" },
-		{ "66+0F+50", "movmskpd", { r32, xmm },			"Extract Packed Double-FP Sign Mask" },
-		{ "0F+51", "sqrtps", { xmm, xmm_m128 },			"Compute Square Roots of Packed Single-FP Values" },
-		{ "F3+0F+51", "sqrtss", { xmm, xmm_m32 },		"Compute Square Root of Scalar Single-FP Value" },
-		{ "66+0F+51", "sqrtpd", { xmm, xmm_m128 },		"Compute Square Roots of Packed Double-FP Values" },
-		{ "F2+0F+51", "sqrtsd", { xmm, xmm_m64 },		"Compute Square Root of Scalar Double-FP Value" },
-		{ "0F+52", "rsqrtps", { xmm, xmm_m128 },		"Compute Recipr. of Square Roots of Packed Single-FP Values" },
-		{ "F3+0F+52", "rsqrtss", { xmm, xmm_m32 },		"Compute Recipr. of Square Root of Scalar Single-FP Value" },
-		{ "0F+53", "rcpps", { xmm, xmm_m128 },			"Compute Reciprocals of Packed Single-FP Values" },
-		{ "F3+0F+53", "rcpss", { xmm, xmm_m32 },		"Compute Reciprocal of Scalar Single-FP Values" },
-		{ "0F+54", "andps", { xmm, xmm_m128 },			"Bitwise Logical AND of Packed Single-FP Values" },
-		{ "66+0F+54", "andpd", { xmm, xmm_m128 },		"Bitwise Logical AND of Packed Double-FP Values" },
-		{ "0F+55", "andnps", { xmm, xmm_m128 },			"Bitwise Logical AND NOT of Packed Single-FP Values" },
-		{ "66+0F+55", "andnpd", { xmm, xmm_m128 },		"Bitwise Logical AND NOT of Packed Double-FP Values" },
-		{ "0F+56", "orps", { xmm, xmm_m128 },			"Bitwise Logical OR of Packed Single-FP Values" },
-		{ "66+0F+56", "orpd", { xmm, xmm_m128 },		"Bitwise Logical OR of Packed Double-FP Values" },
-		{ "0F+57", "xorps", { xmm, xmm_m128 },			"Bitwise Logical XOR of Packed Single-FP Values" },
-		{ "66+0F+57", "xorpd", { xmm, xmm_m128 },		"Bitwise Logical XOR of Packed Double-FP Values" },
-		{ "0F+58", "addps", { xmm, xmm_m128 },			"Add Packed Single-FP Values" },
-		{ "F3+0F+58", "addss", { xmm, xmm_m32 },		"Add Scalar Single-FP Values" },
-		{ "66+0F+58", "addpd", { xmm, xmm_m128 },		"Add Packed Double-FP Values" },
-		{ "F2+0F+58", "addsd", { xmm, xmm_m64 },		"Add Scalar Double-FP Values" },
-		{ "0F+59", "mulps", { xmm, xmm_m128 },			"Multiply Packed Single-FP Values" },
-		{ "F3+0F+59", "mulss", { xmm, xmm_m32 },		"Multiply Scalar Single-FP Value" },
-		{ "66+0F+59", "mulpd", { xmm, xmm_m128 },		"Multiply Packed Double-FP Values" },
-		{ "F2+0F+59", "addsd", { xmm, xmm_m64 },		"Multiply Scalar Double-FP Values" },
-		{ "0F+5A", "cvtps2pd", { xmm, xmm_m128 },		"Convert Packed Single-FP Values to Double-FP Values" },
-		{ "F3+0F+5A", "cvtpd2ps", { xmm, xmm_m128 },	"Convert Packed Double-FP Values to Single-FP Values" },
-		{ "66+0F+5A", "cvtss2sd", { xmm, xmm_m32 },		"Convert Scalar Single-FP Value to Scalar Double-FP Value" },
-		{ "F2+0F+5A", "cvtsd2ss", { xmm, xmm_m64 },		"Convert Scalar Double-FP Value to Scalar Single-FP Value" },
-		{ "0F+5B", "cvtdq2ps", { xmm, xmm_m128 },		"Convert Packed DW Integers to Single-FP Values" },
-		{ "66+0F+5B", "cvtps2dq", { xmm, xmm_m128 },	"Convert Packed Single-FP Values to DW Integers" },
-		{ "F3+0F+5B", "cvttps2dq", { xmm, xmm_m128 },	"Convert with Trunc. Packed Single-FP Values to DW Integers" },
-		{ "0F+5C", "subps", { xmm, xmm_m128 },			"Subtract Packed Single-FP Values" },
-		{ "F3+0F+5C", "subss", { xmm, xmm_m32 },		"Subtract Scalar Single-FP Values" },
-		{ "66+0F+5C", "subpd", { xmm, xmm_m128 },		"Subtract Packed Double-FP Values" },
-		{ "F2+0F+5C", "subsd", { xmm, xmm_m64 },		"Subtract Scalar Double-FP Values" },
-		{ "0F+5D", "minps", { xmm, xmm_m128 },			"Return Minimum Packed Single-FP Values" },
-		{ "F3+0F+5D", "minss", { xmm, xmm_m32 },		"Return Minimum Scalar Single-FP Values" },
-		{ "66+0F+5D", "minpd", { xmm, xmm_m128 },		"Return Minimum Packed Double-FP Values" },
-		{ "F2+0F+5D", "minsd", { xmm, xmm_m64 },		"Return Minimum Scalar Double-FP Values" },
-		{ "0F+5E", "divps", { xmm, xmm_m128 },			"Divide Packed Single-FP Values" },
-		{ "F3+0F+5E", "divss", { xmm, xmm_m32 },		"Divide Scalar Single-FP Values" },
-		{ "66+0F+5E", "divpd", { xmm, xmm_m128 },		"Divide Packed Double-FP Values" },
-		{ "F2+0F+5E", "divsd", { xmm, xmm_m64 },		"Divide Scalar Double-FP Values" },
-		{ "0F+5F", "maxps", { xmm, xmm_m128 },			"Return Maximum Packed Single-FP Values" },
-		{ "F3+0F+5F", "maxss", { xmm, xmm_m32 },		"Return Maximum Scalar Single-FP Values" },
-		{ "66+0F+5F", "maxpd", { xmm, xmm_m128 },		"Return Maximum Packed Double-FP Values" },
-		{ "F2+0F+5F", "maxsd", { xmm, xmm_m64 },		"Return Maximum Scalar Double-FP Values" },
-		{ "0F+60", "punpcklbw", { mm, mm_m64 },			"Unpack Low Data" },
-		{ "66+0F+60", "punpcklbw", { xmm, xmm_m128 },	"Unpack Low Data" },
-		{ "0F+61", "punpcklbd", { mm, mm_m64 },			"Unpack Low Data" },
-		{ "66+0F+61", "punpcklbd", { xmm, xmm_m128 },	"Unpack Low Data" },
-		{ "0F+62", "punpcklbq", { mm, mm_m64 },			"Unpack Low Data" },
-		{ "66+0F+62", "punpcklbq", { xmm, xmm_m128 },	"Unpack Low Data" },
-		{ "0F+63", "packsswb", { mm, mm_m64 },			"Pack with Signed Saturation" },
-		{ "66+0F+63", "packsswb", { xmm, xmm_m128 },	"Pack with Signed Saturation" },
-		{ "0F+64", "pcmpgtb", { mm, mm_m64 },			"Compare Packed Signed Integers for Greater Than" },
-		{ "66+0F+64", "pcmpgtb", { xmm, xmm_m128 },		"Compare Packed Signed Integers for Greater Than" },
-		{ "0F+65", "pcmpgtw", { mm, mm_m64 },			"Compare Packed Signed Integers for Greater Than" },
-		{ "66+0F+65", "pcmpgtw", { xmm, xmm_m128 },		"Compare Packed Signed Integers for Greater Than" },
-		{ "0F+66", "pcmpgtd", { mm, mm_m64 },			"Compare Packed Signed Integers for Greater Than" },
-		{ "66+0F+66", "pcmpgtd", { xmm, xmm_m128 },		"Compare Packed Signed Integers for Greater Than" },
-		{ "0F+67", "packuswb", { mm, mm_m64 },			"Pack with Unsigned Saturation" },
-		{ "66+0F+67", "packuswb", { xmm, xmm_m128 },	"Pack with Unsigned Saturation" },
-		{ "0F+68", "punpckhbw", { mm, mm_m64 },			"Unpack High Data" },
-		{ "66+0F+68", "punpckhbw", { xmm, xmm_m128 },	"Unpack High Data" },
-		{ "0F+69", "punpckhwd", { mm, mm_m64 },			"Unpack High Data" },
-		{ "66+0F+69", "punpckhwd", { xmm, xmm_m128 },	"Unpack High Data" },
-		{ "0F+6A", "punpckhdq", { mm, mm_m64 },			"Unpack High Data" },
-		{ "66+0F+6A", "punpckhdq", { xmm, xmm_m128 },	"Unpack High Data" },
-		{ "0F+6B", "packssdw", { mm, mm_m64 },			"Pack with Signed Saturation" },
-		{ "66+0F+6B", "packssdw", { xmm, xmm_m128 },	"Pack with Signed Saturation" },
-		{ "66+0F+6C", "punpcklqdq", { xmm, xmm_m128 },	"Unpack Low Data" },
-		{ "66+0F+6D", "punpckhqdq", { xmm, xmm_m128 },	"Unpack High Data" },
-		{ "0F+6E", "movd", { xmm, r_m32 },				"Move Doubleword" },
-		{ "66+0F+6E", "movd", { xmm, r_m32 },			"Move Doubleword" },
-		{ "0F+6F", "movq", { xmm, mm_m64 },				"Move Quadword" },
-		{ "66+0F+6F", "movdqa", { xmm, xmm_m128 },		"Move Aligned Double Quadword" },
-		{ "F3+0F+6F", "movdqu", { xmm, xmm_m128 },		"Move Unaligned Double Quadword" },
-		{ "0F+70", "pshufw", { mm_m64, imm8 },			"Shuffle Packed Words" },
-		{ "F3+0F+70", "pshuflw", { xmm_m128, imm8 },	"Shuffle Packed Low Words" },
-		{ "66+0F+70", "pshufhw", { xmm_m128, imm8 },	"Shuffle Packed High Words" },
-		{ "F2+0F+70", "pshufd", { xmm_m128, imm8 },		"Shuffle Packed Doublewords" },
-		{ "0F+71+m2", "psrlw", { mm, imm8 },			"Shift Packed Data Right Logical" },
-		{ "66+0F+71+m2", "psrlw", { xmm, imm8 },		"Shift Packed Data Right Logical" },
-		{ "0F+71+m4", "psraw", { mm, imm8 },			"Shift Packed Data Right Arithmetic" },
-		{ "66+0F+71+m4", "psraw", { xmm, imm8 },		"Shift Packed Data Right Arithmetic" },
-		{ "0F+71+m6", "psllw", { mm, imm8 },			"Shift Packed Data Left Logical" },
-		{ "66+0F+71+m6", "psllw", { xmm, imm8 },		"Shift Packed Data Left Logical" },
-		{ "0F+72+m2", "psrld", { mm, imm8 },			"Shift Double Quadword Right Logical" },
-		{ "66+0F+72+m2", "psrld", { xmm, imm8 },		"Shift Double Quadword Right Logical" },
-		{ "0F+72+m4", "psrad", { mm, imm8 },			"Shift Packed Data Right Arithmetic" },
-		{ "66+0F+72+m4", "psrad", { xmm, imm8 },		"Shift Packed Data Right Arithmetic" },
-		{ "0F+72+m6", "pslld", { mm, imm8 },			"Shift Packed Data Left Logical" },
-		{ "66+0F+72+m6", "pslld", { xmm, imm8 },		"Shift Packed Data Left Logical" },
-		{ "0F+73+m2", "psrld", { mm, imm8 },			"Shift Packed Data Right Logical" },
-		{ "66+0F+73+m2", "psrld", { xmm, imm8 },		"Shift Packed Data Right Logical" },
-		{ "0F+73+m3", "psrad", { mm, imm8 },			"Shift Double Quadword Right Logical" },
-		{ "66+0F+73+m6", "psrad", { xmm, imm8 },		"Shift Packed Data Left Logical" },
-		{ "0F+73+m6", "pslld", { mm, imm8 },			"Shift Packed Data Left Logical" },
-		{ "66+0F+73+m7", "pslld", { xmm, imm8 },		"Shift Double Quadword Left Logical" },
-		{ "0F+74", "pcmpeqb", { mm, mm_m64 },			"Compare Packed Data for Equal" },
-		{ "66+0F+74", "pcmpeqb", { xmm, xmm_m128 },		"Compare Packed Data for Equal" },
-		{ "0F+75", "pcmpeqw", { mm, mm_m64 },			"Compare Packed Data for Equal" },
-		{ "66+0F+75", "pcmpeqw", { xmm, xmm_m128 },		"Compare Packed Data for Equal" },
-		{ "0F+76", "pcmpeqd", { mm, mm_m64 },			"Compare Packed Data for Equal" },
-		{ "66+0F+76", "pcmpeqd", { xmm, xmm_m128 },		"Compare Packed Data for Equal" },
-		{ "0F+77", "emms", {  },						"Empty MMX Technology State" },
-		{ "0F+78", "vmread", {  },						"Read Field from Virtual-Machine Control Structure" },
-		{ "0F+79", "vmwrite", {  },						"Write Field to Virtual-Machine Control Structure" },
-		{ "66+0F+7C", "haddpd", { xmm, xmm_m128 },		"Packed Double-FP Horizontal Add" },
-		{ "F2+0F+7C", "haddps", { xmm, xmm_m128 },		"Packed Single-FP Horizontal Add" },
-		{ "66+0F+7D", "hsubpd", { xmm, xmm_m128 },		"Packed Double-FP Horizontal Subtract" },
-		{ "F2+0F+7D", "hsubps", { xmm, xmm_m128 },		"Packed Single-FP Horizontal Subtract" },
-		{ "0F+7E", "movd", { r_m32, mm },				"Move Doubleword" },
-		{ "66+0F+7E", "movd", { r_m32, xmm },			"Move Doubleword" },
-		{ "F3+0F+7E", "movq", { xmm, xmm_m64 },			"Move Quadword" },
-		{ "0F+7F", "movq", { xmm_m64, mm },				"Move Quadword" },
-		{ "66+0F+7F", "movdqa", { xmm_m128, xmm },		"Move Aligned Double Quadword" },
-		{ "F3+0F+7F", "movdqu", { xmm_m128, xmm },		"Move Unaligned Double Quadword" },
-		{ "0F+80", "long jo", { rel16_32 },				"Jump far if overflow (OF=1)" },
-		{ "0F+81", "long jno", { rel16_32 },			"Jump far if not overflow (OF=0)" },
-		{ "0F+82", "long jb", { rel16_32 },				"Jump far if below/not above or equal/carry (CF=1)" },
-		{ "0F+83", "long jnb", { rel16_32 },			"Jump far if not below/above or equal/not carry (CF=0)" },
-		{ "0F+84", "long je", { rel16_32 },				"Jump far if zero/equal (ZF=1)" },
-		{ "0F+85", "long jne", { rel16_32 },			"Jump far if not zero/not equal (ZF=0)" },
-		{ "0F+86", "long jna", { rel16_32 },			"Jump far if below or equal/not above (CF=1 OR ZF=1)" },
-		{ "0F+87", "long ja", { rel16_32 },				"Jump far if not below or equal/above (CF=0 AND ZF=0)" },
-		{ "0F+88", "long js", { rel16_32 },				"Jump far if sign (SF=1)" },
-		{ "0F+89", "long jns", { rel16_32 },			"Jump far if not sign (SF=0)" },
-		{ "0F+8A", "long jp", { rel16_32 },				"Jump far if parity/parity even (PF=1)" },
-		{ "0F+8B", "long jnp", { rel16_32 },			"Jump far if not parity/parity odd (PF=0)" },
-		{ "0F+8C", "long jl", { rel16_32 },				"Jump far if less/not greater (SF!=OF)" },
-		{ "0F+8D", "long jnl", { rel16_32 },			"Jump far if not less/greater or equal (SF=OF)" },
-		{ "0F+8E", "long jng", { rel16_32 },			"Jump far if less or equal/not greater ((ZF=1) OR (SF!=OF))" },
-		{ "0F+8F", "long jg", { rel16_32 },				"Jump far if not less nor equal/greater ((ZF=0) AND (SF=OF))" },
-		{ "0F+90", "seto", { r_m8 },					"Set Byte on Condition - overflow (OF=1)" },
-		{ "0F+91", "setno", { r_m8 },					"Set Byte on Condition - not overflow (OF=0)" },
-		{ "0F+92", "setb", { r_m8 },					"Set Byte on Condition - below/not above or equal/carry (CF=1)" },
-		{ "0F+93", "setnb", { r_m8 },					"Set Byte on Condition - not below/above or equal/not carry (CF=0)" },
-		{ "0F+94", "sete", { r_m8 },					"Set Byte on Condition - zero/equal (ZF=1)" },
-		{ "0F+95", "setne", { r_m8 },					"Set Byte on Condition - not zero/not equal (ZF=0)" },
-		{ "0F+96", "setna", { r_m8 },					"Set Byte on Condition - below or equal/not above (CF=1 OR ZF=1)" },
-		{ "0F+97", "seta", { r_m8 },					"Set Byte on Condition - not below or equal/above (CF=0 AND ZF=0)" },
-		{ "0F+98", "sets", { r_m8 },					"Set Byte on Condition - sign (SF=1)" },
-		{ "0F+99", "setns", { r_m8 },					"Set Byte on Condition - not sign (SF=0)" },
-		{ "0F+9A", "setp", { r_m8 },					"Set Byte on Condition - parity/parity even (PF=1)" },
-		{ "0F+9B", "setnp", { r_m8 },					"Set Byte on Condition - not parity/parity odd (PF=0)" },
-		{ "0F+9C", "setl", { r_m8 },					"Set Byte on Condition - less/not greater (SF!=OF)" },
-		{ "0F+9D", "setnl", { r_m8 },					"Set Byte on Condition - not less/greater or equal (SF=OF)" },
-		{ "0F+9E", "setng", { r_m8 },					"Set Byte on Condition - less or equal/not greater ((ZF=1) OR (SF!=OF))" },
-		{ "0F+9F", "setg", { r_m8 },					"Set Byte on Condition - not less nor equal/greater ((ZF=0) AND (SF=OF))" },
-		{ "0F+A0", "push", { FS },						"Push Word, Doubleword or Quadword Onto the Stack" },
-		{ "0F+A1", "pop", { FS },						"Pop a Value from the Stack" },
-		{ "0F+A2", "cpuid", { IA32_BIOS },				"CPU Identification" },
-		{ "0F+A3", "bt", { r_m16_32, r16_32 },			"Bit Test" },
-		{ "0F+A4", "shld", { r_m16_32, r16_32, imm8 },	"Double Precision Shift Left" },
-		{ "0F+A5", "shld", { r_m16_32, r16_32, CL },	"Double Precision Shift Left" },
-		{ "0F+A8", "push", { GS },						"Push Word, Doubleword or Quadword Onto the Stack" },
-		{ "0F+A9", "pop", { GS },						"Pop a Value from the Stack" },
-		{ "0F+AA", "rsm", {  },							"Resume from System Management Mode" },
-		{ "0F+AB", "bts", { r_m16_32, r16_32 },			"Bit Test and Set" },
-		{ "0F+AC", "shrd", { r_m16_32, r16_32, imm8 },	"Double Precision Shift Right" },
-		{ "0F+AD", "shrd", { r_m16_32, r16_32, CL },	"Double Precision Shift Right" },
-		{ "0F+AE+m0", "fxsave", { m512, ST, ST1 },		"Save x87 FPU, MMX, XMM, and MXCSR State" },
-		{ "0F+AE+m1", "fxrstor", { ST, ST1, ST2 },		"Restore x87 FPU, MMX, XMM, and MXCSR State" },
-		{ "0F+AE+m2", "ldmxcsr", { m32 },				"Load MXCSR Register" },
-		{ "0F+AE+m3", "stmxcsr", { m32 },				"Store MXCSR Register State" },
-		{ "0F+AE+m4", "xsave", { m, EDX, EAX },			"Save Processor Extended States" },
-		{ "0F+AE+m5", "lfence", {  },					"Load Fence" },
-		{ "0F+AE+m5", "xrstor", { ST, ST1, ST2 },		"Restore Processor Extended States" },
-		{ "0F+AE+m6", "mfence", {  },					"Memory Fence" },
-		{ "0F+AE+m7", "sfence", {  },					"Store Fence" },
-		{ "0F+AE+m7", "clflush", { m8 },				"Flush Cache Line" },
-		{ "0F+AF", "imul", { r16_32, r_m16_32 },		"Signed Multiply" },
-		{ "0F+B0", "cmpxchg", { r_m8, AL, r8 },			"Compare and Exchange" },
-		{ "0F+B1", "cmpxchg", { r_m16_32, EAX, r16_32 },"Compare and Exchange" },
-		{ "0F+B2", "lss",{SS, r16_32, m16_32_and_16_32},"Load Far Pointer" },
-		{ "0F+B3", "btr", { r_m16_32, r16_32 },			"Bit Test and Reset" },
-		{ "0F+B4", "lfs",{FS,r_m16_32,m16_32_and_16_32},"Load Far Pointer" },
-		{ "0F+B5", "lgs",{GS,r_m16_32,m16_32_and_16_32},"Load Far Pointer" },
-		{ "0F+B6", "movzx", { r16_32, r_m8 },			"Move with Zero-Extend" },
-		{ "0F+B7", "movzx", { r16_32, r_m16 },			"Move with Zero-Extend" },
-		{ "F3+0F+B8", "popcnt", { r16_32, r_m16_32 },	"Bit Population Count" },
-		{ "0F+B9", "ud", {  },							"Undefined Instruction" },
-		{ "0F+BA+m4", "bt", { r_m16_32, imm8 },			"Bit Test" },
-		{ "0F+BA+m5", "bts", { r_m16_32, imm8 },		"Bit Test and Set" },
-		{ "0F+BA+m6", "btr", { r_m16_32, imm8 },		"Bit Test and Reset" },
-		{ "0F+BA+m7", "btc", { r_m16_32, imm8 },		"Bit Test and Complement" },
-		{ "0F+BB", "btc", { r_m16_32, r16_32 },			"Bit Test and Complement" },
-		{ "0F+BC", "bsf", { r16_32, r_m16_32 },			"Bit Scan Forward" },
-		{ "0F+BD", "bsr", { r16_32, r_m16_32 },			"Bit Scan Reverse" },
-		{ "0F+BE", "movsx", { r16_32, r_m8 },			"Move with Sign-Extension" },
-		{ "0F+BF", "movsx", { r16_32, r_m16 },			"Move with Sign-Extension" },
-		{ "0F+C0", "xadd", { r_m8, r8 },				"Exchange and Add" },
-		{ "0F+C1", "xadd", { r_m16_32, r16_32 },		"Exchange and Add" },
-		{ "0F+C2", "cmpps", { xmm, xmm_m128, imm8 },	"Compare Packed Single-FP Values" },
-		{ "F3+0F+C2", "cmpss", { xmm, xmm_m32, imm8 },	"Compare Scalar Single-FP Values" },
-		{ "66+0F+C2", "cmppd", { xmm, xmm_m128, imm8 },	"Compare Packed Double-FP Values" },
-		{ "F2+0F+C2", "cmpsd", { xmm, xmm_m64, imm8 },	"Compare Scalar Double-FP Values" },
-		{ "0F+C3", "movnti", { m32, r32 },				"Store Doubleword Using Non-Temporal Hint" },
-		{ "0F+C4", "pinsrw", { mm, m16, imm8 },			"Insert Word" },
-		{ "66+0F+C4", "pinsrw", { xmm, m16, imm8 },		"Insert Word" },
-		{ "0F+C5", "pextrw", { r32, mm, imm8 },			"Extract Word" },
-		{ "66+0F+C5", "pextrw", { r32, xmm, imm8 },		"Extract Word" },
-		{ "0F+C6", "shufps", { xmm, xmm_m128, imm8 },	"Shuffle Packed Single-FP Values" },
-		{ "66+0F+C6", "shufpd", { xmm, xmm_m128, imm8 },"Shuffle Packed Double-FP Values" },
-		{ "0F+C7+m1", "cmpxchg8b", { m64, EAX, EDX },	"Compare and Exchange Bytes" },
-		{ "0F+C7+m6", "vmptrld", { m64 },				"Load Pointer to Virtual-Machine Control Structure" },
-		{ "66+0F+C7+m6", "vmclean", { m64 },			"Clear Virtual-Machine Control Structure" },
-		{ "F3+0F+C7+m6", "vmxon", { m64 },				"Enter VMX Operation" },
-		{ "0F+C7+m7", "vmptrst", { m64 },				"Store Pointer to Virtual-Machine Control Structure" },
-		{ "0F+C8+r", "bswap", { r16_32 },				"Byte Swap" },
-		{ "66+0F+D0", "addsubpd", { xmm, xmm_m128 },	"Packed Double-FP Add/Subtract" },
-		{ "F2+0F+D0", "addsubpd", { xmm, xmm_m128 },	"Packed Single-FP Add/Subtract" },
-		{ "0F+D1", "psrlw", { mm, mm_m64 },				"Shift Packed Data Right Logical" },
-		{ "66+0F+D1", "psrlw", { xmm, xmm_m128 },		"Shift Packed Data Right Logical" },
-		{ "0F+D2", "psrld", { mm, mm_m64 },				"Shift Packed Data Right Logical" },
-		{ "66+0F+D2", "psrld", { xmm, xmm_m128 },		"Shift Packed Data Right Logical" },
-		{ "0F+D3", "psrlq", { mm, mm_m64 },				"Shift Packed Data Right Logical" },
-		{ "66+0F+D3", "psrlq", { xmm, xmm_m128 },		"Shift Packed Data Right Logical" },
-		{ "0F+D4", "paddq", { mm, mm_m64 },				"Add Packed Quadword Integers" },
-		{ "66+0F+D4", "paddq", { xmm, xmm_m128 },		"Add Packed Quadword Integers" },
-		{ "0F+D5", "pmullw", { mm, mm_m64 },			"Multiply Packed Signed Integers and Store Low Result" },
-		{ "66+0F+D5", "pmullw", { xmm, xmm_m128 },		"Multiply Packed Signed Integers and Store Low Result" },
-		{ "66+0F+D6", "movq", { xmm_m64, xmm },			"Move Quadword" },
-		{ "F3+0F+D6", "movq2dq", { xmm, mm },			"Move Quadword from MMX Technology to XMM Register" },
-		{ "F2+0F+D6", "movdq2q", { mm, xmm },			"Move Quadword from XMM to MMX Technology Register" },
-		{ "0F+D7", "pmovmskb", { r32, mm },				"Move Byte Mask" },
-		{ "66+0F+D7", "pmovmskb", { r32, xmm },			"Move Byte Mask" },
-		{ "0F+D8", "psubusb", { mm, mm_m64 },			"Subtract Packed Unsigned Integers with Unsigned Saturation" },
-		{ "66+0F+D8", "psubusb", { xmm, xmm_m128 },		"Subtract Packed Unsigned Integers with Unsigned Saturation" },
-		{ "0F+D9", "psubusw", { mm, mm_m64 },			"Subtract Packed Unsigned Integers with Unsigned Saturation" },
-		{ "66+0F+D9", "psubusw", { xmm, xmm_m128 },		"Subtract Packed Unsigned Integers with Unsigned Saturation" },
-		{ "0F+DA", "pminub", { mm, mm_m64 },			"Minimum of Packed Unsigned Byte Integers" },
-		{ "66+0F+DA", "pminub", { xmm, xmm_m128 },		"Minimum of Packed Unsigned Byte Integers" },
-		{ "0F+DB", "pand", { mm, mm_m64 },				"Logical AND" },
-		{ "66+0F+DB", "pand", { xmm, xmm_m128 },		"Logical AND" },
-		{ "0F+DC", "paddusb", { mm, mm_m64 },			"Add Packed Unsigned Integers with Unsigned Saturation" },
-		{ "66+0F+DC", "paddusb", { xmm, xmm_m128 },		"Add Packed Unsigned Integers with Unsigned Saturation" },
-		{ "0F+DD", "paddusw", { mm, mm_m64 },			"Add Packed Unsigned Integers with Unsigned Saturation" },
-		{ "66+0F+DD", "paddusw", { xmm, xmm_m128 },		"Add Packed Unsigned Integers with Unsigned Saturation" },
-		{ "0F+DE", "pmaxub", { mm, mm_m64 },			"Maximum of Packed Unsigned Byte Integers" },
-		{ "66+0F+DE", "pmaxub", { xmm, xmm_m128 },		"Maximum of Packed Unsigned Byte Integers" },
-		{ "0F+DF", "pandn", { mm, mm_m64 },				"Logical AND NOT" },
-		{ "66+0F+DF", "pandn", { xmm, xmm_m128 },		"Logical AND NOT" },
-		{ "0F+E0", "pavgb", { mm, mm_m64 },				"Average Packed Integers" },
-		{ "66+0F+E0", "pavgb", { xmm, xmm_m128 },		"Average Packed Integers" },
-		{ "0F+E1", "psraw", { mm, mm_m64 },				"Shift Packed Data Right Arithmetic" },
-		{ "66+0F+E1", "psraw", { xmm, xmm_m128 },		"Shift Packed Data Right Arithmetic" },
-		{ "0F+E2", "psrad", { mm, mm_m64 },				"Shift Packed Data Right Arithmetic" },
-		{ "66+0F+E2", "psrad", { xmm, xmm_m128 },		"Shift Packed Data Right Arithmetic" },
-		{ "0F+E3", "pavgw", { mm, mm_m64 },				"Average Packed Integers" },
-		{ "66+0F+E3", "pavgw", { xmm, xmm_m128 },		"Average Packed Integers" },
-		{ "0F+E4", "pmulhuw", { mm, mm_m64 },			"Multiply Packed Unsigned Integers and Store High Result" },
-		{ "66+0F+E4", "pmulhuw", { xmm, xmm_m128 },		"Multiply Packed Unsigned Integers and Store High Result" },
-		{ "0F+E5", "pmulhw", { mm, mm_m64 },			"Multiply Packed Signed Integers and Store High Result" },
-		{ "66+0F+E5", "pmulhw", { xmm, xmm_m128 },		"Multiply Packed Signed Integers and Store High Result" },
-		{ "F2+0F+E6", "cvtpd2dq", { xmm, xmm_m128 },	"Convert Packed Double-FP Values to DW Integers" },
-		{ "66+0F+E6", "cvttpd2dq", { xmm, xmm_m128 },	"Convert with Trunc. Packed Double-FP Values to DW Integers" },
-		{ "F3+0F+E6", "cvtdq2pd", { xmm, xmm_m128 },	"Convert Packed DW Integers to Double-FP Values" },
-		{ "0F+E7", "movntq", { m64, mm },				"Store of Quadword Using Non-Temporal Hint" },
-		{ "66+0F+E7", "movntdq", { m128, xmm },			"Store Double Quadword Using Non-Temporal Hint" },
-		{ "0F+E8", "psubsb", { mm, mm_m64 },			"Subtract Packed Signed Integers with Signed Saturation" },
-		{ "66+0F+E8", "psubsb", { xmm, xmm_m128 },		"Subtract Packed Signed Integers with Signed Saturation" },
-		{ "0F+E9", "psubsw", { mm, mm_m64 },			"Subtract Packed Signed Integers with Signed Saturation" },
-		{ "66+0F+E9", "psubsw", { xmm, xmm_m128 },		"Subtract Packed Signed Integers with Signed Saturation" },
-		{ "0F+EA", "pminsw", { mm, mm_m64 },			"Minimum of Packed Signed Word Integers" },
-		{ "66+0F+EA", "pminsw", { xmm, xmm_m128 },		"Minimum of Packed Signed Word Integers" },
-		{ "0F+EB", "por", { mm, mm_m64 },				"Bitwise Logical OR" },
-		{ "66+0F+EB", "por", { xmm, xmm_m128 },			"Bitwise Logical OR" },
-		{ "0F+EC", "paddsb", { mm, mm_m64 },			"Add Packed Signed Integers with Signed Saturation" },
-		{ "66+0F+EC", "paddsb", { xmm, xmm_m128 },		"Add Packed Signed Integers with Signed Saturation" },
-		{ "0F+ED", "paddsw", { mm, mm_m64 },			"Add Packed Signed Integers with Signed Saturation" },
-		{ "66+0F+ED", "paddsw", { xmm, xmm_m128 },		"Add Packed Signed Integers with Signed Saturation" },
-		{ "0F+EE", "pmaxsw", { mm, mm_m64 },			"Maximum of Packed Signed Word Integers" },
-		{ "66+0F+EE", "pmaxsw", { xmm, xmm_m128 },		"Maximum of Packed Signed Word Integers" },
-		{ "0F+EF", "pxor", { mm, mm_m64 },				"Logical Exclusive OR" },
-		{ "66+0F+EF", "pxor", { xmm, xmm_m128 },		"Logical Exclusive OR" },
-		{ "F2+0F+F0", "lddqu", { xmm, m128 },			"Load Unaligned Integer 128 Bits" },
-		{ "0F+F1", "psllw", { mm, mm_m64 },				"Shift Packed Data Left Logical" },
-		{ "66+0F+F1", "psllw", { xmm, xmm_m128 },		"Shift Packed Data Left Logical" },
-		{ "0F+F2", "pslld", { mm, mm_m64 },				"Shift Packed Data Left Logical" },
-		{ "66+0F+F2", "pslld", { xmm, xmm_m128 },		"Shift Packed Data Left Logical" },
-		{ "0F+F3", "psllq", { mm, mm_m64 },				"Shift Packed Data Left Logical" },
-		{ "66+0F+F3", "psllq", { xmm, xmm_m128 },		"Shift Packed Data Left Logical" },
-		{ "0F+F4", "pmuludq", { mm, mm_m64 },			"Multiply Packed Unsigned DW Integers" },
-		{ "66+0F+F4", "pmuludq", { xmm, xmm_m128 },		"Multiply Packed Unsigned DW Integers" },
-		{ "0F+F5", "pmaddwd", { mm, mm_m64 },			"Multiply and Add Packed Integers" },
-		{ "66+0F+F5", "pmaddwd", { xmm, xmm_m128 },		"Multiply and Add Packed Integers" },
-		{ "0F+F6", "psadbw", { mm, mm_m64 },			"Compute Sum of Absolute Differences" },
-		{ "66+0F+F6", "psadbw", { xmm, xmm_m128 },		"Compute Sum of Absolute Differences" },
-		{ "0F+F7", "maskmovq", { m64, mm, mm },			"Store Selected Bytes of Quadword" },
-		{ "66+0F+F7", "maskmovdqu", { m128, xmm, xmm },	"Store Selected Bytes of Double Quadword" },
-		{ "0F+F8", "psubb", { mm, mm_m64 },				"Subtract Packed Integers" },
-		{ "66+0F+F8", "psubb", { xmm, xmm_m128 },		"Subtract Packed Integers" },
-		{ "0F+F9", "psubw", { mm, mm_m64 },				"Subtract Packed Integers" },
-		{ "66+0F+F9", "psubw", { xmm, xmm_m128 },		"Subtract Packed Integers" },
-		{ "0F+FA", "psubd", { mm, mm_m64 },				"Subtract Packed Integers" },
-		{ "66+0F+FA", "psubd", { xmm, xmm_m128 },		"Subtract Packed Integers" },
-		{ "0F+FB", "psubq", { mm, mm_m64 },				"Subtract Packed Quadword Integers" },
-		{ "66+0F+FB", "psubq", { xmm, xmm_m128 },		"Subtract Packed Quadword Integers" },
-		{ "0F+FC", "paddb", { mm, mm_m64 },				"Add Packed Integers" },
-		{ "66+0F+FC", "paddb", { xmm, xmm_m128 },		"Add Packed Integers" },
-		{ "0F+FD", "paddw", { mm, mm_m64 },				"Add Packed Integers" },
-		{ "66+0F+FD", "paddw", { xmm, xmm_m128 },		"Add Packed Integers" },
-		{ "0F+FE", "paddd", { mm, mm_m64 },				"Add Packed Integers" },
-		{ "66+0F+FE", "paddd", { xmm, xmm_m128 },		"Add Packed Integers" },
-		{ "10", "adc", { r_m8, r8 },					"Add with Carry" },
-		{ "11", "adc", { r_m16_32, r16_32 },			"Add with Carry" },
-		{ "12", "adc", { r8, r_m8 },					"Add with Carry" },
-		{ "13", "adc", { r16_32, r_m16_32 },			"Add with Carry" },
-		{ "14", "adc", { AL, imm8 },					"Add with Carry" },
-		{ "15", "adc", { EAX, imm16_32 },				"Add with Carry" },
-		{ "16", "push", { SS },							"Push Stack Segment onto the stack" },
-		{ "17", "pop", { SS },							"Pop Stack Segment off of the stack" },
-		{ "18", "sbb", { r_m8, r8 },					"Integer Subtraction with Borrow" },
-		{ "19", "sbb", { r_m16_32, r16_32 },			"Integer Subtraction with Borrow" },
-		{ "1A", "sbb", { r8, r_m8 },					"Integer Subtraction with Borrow" },
-		{ "1B", "sbb", { r16_32, r_m16_32 },			"Integer Subtraction with Borrow" },
-		{ "1C", "sbb", { AL, imm8 },					"Integer Subtraction with Borrow" },
-		{ "1D", "sbb", { EAX, imm16_32 },				"Integer Subtraction with Borrow" },
-		{ "1E", "push", { DS },							"Push Data Segment onto the stack" },
-		{ "1F", "pop", { DS },							"Pop Data Segment off of the stack" },
-		{ "20", "and", { r_m8, r8 },					"Logical AND" },
-		{ "21", "and", { r_m16_32, r16_32 },			"Logical AND" },
-		{ "22", "and", { r8, r_m8 },					"Logical AND" },
-		{ "23", "and", { r16_32, r_m16_32 },			"Logical AND" },
-		{ "24", "and", { AL, imm8 },					"Logical AND" },
-		{ "25", "and", { EAX, imm16_32 },				"Logical AND" },
-		{ "27", "daa", { AL },							"Decimal Adjust AL after Addition" },
-		{ "28", "sub", { r_m8, r8 },					"Subtract" },
-		{ "29", "sub", { r_m16_32, r16_32 },			"Subtract" },
-		{ "2A", "sub", { r8, r_m8 },					"Subtract" },
-		{ "2B", "sub", { r16_32, r_m16_32 },			"Subtract" },
-		{ "2C", "sub", { AL, imm8 },					"Subtract" },
-		{ "2D", "sub", { EAX, imm16_32 },				"Subtract" },
-		{ "2F", "das", { AL },							"Decimal Adjust AL after Subtraction" },
-		{ "30", "xor", { r_m8, r8 },					"Logical Exclusive OR" },
-		{ "31", "xor", { r_m16_32, r16_32 },			"Logical Exclusive OR" },
-		{ "32", "xor", { r8, r_m8 },					"Logical Exclusive OR" },
-		{ "33", "xor", { r16_32, r_m16_32 },			"Logical Exclusive OR" },
-		{ "34", "xor", { AL, imm8 },					"Logical Exclusive OR" },
-		{ "35", "xor", { EAX, imm16_32 },				"Logical Exclusive OR" },
-		{ "37", "aaa", { AL, AH },						"ASCII Adjust After Addition" },
-		{ "38", "cmp", { r_m8, r8 },					"Compare Two Operands" },
-		{ "39", "cmp", { r_m16_32, r16_32 },			"Compare Two Operands" },
-		{ "3A", "cmp", { r8, r_m8 },					"Compare Two Operands" },
-		{ "3B", "cmp", { r16_32, r_m16_32 },			"Compare Two Operands" },
-		{ "3C", "cmp", { AL, imm8 },					"Compare Two Operands" },
-		{ "3D", "cmp", { EAX, imm16_32 },				"Compare Two Operands" },
-		{ "3F", "aas", { AL, AH },						"ASCII Adjust AL After Subtraction" },
-		{ "40+r", "inc", { r16_32 },					"Increment by 1" },
-		{ "48+r", "dec", { r16_32 },					"Decrement by 1" },
-		{ "50+r", "push", { r16_32 },					"Push Word, Doubleword or Quadword Onto the Stack" },
-		{ "58+r", "pop", { r16_32 },					"Pop a Value from the Stack" },
-		{ "60", "pushad", {  },							"Push All General-Purpose Registers" },
-		{ "61", "popad", {  },							"Pop All General-Purpose Registers" },
-		{ "62", "bound", { r16_32, m16_32_and_16_32 },	"Check Array Index Against Bounds" },
-		{ "63", "arpl", { r_m16, r16 },					"Adjust RPL Field of Segment Selector" },
-		{ "63", "arpl", { r_m16, r16 },					"Adjust RPL Field of Segment Selector" },
-		{ "68", "push", { imm16_32 },					"Push Word, Doubleword or Quadword Onto the Stack" },
-		{ "69", "imul", { r16_32, r_m16_32, imm16_32 },	"Signed Multiply" },
-		{ "6A", "push", { imm8 },						"Push Word, Doubleword or Quadword Onto the Stack" },
-		{ "6B", "imul", { r16_32, r_m16_32, imm8 },		"Signed Multiply" },
-		{ "6C", "insb", {  },							"Input from Port to String" },
-		{ "6D", "insd", {  },							"Input from Port to String" },
-		{ "6E", "outsb", {  },							"Output String to Port" },
-		{ "6F", "outsd", {  },							"Output String to Port" },
-		{ "70", "jo short", { rel8 },					"Jump short if overflow (OF=1)" },
-		{ "71", "jno short", { rel8 },					"Jump short if not overflow (OF=0))" },
-		{ "72", "jb short", { rel8 },					"Jump short if below/not above or equal/carry (CF=1)" },
-		{ "73", "jae short", { rel8 },					"Jump short if not below/above or equal/not carry (CF=0))" },
-		{ "74", "je short", { rel8 },					"Jump short if zero/equal (ZF=1)" },
-		{ "75", "jne short", { rel8 },					"Jump short if not zero/not equal (ZF=0)" },
-		{ "76", "jna short", { rel8 },					"Jump short if below or equal/not above (CF=1 OR ZF=1)" },
-		{ "77", "ja short", { rel8 },					"Jump short if not below or equal/above (CF=0 AND ZF=0)" },
-		{ "78", "js short", { rel8 },					"Jump short if sign (SF=1)" },
-		{ "79", "jns short", { rel8 },					"Jump short if not sign (SF=0)" },
-		{ "7A", "jp short", { rel8 },					"Jump short if parity/parity even (PF=1)" },
-		{ "7B", "jnp short", { rel8 },					"Jump short if not parity/parity odd (PF=0)" },
-		{ "7C", "jl short", { rel8 },					"Jump short if less/not greater (SF!=OF)" },
-		{ "7D", "jge short", { rel8 },					"Jump short if not less/greater or equal (SF=OF)" },
-		{ "7E", "jle short", { rel8 },					"Jump short if less or equal/not greater ((ZF=1) OR (SF!=OF))" },
-		{ "7F", "jg short", { rel8 },					"Jump short if not less nor equal/greater ((ZF=0) AND (SF=OF))" },
-		{ "80+m0", "add", { r_m8, imm8 },				"Add" },
-		{ "80+m1", "or", { r_m8, imm8 },				"Logical Inclusive OR" },
-		{ "80+m2", "adc", { r_m8, imm8 },				"Add with Carry" },
-		{ "80+m3", "sbb", { r_m8, imm8 },				"Integer Subtraction with Borrow" },
-		{ "80+m4", "and", { r_m8, imm8 },				"Logical AND" },
-		{ "80+m5", "sub", { r_m8, imm8 },				"Subtract" },
-		{ "80+m6", "xor", { r_m8, imm8 },				"Logical Exclusive OR" },
-		{ "80+m7", "cmp", { r_m8, imm8 },				"Compare Two Operands" },
-		{ "81+m0", "add", { r_m16_32, imm16_32 },		"Add" },
-		{ "81+m1", "or", { r_m16_32, imm16_32 },		"Logical Inclusive OR" },
-		{ "81+m2", "adc", { r_m16_32, imm16_32 },		"Add with Carry" },
-		{ "81+m3", "sbb", { r_m16_32, imm16_32 },		"Integer Subtraction with Borrow" },
-		{ "81+m4", "and", { r_m16_32, imm16_32 },		"Logical AND" },
-		{ "81+m5", "sub", { r_m16_32, imm16_32 },		"Subtract" },
-		{ "81+m6", "xor", { r_m16_32, imm16_32 },		"Logical Exclusive OR" },
-		{ "81+m7", "cmp", { r_m16_32, imm16_32 },		"Compare Two Operands" },
-		{ "82+m0", "add", { r_m8, imm8 },				"Add" },
-		{ "82+m1", "or", { r_m8, imm8 },				"Logical Inclusive OR" },
-		{ "82+m2", "adc", { r_m8, imm8 },				"Add with Carry" },
-		{ "82+m3", "sbb", { r_m8, imm8 },				"Integer Subtraction with Borrow" },
-		{ "82+m4", "and", { r_m8, imm8 },				"Logical AND" },
-		{ "82+m5", "sub", { r_m8, imm8 },				"Subtract" },
-		{ "82+m6", "xor", { r_m8, imm8 },				"Logical Exclusive OR" },
-		{ "82+m7", "cmp", { r_m8, imm8 },				"Compare Two Operands" },
-		{ "83+m0", "add", { r_m16_32, imm8 },			"Add" },
-		{ "83+m1", "or", { r_m16_32, imm8 },			"Logical Inclusive OR" },
-		{ "83+m2", "adc", { r_m16_32, imm8 },			"Add with Carry" },
-		{ "83+m3", "sbb", { r_m16_32, imm8 },			"Integer Subtraction with Borrow" },
-		{ "83+m4", "and", { r_m16_32, imm8 },			"Logical AND" },
-		{ "83+m5", "sub", { r_m16_32, imm8 },			"Subtract" },
-		{ "83+m6", "xor", { r_m16_32, imm8 },			"Logical Exclusive OR" },
-		{ "83+m7", "cmp", { r_m16_32, imm8 },			"Compare Two Operands" },
-		{ "84", "test", { r_m8, r8 },					"Logical Compare" },
-		{ "85", "test", { r_m16_32, r16_32 },			"Logical Compare" },
-		{ "86", "xchg", { r_m8, r8 },					"Exchange Register/Memory with Register" },
-		{ "87", "xchg", { r_m16_32, r16_32 },			"Exchange Register/Memory with Register" },
-		{ "88", "mov", { r_m8, r8 },					"Move" },
-		{ "89", "mov", { r_m16_32, r16_32 },			"Move" },
-		{ "8A", "mov", { r8, r_m8 },					"Move" },
-		{ "8B", "mov", { r16_32, r_m16_32 },			"Move" },
-		{ "8C", "mov", { m16, Sreg },					"Move" },
-		{ "8D", "lea", { r16_32, m32 },					"Load Effective Address" },
-		{ "8E", "mov", { Sreg, r_m16 },					"Move" },
-		{ "8F", "pop", { r_m16_32 },					"Pop a Value from the Stack" },
-		{ "90", "nop", {  },							"No Operation" },
-		{ "90+r", "xchg", { EAX, r16_32 },				"Exchange Register/Memory with Register" },
-		{ "98", "cbw", { AX, AL },						"Convert Byte to Word" },
-		{ "99", "cwd", { AX, AL },						"Convert Doubleword to Quadword" },
-		{ "9A", "callf", { ptr16_32 },					"Call Procedure" },
-		{ "9B", "fwait", {  },							"Check pending unmasked floating-point exceptions" },
-		{ "9C", "pushfd", {  },							"Push EFLAGS Register onto the Stack" },
-		{ "9D", "popfd", {  },							"Pop Stack into EFLAGS Register" },
-		{ "9E", "sahf", { AH },							"Store AH into Flags" },
-		{ "9F", "lahf", { AH },							"Load Status Flags into AH Register" },
-		{ "A0", "mov", { AL, moffs8 },					"Move" },
-		{ "A1", "mov", { EAX, moffs16_32 },				"Move" },
-		{ "A2", "mov", { moffs8, AL },					"Move" },
-		{ "A3", "mov", { moffs16_32, EAX },				"Move" },
-		{ "A4", "movsb", {  },							"Move Data from String to String" },
-		{ "A5", "movsw", {  },							"Move Data from String to String" },
-		{ "A6", "cmpsb", {  },							"Compare String Operands" },
-		{ "A7", "cmpsw", {  },							"Compare String Operands" },
-		{ "A8", "test", { AL, imm8 },					"Logical Compare" },
-		{ "A9", "test", { EAX, imm16_32 },				"Logical Compare" },
-		{ "AA", "stosb", {  },							"Store String" },
-		{ "AB", "stosw", {  },							"Store String" },
-		{ "AC", "lodsb", {  },							"Load String" },
-		{ "AD", "lodsw", {  },							"Load String" },
-		{ "AE", "scasb", {  },							"Scan String" },
-		{ "AF", "scasw", {  },							"Scan String" },
-		{ "B0+r", "mov", { r8, imm8 },					"Move" },
-		{ "B8+r", "mov", { r16_32, imm16_32 },			"Move" },
-		{ "C0+m0", "rol", { r_m8, imm8 },				"Rotate" },
-		{ "C0+m1", "ror", { r_m8, imm8 },				"Rotate" },
-		{ "C0+m2", "rcl", { r_m8, imm8 },				"Rotate" },
-		{ "C0+m3", "rcr", { r_m8, imm8 },				"Rotate" },
-		{ "C0+m4", "shl", { r_m8, imm8 },				"Shift" },
-		{ "C0+m5", "shr", { r_m8, imm8 },				"Shift" },
-		{ "C0+m6", "sal", { r_m8, imm8 },				"Shift" },
-		{ "C0+m7", "sar", { r_m8, imm8 },				"Shift" },
-		{ "C1+m0", "rol", { r_m16_32, imm8 },			"Rotate" },
-		{ "C1+m1", "ror", { r_m16_32, imm8 },			"Rotate" },
-		{ "C1+m2", "rcl", { r_m16_32, imm8 },			"Rotate" },
-		{ "C1+m3", "rcr", { r_m16_32, imm8 },			"Rotate" },
-		{ "C1+m4", "shl", { r_m16_32, imm8 },			"Shift" },
-		{ "C1+m5", "shr", { r_m16_32, imm8 },			"Shift" },
-		{ "C1+m6", "sal", { r_m16_32, imm8 },			"Shift" },
-		{ "C1+m7", "sar", { r_m16_32, imm8 },			"Shift" },
-		{ "C2", "ret", { imm16 },						"Return from procedure" },
-		{ "C3", "retn", {  },							"Return from procedure" },
-		{ "C4", "les", { ES, r16_32, m16_32_and_16_32 },"Load Far Pointer" },
-		{ "C5", "lds", { DS, r16_32, m16_32_and_16_32 },"Load Far Pointer" },
-		{ "C6", "mov", { r_m8, imm8 },					"Move" },
-		{ "C7", "mov", { r_m16_32, imm16_32 },			"Move" },
-		{ "66+C7", "mov", { r_m16_32, imm16 },			"Move" },
-		{ "C8", "enter", { EBP, imm16, imm8 },			"Make Stack Frame for Procedure Parameters" },
-		{ "C9", "leave", { EBP },						"High Level Procedure Exit" },
-		{ "CA", "retf", { imm16 },						"Return from procedure" },
-		{ "CB", "retf", {  },							"Return from procedure" },
-		{ "CC", "int 3", {  },							"Call to Interrupt Procedure" },
-		{ "CD", "int", { imm8 },						"Call to Interrupt Procedure" },
-		{ "CE", "into", {  },							"Call to Interrupt Procedure" },
-		{ "CF", "iretd", {  },							"Interrupt Return" },
-		{ "D0+m0", "rol", { r_m8, one },				"Rotate" },
-		{ "D0+m1", "ror", { r_m8, one },				"Rotate" },
-		{ "D0+m2", "rcl", { r_m8, one },				"Rotate" },
-		{ "D0+m3", "rcr", { r_m8, one },				"Rotate" },
-		{ "D0+m4", "shl", { r_m8, one },				"Shift" },
-		{ "D0+m5", "shr", { r_m8, one },				"Shift" },
-		{ "D0+m6", "shl", { r_m8, one },				"Shift" },
-		{ "D0+m7", "shr", { r_m8, one },				"Shift" },
-		{ "D1+m0", "rol", { r_m16_32, one },			"Rotate" },
-		{ "D1+m1", "ror", { r_m16_32, one },			"Rotate" },
-		{ "D1+m2", "rcl", { r_m16_32, one },			"Rotate" },
-		{ "D1+m3", "rcr", { r_m16_32, one },			"Rotate" },
-		{ "D1+m4", "shl", { r_m16_32, one },			"Shift" },
-		{ "D1+m5", "shr", { r_m16_32, one },			"Shift" },
-		{ "D1+m6", "shl", { r_m16_32, one },			"Shift" },
-		{ "D1+m7", "shr", { r_m16_32, one },			"Shift" },
-		{ "D2+m0", "rol", { r_m8, CL },					"Rotate" },
-		{ "D2+m1", "ror", { r_m8, CL },					"Rotate" },
-		{ "D2+m2", "rcl", { r_m8, CL },					"Rotate" },
-		{ "D2+m3", "rcr", { r_m8, CL },					"Rotate" },
-		{ "D2+m4", "shl", { r_m8, CL },					"Shift" },
-		{ "D2+m5", "shr", { r_m8, CL },					"Shift" },
-		{ "D2+m6", "shl", { r_m8, CL },					"Shift" },
-		{ "D2+m7", "shr", { r_m8, CL },					"Shift" },
-		{ "D3+m0", "rol", { r_m16_32, CL },				"Rotate" },
-		{ "D3+m1", "ror", { r_m16_32, CL },				"Rotate" },
-		{ "D3+m2", "rcl", { r_m16_32, CL },				"Rotate" },
-		{ "D3+m3", "rcr", { r_m16_32, CL },				"Rotate" },
-		{ "D3+m4", "shl", { r_m16_32, CL },				"Shift" },
-		{ "D3+m5", "shr", { r_m16_32, CL },				"Shift" },
-		{ "D3+m6", "shl", { r_m16_32, CL },				"Shift" },
-		{ "D3+m7", "shr", { r_m16_32, CL },				"Shift" },
-		{ "D4", "aam", { AL, AH, imm8 },				"ASCII Adjust AX After Multiply" },
-		{ "D5", "aad", { AL, AH, imm8 },				"ASCII Adjust AX Before Division" },
-		{ "D6", "setalc", { AL },						"Set AL If Carry" },
-		{ "D7", "xlatb", { AL },						"Table Look-up Translation" },
-		{ "D8+m8", "fadd", { ST, STi },					"Add" },
-		{ "D8+m9", "fmul", { ST, STi },					"Multiply" },
-		{ "D8+mA", "fcom", { ST, STi },					"Compare Real" },
-		{ "D8+mB", "fcomp", { ST, STi },				"Compare Real and Pop" },
-		{ "D8+mC", "fsub", { ST, STi },					"Subtract" },
-		{ "D8+mD", "fsubr", { ST, STi },				"Reverse Subtract" },
-		{ "D8+mE", "fdiv", { ST, STi },					"Divide" },
-		{ "D8+mF", "fdivr", { ST, STi },				"Reverse Divide" },
-		{ "D8+m0", "fadd", { STi },						"Add" },
-		{ "D8+m1", "fmul", { STi },						"Multiply" },
-		{ "D8+m2", "fcom", { STi },						"Compare Real" },
-		{ "D8+m3", "fcomp", { STi },					"Compare Real and Pop" },
-		{ "D8+m4", "fsub", { STi },						"Subtract" },
-		{ "D8+m5", "fsubr", { STi },					"Reverse Subtract" },
-		{ "D8+m6", "fdiv", { STi },						"Divide" },
-		{ "D8+m7", "fdivr", { STi },					"Reverse Divide" },
-		{ "D9+m0", "fld", { STi },						"Load Floating Point Value" },
-		{ "D9+m1", "fxch", { STi },						"Exchange Register Contents" },
-		{ "D9+m2", "fst", { STi },						"Store Floating Point Value" },
-		{ "D9+m3", "fstp", { STi },						"Store Floating Point Value and Pop" },
-		{ "D9+m4", "fldenv", { STi },					"Load x87 FPU Environment" },
-		{ "D9+m5", "fldcw", { STi },					"Load x87 FPU Control Word" },
-		{ "D9+m6", "fnstenv", { STi },					"Store x87 FPU Environment" },
-		{ "D9+m7", "fnstcw", { STi },					"Store x87 FPU Control Word" },
-		{ "DA+m8", "fcmovb", { ST, STi },				"FP Conditional Move - below (CF=1)" },
-		{ "DA+m9", "fcmove", { ST, STi },				"FP Conditional Move - equal (ZF=1)" },
-		{ "DA+mA", "fcmovbe", { ST, STi },				"FP Conditional Move - below or equal (CF=1 or ZF=1)" },
-		{ "DA+mB", "fcmovu", { ST, STi },				"FP Conditional Move - unordered (PF=1)" },
-		{ "DA+mC", "fisub", { ST, STi },				"Subtract" },
-		{ "DA+mD", "fisubr", { ST, STi },				"Reverse Subtract" },
-		{ "DA+mE", "fidiv", { ST, STi },				"Divide" },
-		{ "DA+mF", "fidivr", { ST, STi },				"Reverse Divide" },
-		{ "DA+m0", "fiadd", { STi },					"Add" },
-		{ "DA+m1", "fimul", { STi },					"Multiply" },
-		{ "DA+m2", "ficom", { STi },					"Compare Real" },
-		{ "DA+m3", "ficomp", { STi },					"Compare Real and Pop" },
-		{ "DA+m4", "fisub", { STi },					"Subtract" },
-		{ "DA+m5", "fisubr", { STi },					"Reverse Subtract" },
-		{ "DA+m6", "fidiv", { STi },					"Divide" },
-		{ "DA+m7", "fidivr", { STi },					"Reverse Divide" },
-		{ "DB+m8", "fcmovnb", { ST, STi },				"FP Conditional Move - not below (CF=0)" },
-		{ "DB+m9", "fcmovne", { ST, STi },				"FP Conditional Move - not equal (ZF=0)" },
-		{ "DB+mA", "fcmovnbe", { ST, STi },				"FP Conditional Move - below or equal (CF=0 and ZF=0)" },
-		{ "DB+mB", "fcmovnu", { ST, STi },				"FP Conditional Move - not unordered (PF=0)" },
-		{ "DB+m0", "fild", { STi },						"Load Integer" },
-		{ "DB+m1", "fisttp", { STi },					"Store Integer with Truncation and Pop" },
-		{ "DB+m2", "fist", { STi },						"Store Integer" },
-		{ "DB+m3", "fistp", { STi },					"Store Integer and Pop" },
-		{ "DB+m4", "finit", { STi },					"Initialize Floating-Point Unit" },
-		{ "DB+m5", "fucomi", { STi },					"Unordered Compare Floating Point Values and Set EFLAGS" },
-		{ "DB+m6", "fcomi", { STi },					"Compare Floating Point Values and Set EFLAGS" },
-		{ "DB+m7", "fstp", { STi },						"Store Floating Point Value and Pop" },
-		{ "DC+m8", "fadd", { STi, ST },					"Add" },
-		{ "DC+m9", "fmul", { STi, ST },					"Multiply" },
-		{ "DC+mA", "fcom", { STi, ST },					"Compare Real" },
-		{ "DC+mB", "fcomp", { STi, ST },				"Compare Real and Pop" },
-		{ "DC+mC", "fsub", { STi, ST },					"Subtract" },
-		{ "DC+mD", "fsubr", { STi, ST },				"Reverse Subtract" },
-		{ "DC+mE", "fdiv", { STi, ST },					"Divide" },
-		{ "DC+mF", "fdivr", { STi, ST },				"Reverse Divide" },
-		{ "DC+m0", "fadd", { STi },						"Add" },
-		{ "DC+m1", "fmul", { STi },						"Multiply" },
-		{ "DC+m2", "fcom", { STi },						"Compare Real" },
-		{ "DC+m3", "fcomp", { STi },					"Compare Real and Pop" },
-		{ "DC+m4", "fsub", { STi },						"Subtract" },
-		{ "DC+m5", "fsubr", { STi },					"Reverse Subtract" },
-		{ "DC+m6", "fdiv", { STi },						"Divide" },
-		{ "DC+m7", "fdivr", { STi },					"Reverse Divide" },
-		{ "DD+m8", "ffree", { STi },					"Free Floating-Point Register" },
-		{ "DD+m0", "fld", { STi },						"Load Floating Point Value" },
-		{ "DD+m1", "fisttp", { STi },					"Store Integer with Truncation and Pop" },
-		{ "DD+m2", "fst", { STi },						"Store Floating Point Value" },
-		{ "DD+m3", "fstp", { STi },						"Store Floating Point Value and Pop" },
-		{ "DD+m4", "frstor", { STi },					"Restore x87 FPU State" },
-		{ "DD+m5", "fucomp", { STi },					"Unordered Compare Floating Point Values and Pop" },
-		{ "DD+m6", "fnsave", { STi },					"Store x87 FPU State" },
-		{ "DD+m7", "fnstsw", { STi },					"Store x87 FPU Status Word" },
-		{ "DE+m8", "faddp", { ST, STi },				"Add and Pop" },
-		{ "DE+m9", "fmulp", { ST, STi },				"Multiply and Pop" },
-		{ "DE+mA", "ficom", { ST, STi },				"Compare Real" },
-		{ "DE+mB", "ficomp", { ST, STi },				"Compare Real and Pop" },
-		{ "DE+mC", "fsubrp", { ST, STi },				"Reverse Subtract and Pop" },
-		{ "DE+mD", "fsubp", { ST, STi },				"Subtract and Pop" },
-		{ "DE+mE", "fdivrp", { ST, STi },				"Reverse Divide and Pop" },
-		{ "DE+mF", "fdivp", { ST, STi },				"Divide and Pop" },
-		{ "DE+m0", "fiadd", { STi },					"Add" },
-		{ "DE+m1", "fimul", { STi },					"Multiply" },
-		{ "DE+m2", "ficom", { STi },					"Compare Real" },
-		{ "DE+m3", "ficomp", { STi },					"Compare Real and Pop" },
-		{ "DE+m4", "fisub", { STi },					"Subtract" },
-		{ "DE+m5", "fisubr", { STi },					"Reverse Subtract" },
-		{ "DE+m6", "fidiv", { STi },					"Divide" },
-		{ "DE+m7", "fdivr", { STi },					"Reverse Divide" },
-		{ "DF+m8", "ffreep", { STi },					"Free Floating-Point Register and Pop" },
-		{ "DF+m9", "fisttp", { r32 },					"Store Integer with Truncation and Pop" },
-		{ "DF+mA", "fist", { STi },						"Store Integer" },
-		{ "DF+mB", "fistp", { STi },					"Store Integer and Pop" },
-		{ "DF+mC", "fnstsw", { STi },					"Store x87 FPU Status Word" },
-		{ "DF+mD", "fucomip", { ST, STi },				"Unordered Compare Floating Point Values and Set EFLAGS and Pop" },
-		{ "DF+mE", "fcomip", { ST, STi },				"Compare Floating Point Values and Set EFLAGS and Pop" },
-		{ "DF+mF", "fistp", { r64 },					"Store Integer and Pop" },
-		{ "DF+m0", "fild", { STi },						"Load Integer" },
-		{ "DF+m1", "fisttp", { STi },					"Store Integer with Truncation and Pop" },
-		{ "DF+m2", "fist", { STi },						"Store Integer" },
-		{ "DF+m3", "fistp", { STi },					"Store Integer and Pop" },
-		{ "DF+m4", "fbld", { STi },						"Load Binary Coded Decimal" },
-		{ "DF+m5", "fild", { STi },						"Load Integer" },
-		{ "DF+m6", "fbstp", { STi },					"Store BCD Integer and Pop" },
-		{ "DF+m7", "fistp", { STi },					"Store Integer and Pop" },
-		{ "E0", "loopne", { ECX, rel8 },				"Decrement count; Jump short if count!=0 and ZF=0" },
-		{ "E1", "loope", { ECX, rel8 },					"Decrement count; Jump short if count!=0 and ZF=1" },
-		{ "E2", "loop", { ECX, rel8 },					"Decrement count; Jump short if count!=0" },
-		{ "E3", "jecxz", { rel8 },						"Jump short if eCX register is 0" },
-		{ "E4", "in", { AL, imm8 },						"Input from Port" },
-		{ "E5", "in", { EAX, imm8 },					"Input from Port" },
-		{ "E6", "out", { imm8, AL },					"Output to Port" },
-		{ "E7", "out", { imm8, EAX },					"Output to Port" },
-		{ "E8", "call", { rel16_32 },					"Call Procedure" },
-		{ "E9", "jmp", { rel16_32 },					"Jump" },
-		{ "EA", "jmpf", { ptr16_32 },					"Jump" },
-		{ "EB", "jmp short", { rel8 },					"Jump" },
-		{ "EC", "in", { AL, DX },						"Input from Port" },
-		{ "ED", "in", { EAX, DX },						"Input from Port" },
-		{ "EE", "out", { DX, AL },						"Output to Port" },
-		{ "EF", "out", { DX, EAX },						"Output to Port" },
-		{ "F1", "int 1", {  },							"Call to Interrupt Procedure" },
-		{ "F4", "hlt", {  },							"Halt" },
-		{ "F5", "cmc", {  },							"Complement Carry Flag" },
-		{ "F6+m0", "test", { r_m8, imm8 },				"Logical Compare" },
-		{ "F6+m1", "test", { r_m8, imm8 },				"Logical Compare" },
-		{ "F6+m2", "not", { r_m8 },						"One's Complement Negation" },
-		{ "F6+m3", "neg", { r_m8 },						"Two's Complement Negation" },
-		{ "F6+m4", "mul", { AX, AL, r_m8 },				"Unsigned Multiply" },
-		{ "F6+m5", "imul", { AX, AL, r_m8 },			"Signed Multiply" },
-		{ "F6+m6", "div", { AX, AL, AX, r_m8 },			"Unigned Divide" },
-		{ "F6+m7", "idiv", { AX, AL, AX, r_m8 },		"Signed Divide" },
-		{ "F7+m0", "test", { r_m16_32, imm16_32 },		"Logical Compare" },
-		{ "F7+m1", "test", { r_m16_32, imm16_32 },		"Logical Compare" },
-		{ "F7+m2", "not", { r_m16_32 },					"One's Complement Negation" },
-		{ "F7+m3", "neg", { r_m16_32 },					"Two's Complement Negation" },
-		{ "F7+m4", "mul", { EDX, EAX, r_m16_32 },		"Unsigned Multiply" },
-		{ "F7+m5", "imul", { EDX, EAX, r_m16_32 },		"Signed Multiply" },
-		{ "F7+m6", "div", { EDX, EAX, r_m16_32 },		"Unigned Divide" },
-		{ "F7+m7", "idiv", { EDX, EAX, r_m16_32 },		"Signed Divide" },
-		{ "F8", "clc", {  },							"Clear Carry Flag" },
-		{ "F9", "stc", {  },							"Set Carry Flag" },
-		{ "FA", "cli", {  },							"Clear Interrupt Flag" },
-		{ "FB", "sti", {  },							"Set Interrupt Flag" },
-		{ "FC", "cld", {  },							"Clear Direction Flag" },
-		{ "FD", "std", {  },							"Set Direction Flag" },
-		{ "FE+m0", "inc", { r_m8 },						"Increment by 1" },
-		{ "FE+m1", "dec", { r_m8 },						"Decrement by 1" },
-		{ "FE+mE", "inc", { r_m8 },						"Increment by 1" },
-		{ "FE+mF", "dec", { r_m8 },						"Decrement by 1" },
-		{ "FF+m0", "inc", { r_m16_32 },					"Increment by 1" },
-		{ "FF+m1", "dec", { r_m16_32 },					"Decrement by 1" },
-		{ "FF+m2", "call", { r_m16_32 },				"Call Procedure" },
-		{ "FF+m3", "callf", { m16_32_and_16_32 },		"Call Procedure" },
-		{ "FF+m4", "jmp", { r_m16_32 },					"Jump" },
-		{ "FF+m5", "jmpf", { m16_32_and_16_32 },		"Jump" },
-		{ "FF+m6", "push", { r_m16_32 },				"Push Word, Doubleword or Quadword Onto the Stack" },
-		{ "FF+m7", "push", { r_m16_32 },				"Push Word, Doubleword or Quadword Onto the Stack" },
-	};
+	// disa_optable is constant data and the dispatch index
+	// is compiled on first use. Nothing to do here anymore
+	return true;
+}
+
+#ifdef DISA_INSTRUMENT
+// Heap blocks held by a string or vector, or that a copy of it
+// allocates (`copy`: a copy only allocates for what's in use).
+// For counting allocations
+static std::size_t heap_blocks(const std::string& s, const bool copy = false)
+{
+	return (copy ? s.size() : s.capacity()) > std::string().capacity();
+}
+
+template <typename T>
+static std::size_t heap_blocks(const std::vector<T>& v, const bool copy = false)
+{
+	return (copy ? v.size() : v.capacity()) != 0;
+}
 
-	return disa_optable.size() > 0;
+static std::size_t heap_blocks(const disa_inst& inst, const bool copy = false)
+{
+	return heap_blocks(inst.data, copy) + heap_blocks(inst.info.code, copy) + heap_blocks(inst.info.opcode_name, copy) + heap_blocks(inst.info.operands, copy)
+		+ heap_blocks(inst.info.description, copy) + heap_blocks(inst.operands, copy);
 }
+#endif
 
 disa_operand::disa_operand()
 {
@@ -1050,9 +1367,6 @@ disa_operand::disa_operand()
 	opmode = 0;
 	flags = 0;
 
-	reg = std::vector<std::uint8_t>();
-	reg.resize(4);
-
 	reg[0] = 0;
 	reg[1] = 0;
 	reg[2] = 0;
@@ -1069,6 +1383,11 @@ std::uint8_t disa_operand::append_reg(const std::uint8_t reg_type)
 	return reg_type;
 }
 
+std::uint8_t disa_operand::reg_count() const
+{
+	return n_reg;
+}
+
 disa_inst::disa_inst()
 {
 	data[0] = '\0';
@@ -1082,28 +1401,248 @@ disa_inst::disa_inst()
 	operands[2] = disa_operand();
 	operands[3] = disa_operand();
 
+	std::memset(bytes, 0, sizeof(bytes));
+
 	address = 0;
 	flags = 0;
+	prefix = 0;
 	len = 0;
 }
 
+disa_inst::disa_inst(const disa_record& record) : disa_inst()
+{
+	this->record = record;
+
+	address = record.address;
+	len = record.len;
+
+	if (record.row == DISA_NO_ROW)
+	{
+		DISA_STATS(disa_stats_allocated(heap_blocks(*this)));
+		return;
+	}
+
+	const auto& op_info = disa_optable[record.row];
+
+	info.code = op_info.code;
+	info.opcode_name = op_info.opcode_name;
+	info.operands.assign(op_info.operands.types, op_info.operands.types + op_info.operands.count);
+	info.description = op_info.description;
+	info.mnemonic = record.mnemonic();
+	info.form = record.form();
+
+	flags = record.flags();
+	prefix = record.prefix;
+
+	operands.resize(record.noperands);
+
+	for (std::size_t c = 0; c < record.noperands; c++)
+	{
+		const auto& from = record.operands[c];
+		auto& operand = operands[c];
+
+		operand.flags = from.flags;
+		operand.opmode = from.opmode;
+		operand.mul = from.mul;
+
+		for (std::uint8_t i = 0; i < from.reg_count(); i++)
+		{
+			operand.append_reg(from.reg[i]);
+		}
+
+		switch (from.opmode)
+		{
+		case disa_optypes::rel8:
+		case disa_optypes::rel16:
+		case disa_optypes::rel16_32:
+		case disa_optypes::rel32:
+			operand.rel32 = from.value;
+			break;
+		case disa_optypes::ptr16_32:
+			operand.disp32 = from.value;
+			operand.imm16 = record.selector;
+			break;
+		default:
+			if (from.flags & (OP_IMM8 | OP_IMM16 | OP_IMM32))
+			{
+				operand.imm32 = from.value;
+			}
+			else
+			{
+				operand.disp32 = from.value;
+			}
+			break;
+		}
+	}
+
+	DISA_STATS(disa_stats_allocated(heap_blocks(*this)));
+}
+
 disa_inst::~disa_inst()
 {
 	operands.clear();
 }
 
-disa_operand disa_inst::src()
+static const disa_operand disa_no_operand = disa_operand();
+
+const disa_operand& disa_inst::src() const
 {
-	if (operands.size() <= 0) return disa_operand();
+	if (operands.size() <= 0) return disa_no_operand;
 	return operands[0];
 }
 
-disa_operand disa_inst::dest()
+const disa_operand& disa_inst::dest() const
 {
-	if (operands.size() <= 1) return disa_operand();
+	if (operands.size() <= 1) return disa_no_operand;
 	return operands[1];
 }
 
+std::uint32_t disa_record::flags() const
+{
+	// REX and the mode are left out, their bits are OP_R16/OP_R32/OP_R64
+	const std::uint32_t prefixes = prefix & ~(PRE_REX | PRE_REX_W | PRE_MODE_64);
+
+	// append flags which help users identify
+	// what type of instruction this is
+	switch (noperands)
+	{
+	case 0:
+		return prefixes;
+	case 1:
+		return prefixes | OP_SINGLE; // uses 1 register (source)
+	case 2:
+		return prefixes | OP_SRC_DEST; // uses 2 registers (source/destination)
+	default:
+		return prefixes | OP_EXTENDED; // uses 3+ registers
+	}
+}
+
+// The signed offset of a rel8/rel16/rel32 operand
+static bool disa_rel_offset(const disa_record_operand& operand, std::int32_t& offset)
+{
+	switch (operand.opmode)
+	{
+	case disa_optypes::rel8:
+		offset = static_cast<std::int8_t>(operand.value);
+		return true;
+	case disa_optypes::rel16:
+		offset = static_cast<std::int16_t>(operand.value);
+		return true;
+	case disa_optypes::rel16_32:
+	case disa_optypes::rel32:
+		offset = static_cast<std::int32_t>(operand.value);
+		return true;
+	default:
+		return false;
+	}
+}
+
+// `offset` bytes from the end of the instruction (wrapped to 32 bits, outside of 64-bit mode)
+static std::uintptr_t disa_relative(const disa_record& record, const std::int32_t offset)
+{
+	const std::uintptr_t target = record.address + record.len + static_cast<std::intptr_t>(offset);
+	return (record.prefix & PRE_MODE_64) ? target : static_cast<std::uint32_t>(target);
+}
+
+bool disa_record::branch_target(std::uintptr_t& target) const
+{
+	if (noperands == 0)
+	{
+		return false;
+	}
+
+	// relative offsets are always the last operand (and the last part of the instruction)
+	std::int32_t offset;
+
+	if (!disa_rel_offset(operands[noperands - 1], offset))
+	{
+		return false;
+	}
+
+	target = disa_relative(*this, offset);
+	return true;
+}
+
+bool disa_record::memory_target(std::uintptr_t& target) const
+{
+	for (std::size_t c = 0; c < noperands; c++)
+	{
+		const auto& operand = operands[c];
+
+		if (operand.flags & OP_RIP)
+		{
+			target = disa_relative(*this, static_cast<std::int32_t>(operand.value));
+			return true;
+		}
+
+		if (operand.opmode == disa_optypes::moffs8 || operand.opmode == disa_optypes::moffs16_32)
+		{
+			target = static_cast<std::uintptr_t>(value64(c));
+			return true;
+		}
+
+		if ((operand.flags & OP_MEM) && (operand.flags & OP_DISP32) && operand.reg_count() == 0)
+		{
+			// a disp32 on its own is sign-extended in 64-bit mode
+			target = (prefix & PRE_MODE_64) ? static_cast<std::uintptr_t>(static_cast<std::intptr_t>(static_cast<std::int32_t>(operand.value))) : operand.value;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static std::uint64_t disa_value64(const disa_record& record, const disa_record_operand& operand)
+{
+	if (operand.flags & OP_DISP64)
+	{
+		return operand.value | (static_cast<std::uint64_t>(record.operands[3].value) << 32);
+	}
+
+	return operand.value;
+}
+
+std::uint64_t disa_record::value64(const std::size_t n) const
+{
+	return disa_value64(*this, operands[n]);
+}
+
+// Whether the r16_32/r_m16_32 operands and eAX-style registers are 64-bit:
+// with REX.W, or for push/pop and near call/jmp, which are 64-bit by default in 64-bit mode
+static bool disa_op64(const disa_record& record)
+{
+	if (!(record.prefix & PRE_MODE_64))
+	{
+		return false;
+	}
+
+	if (record.prefix & PRE_REX_W)
+	{
+		return true;
+	}
+
+	switch (record.mnemonic())
+	{
+	case MN_PUSH:
+	case MN_POP:
+	case MN_CALL:
+	case MN_JMP:
+		return !(record.prefix & PRE_66);
+	default:
+		return false;
+	}
+}
+
+const char* disa_record::opcode_name() const
+{
+	return (row == DISA_NO_ROW) ? "" : disa_optable[row].opcode_name;
+}
+
+const char* disa_record::description() const
+{
+	return (row == DISA_NO_ROW) ? "" : disa_optable[row].description;
+}
+
 
 
 namespace mnemonics
@@ -1120,6 +1659,26 @@ namespace mnemonics
 		"bh"
 	};
 
+	const char* const r8_rex_names[] = // with a REX prefix
+	{
+		"al",
+		"cl",
+		"dl",
+		"bl",
+		"spl",
+		"bpl",
+		"sil",
+		"dil",
+		"r8b",
+		"r9b",
+		"r10b",
+		"r11b",
+		"r12b",
+		"r13b",
+		"r14b",
+		"r15b"
+	};
+
 	const char* const r16_names[] =
 	{
 		"ax",
@@ -1129,7 +1688,15 @@ namespace mnemonics
 		"sp",
 		"bp",
 		"si",
-		"di"
+		"di",
+		"r8w",
+		"r9w",
+		"r10w",
+		"r11w",
+		"r12w",
+		"r13w",
+		"r14w",
+		"r15w"
 	};
 
 	const char* const r32_names[] =
@@ -1141,7 +1708,15 @@ namespace mnemonics
 		"esp",
 		"ebp",
 		"esi",
-		"edi"
+		"edi",
+		"r8d",
+		"r9d",
+		"r10d",
+		"r11d",
+		"r12d",
+		"r13d",
+		"r14d",
+		"r15d"
 	};
 
 	const char* const r64_names[] =
@@ -1153,7 +1728,15 @@ namespace mnemonics
 		"rsp",
 		"rbp",
 		"rsi",
-		"rdi"
+		"rdi",
+		"r8",
+		"r9",
+		"r10",
+		"r11",
+		"r12",
+		"r13",
+		"r14",
+		"r15"
 	};
 
 	const char* const xmm_names[] =
@@ -1165,7 +1748,15 @@ namespace mnemonics
 		"xmm4",
 		"xmm5",
 		"xmm6",
-		"xmm7"
+		"xmm7",
+		"xmm8",
+		"xmm9",
+		"xmm10",
+		"xmm11",
+		"xmm12",
+		"xmm13",
+		"xmm14",
+		"xmm15"
 	};
 
 	const char* const mm_names[] =
@@ -1213,7 +1804,15 @@ namespace mnemonics
 		"cr4",
 		"cr5",
 		"cr6",
-		"cr7"
+		"cr7",
+		"cr8",
+		"cr9",
+		"cr10",
+		"cr11",
+		"cr12",
+		"cr13",
+		"cr14",
+		"cr15"
 	};
 
 	const char* const st_names[] = // control register
@@ -1255,19 +1854,6 @@ const std::uint32_t longreg(const std::uint8_t x)
 }
 
 
-// Stored Prefix flags 
-constexpr std::uint16_t PRE_REPNE   		= 0x0001;
-constexpr std::uint16_t PRE_REPE   			= 0x0002;
-constexpr std::uint16_t PRE_66   			= 0x0004;
-constexpr std::uint16_t PRE_67   			= 0x0008;
-constexpr std::uint16_t PRE_LOCK 			= 0x0010;
-constexpr std::uint16_t PRE_SEG_CS  		= 0x0020;
-constexpr std::uint16_t PRE_SEG_SS  		= 0x0040;
-constexpr std::uint16_t PRE_SEG_DS  		= 0x0080;
-constexpr std::uint16_t PRE_SEG_ES  		= 0x0100;
-constexpr std::uint16_t PRE_SEG_FS  		= 0x0200;
-constexpr std::uint16_t PRE_SEG_GS  		= 0x0400;
-
 // Prefix bytes
 constexpr std::uint8_t OP_LOCK				= 0xF0;
 constexpr std::uint8_t OP_REPNE				= 0xF2;
@@ -1283,753 +1869,1891 @@ constexpr std::uint8_t OP_SEG_GS			= 0x65;
 
 
 
-disa_inst read(const std::uintptr_t address)
+static std::uint8_t append_reg(disa_record_operand& operand, const std::uint8_t reg_type)
+{
+	operand.reg[operand.reg[0] != DISA_NO_REG] = reg_type;
+	return reg_type;
+}
+
+// Decodes the instruction at `code`, which is located at
+// `address` in the target. Reads at most 16 bytes from `code`.
+// Only the structure is filled in here; see disa_format for the text
+static void read(const disa_index& index, const std::uint8_t* code, const std::uintptr_t address, disa_record& rec)
 {
-	disa_inst p = disa_inst();
-	p.address = address;
+	DISA_STATS(const std::uint64_t stats_start = disa_stats_clock());
 
-	std::memcpy(&p.bytes, reinterpret_cast<void*>(address), sizeof(p.bytes) / sizeof(std::uint8_t));
-	
-	std::uint8_t* at = p.bytes;
-	std::uint8_t* prev_at = at;
+	rec = disa_record();
+	rec.address = address;
 
-	for (std::size_t opcode_at = 0; opcode_at < disa_optable.size() - 1; at = prev_at, opcode_at++, p.flags = 0)
+	const bool mode64 = (index.mode == DISA_MODE_64);
+	const std::uint8_t* at = code;
+
+	// identify prefix of the instruction
+	switch (*at)
 	{
-		const auto op_info = disa_optable[opcode_at];
-		std::uint8_t opcode_byte = std::strtol(op_info.code.substr(0, 2).c_str(), nullptr, 16);
-		
-		bool show_prefix = false;
+	case OP_SEG_CS:
+		rec.prefix |= PRE_SEG_CS;
+		at++;
+		break;
+	case OP_SEG_SS:
+		rec.prefix |= PRE_SEG_SS;
+		at++;
+		break;
+	case OP_SEG_DS:
+		rec.prefix |= PRE_SEG_DS;
+		at++;
+		break;
+	case OP_SEG_ES:
+		rec.prefix |= PRE_SEG_ES;
+		at++;
+		break;
+	case OP_SEG_FS:
+		rec.prefix |= PRE_SEG_FS;
+		at++;
+		break;
+	case OP_SEG_GS:
+		rec.prefix |= PRE_SEG_GS;
+		at++;
+		break;
+	case OP_LOCK:
+		rec.prefix |= PRE_LOCK;
+		at++;
+		break;
+	case OP_REPNE:
+		rec.prefix |= PRE_REPNE;
+		at++;
+		break;
+	case OP_REPE:
+		rec.prefix |= PRE_REPE; 
+		at++;
+		break;
+		// I include 66/67 byte prefixes in the opcode table
+		// since they're used to imply a different instruction.
+		// so dont skip this byte. we need to compare it in the op table.
+		// other prefixes are simply tacked onto the text translation (p.data)
+	case OP_66:
+		rec.prefix |= PRE_66;
+		break;
+	case OP_67:
+		rec.prefix |= PRE_67;
+		break;
+	}
 
-		// identify prefix of the instruction
-		switch (*at)
-		{
-		case OP_SEG_CS:
-			p.flags |= PRE_SEG_CS;
-			*at++;
-			break;
-		case OP_SEG_SS:
-			p.flags |= PRE_SEG_SS;
-			*at++;
-			break;
-		case OP_SEG_DS:
-			p.flags |= PRE_SEG_DS;
-			*at++;
-			break;
-		case OP_SEG_ES:
-			p.flags |= PRE_SEG_ES;
-			*at++;
-			break;
-		case OP_SEG_FS:
-			p.flags |= PRE_SEG_FS;
-			*at++;
-			break;
-		case OP_SEG_GS:
-			p.flags |= PRE_SEG_GS;
-			*at++;
-			break;
-		case OP_LOCK:
-			p.flags |= PRE_LOCK;
-			*at++;
-
-			show_prefix = (opcode_byte != OP_LOCK) ? true : show_prefix;
-			break;
-		case OP_REPNE:
-			p.flags |= PRE_REPNE;
-			*at++;
-
-			show_prefix = (opcode_byte != OP_REPNE) ? true : show_prefix;
-			break;
-		case OP_REPE:
-			p.flags |= PRE_REPE; 
-			*at++;
+	std::uint8_t rex = 0;
+	std::uint8_t unrex[sizeof(disa_inst::bytes)];
+	std::size_t rex_skipped = 0;
 
-			show_prefix = (opcode_byte != OP_REPE) ? true : show_prefix;
-			break;
-			// I include 66/67 byte prefixes in the opcode table
-			// since they're used to imply a different instruction.
-			// so dont skip this byte. we need to compare it in the op table.
-			// other prefixes are simply tacked onto the text translation (p.data)
-		case OP_66:
-			p.flags |= PRE_66;
-			break;
-		case OP_67:
-			p.flags |= PRE_67;
-			break;
-		}
+	if (mode64)
+	{
+		rec.prefix |= PRE_MODE_64;
 
-		bool opcode_match = (*at == opcode_byte);
-		bool reg_from_opcode_byte = false;
+		// A REX prefix sits right before the opcode. After a 66/67 (which
+		// stay in front of the opcode for the table lookup) it's taken out
+		// of a copy of the bytes instead
+		const std::uint8_t* const p = (rec.prefix & (PRE_66 | PRE_67)) ? at + 1 : at;
 
-		// This is a hard-coded parse I wrote a while back
-		// It's not bad in terms of working consistently.
-		// But it is ugly.
-		for (std::size_t i = 2; i < 11; i += 3)
+		if ((*p & 0xF0) == 0x40)
 		{
-			// op_info.code may look like: "83+m0"
-			// we want to start at the character after 83
-			// and begin parsing the expressions
-			if (!(op_info.code.length() > i))
+			rex = *p;
+			rec.prefix |= PRE_REX | ((rex & 8) ? PRE_REX_W : 0);
+
+			if (p == at)
 			{
-				break;
+				at++;
 			}
 			else
 			{
-				// Extended byte?
-				if (op_info.code[i] == '+')
-				{
-					// Check if the opcode byte determines the register
-					if (op_info.code[i + 1] == 'r')
-					{
-						reg_from_opcode_byte = true;
-
-						// this simple check can simplify instructons like inc/dec/push/pop
-						// in our opcode table so it can do up to 8 combinations
-						// All we have to put is put `40+r` (rather than 40, 41, 42, 43,...)
-						opcode_match = (*at >= opcode_byte) && (*at < opcode_byte + 8);
-						break;
-					}
-					else if (op_info.code[i + 1] == 'm' && opcode_match)
-					{
-						std::string str = "0";
-						str += op_info.code[i + 2];
-						std::uint8_t n = std::strtol(str.c_str(), nullptr, 16);
-
-						if (n >= 0 && n < 8)
-						{
-							// for every +8 it switches to a different opcode out of 8
-							opcode_match = longreg(*(at + 1)) == n;
-						}
-						else {
-							// for every +8 it switches to a different opcode out of 8
-							// IF the mode is 3 / the byte is >= 0xC0
-							n -= 8;
-							opcode_match = longreg(*(at + 1)) == n && *(at + 1) >= 0xC0;
-						}
-						break;
-					}
-					else if (opcode_match)
-					{
-						// in all other cases, it's an extending byte
-						at++;
+				unrex[0] = *at;
+				std::memcpy(unrex + 1, p + 1, sizeof(unrex) - 2);
+				unrex[sizeof(unrex) - 1] = 0;
 
-						opcode_byte = std::strtol(op_info.code.substr(i + 1, 2).c_str(), nullptr, 16);
-						opcode_match = (*at == opcode_byte);
-					}
-				}
+				code = unrex;
+				at = unrex;
+				rex_skipped = 1;
 			}
 		}
+	}
 
-		// The bytes after the prefix seem to match the byte(s) 
-		// for this particular opcode
-		if (opcode_match)
-		{
-			// So now we can include information about the prefix
-			// to our text translation
-			if (show_prefix)
-			{
-				if (p.flags & PRE_LOCK)  p.data += "lock ";
-				if (p.flags & PRE_REPNE) p.data += "repne ";
-				if (p.flags & PRE_REPE)  p.data += "repe ";
-			}
-
-			p.data += op_info.opcode_name + " ";
+	// REX.R extends ModRM.reg, REX.X the SIB index and REX.B
+	// ModRM.rm, the SIB base or the register in the opcode byte
+	const std::uint8_t rex_r = (rex & 4) ? 8 : 0;
+	const std::uint8_t rex_x = (rex & 2) ? 8 : 0;
+	const std::uint8_t rex_b = (rex & 1) ? 8 : 0;
 
-			// We're ready to move onto the next byte.
-			// We can start processing mnemonics 
-			at++;
+	const std::uint16_t row = disa_lookup(index, at);
 
-			std::size_t noperands = op_info.operands.size();
+	// The bytes after the prefix match the byte(s) 
+	// for one of the opcodes in our table
+	if (row != DISA_NO_ROW)
+	{
+		const auto& op_info = disa_optable[row];
+		const bool reg_from_opcode_byte = (op_info.group == 'r');
 
-			p.operands = std::vector<disa_operand>(noperands); // allocate for the # of operands
-			p.info = op_info;
+		// We're ready to move onto the next byte.
+		// We can start processing mnemonics 
+		at += op_info.nbytes;
 
-			// append flags which help users identify
-			// what type of instruction this is
-			switch (noperands)
-			{
-			case 0:
-				break;
-			case 1:
-				p.flags |= OP_SINGLE; // uses 1 register (source)
-				break;
-			case 2:
-				p.flags |= OP_SRC_DEST; // uses 2 registers (source/destination)
-				break;
-			default:
-				p.flags |= OP_EXTENDED; // uses 3+ registers
-				break;
-			}
+		const std::size_t noperands = op_info.operands.count;
 
-			const std::uint8_t mod_byte_not_first = 255;
-			auto prev = mod_byte_not_first;
+		rec.row = row;
+		rec.noperands = static_cast<std::uint8_t>(noperands);
 
-			// Iterate through all of the operands in this information bit
-			for (std::size_t c = 0; c < noperands; c++)
-			{
-				// c = current operand (index)
-				// append this opmode to that of the corresponding operand
-				p.operands[c].opmode = op_info.operands[c];
+		// sizes of the r16_32 registers, and of the registers in [...]
+		const std::uint32_t op_size = disa_op64(rec) ? OP_R64 : OP_R32;
+		const std::uint32_t addr_size = (mode64 && !(rec.prefix & PRE_67)) ? OP_R64 : OP_R32;
+		const bool moffs64 = (mode64 && !(rec.prefix & PRE_67));
 
-				// Returns the imm8 offset value at `x`
-				// and then increases `at` by imm8 size.
-				const auto get_imm8 = [&p, &c, &at](auto x, bool constant)
-				{
-					std::stringstream ss;
+		// mov to/from a control or debug register: the r/m is a register whatever
+		// the mod, and always moves 64 bits in 64-bit mode
+		bool control_move = false;
 
-					if (!constant)
-					{
-						p.operands[c].imm8 = *x;
-						p.operands[c].flags |= OP_IMM8;
-
-						if (*x > CHAR_MAX)
-							ss << "-" << std::setfill('0') << std::setw(2) << std::uppercase << std::hex << static_cast<uint32_t>(((UCHAR_MAX + 1) - p.operands[c].imm8));
-						else
-						{
-							ss << "+" << std::setfill('0') << std::setw(2) << std::uppercase << std::hex << static_cast<uint32_t>(p.operands[c].imm8);
-						}
-					}
-					else 
-					{
-						p.operands[c].disp8 = *x;
-						p.operands[c].flags |= OP_DISP8;
+		for (std::size_t c = 0; c < noperands; c++)
+		{
+			control_move |= (op_info.operands.types[c] == disa_optypes::CRn || op_info.operands.types[c] == disa_optypes::DRn);
+		}
 
-						ss << std::setfill('0') << std::setw(2) << std::uppercase << std::hex << static_cast<uint32_t>(p.operands[c].disp8);
-					}
+		const std::uint8_t mod_byte_not_first = 255;
+		auto prev = mod_byte_not_first;
 
-					p.data += ss.str();
+		// Iterate through all of the operands in this information bit
+		for (std::size_t c = 0; c < noperands; c++)
+		{
+			// c = current operand (index)
+			// append this opmode to that of the corresponding operand
+			auto& op = rec.operands[c];
+			op.opmode = op_info.operands.types[c];
+
+			// Reads the imm8 offset value at `x`
+			// and then increases `at` by imm8 size.
+			const auto get_imm8 = [&op, &at](auto x, bool constant)
+			{
+				if (!constant)
+				{
+					op.value = *x;
+					op.flags |= OP_IMM8;
+				}
+				else 
+				{
+					op.value = *x;
+					op.flags |= OP_DISP8;
+				}
 
-					at += sizeof(std::uint8_t);
-				};
+				at += sizeof(std::uint8_t);
+			};
 
-				// Returns the imm16 offset value at `x`
-				// and then increases `at` by imm16 size.
-				const auto get_imm16 = [&p, &c, &at](auto x, bool constant)
+			// Reads the imm16 offset value at `x`
+			// and then increases `at` by imm16 size.
+			const auto get_imm16 = [&op, &at](auto x, bool constant)
+			{
+				if (!constant)
+				{
+					op.value = *reinterpret_cast<const std::uint16_t*>(x);
+					op.flags |= OP_IMM16;
+				}
+				else
 				{
-					std::stringstream ss;
+					op.value = *reinterpret_cast<const std::uint16_t*>(x);
+					op.flags |= OP_DISP16;
+				}
 
-					if (!constant)
-					{
-						p.operands[c].imm16 = *reinterpret_cast<std::uint16_t*>(x);
-						p.operands[c].flags |= OP_IMM16;
-
-						if (*x > INT16_MAX)
-							ss << "-" << std::setfill('0') << std::setw(4) << std::uppercase << std::hex << static_cast<uint32_t>(((UINT16_MAX + 1) - p.operands[c].imm16));
-						else 
-						{
-							ss << "+" << std::setfill('0') << std::setw(4) << std::uppercase << std::hex << static_cast<uint32_t>(p.operands[c].imm16);
-						}
-					}
-					else {
-						p.operands[c].disp16 = *reinterpret_cast<std::uint16_t*>(x);
-						p.operands[c].flags |= OP_DISP16;
+				at += sizeof(std::uint16_t);
+			};
 
-						ss << std::setfill('0') << std::setw(4) << std::uppercase << std::hex << static_cast<uint32_t>(p.operands[c].disp16);
-					}
+			// Reads the imm32 offset value at `x`
+			// and then increases `at` by imm32 size.
+			const auto get_imm32 = [&op, &at](auto x, bool constant)
+			{
+				if (!constant)
+				{
+					op.value = *reinterpret_cast<const std::uint32_t*>(x);
+					op.flags |= OP_IMM32;
+				}
+				else
+				{
+					op.value = *reinterpret_cast<const std::uint32_t*>(x);
+					op.flags |= OP_DISP32;
+				}
 
-					p.data += ss.str();
+				at += sizeof(std::uint32_t);
+			};
 
-					at += sizeof(std::uint16_t);
-				};
+			// Reads the imm64/moffs64 value at `x` (the upper half
+			// goes into operands[3], see disa_record::value64)
+			// and then increases `at` by imm64 size.
+			const auto get_imm64 = [&op, &at, &rec](auto x)
+			{
+				op.value = *reinterpret_cast<const std::uint32_t*>(x);
+				rec.operands[3].value = *reinterpret_cast<const std::uint32_t*>(x + sizeof(std::uint32_t));
+				op.flags |= OP_DISP64;
 
-				// Returns the imm32 offset value at `x`
-				// and then increases `at` by imm32 size.
-				const auto get_imm32 = [&p, &c, &at](auto x, bool constant)
-				{
-					std::stringstream ss;
+				at += sizeof(std::uint64_t);
+			};
 
-					if (!constant)
-					{
-						p.operands[c].imm32 = *reinterpret_cast<std::uint32_t*>(x);
-						p.operands[c].flags |= OP_IMM32;
-
-						if (*x > INT16_MAX)
-							ss << "-" << std::setfill('0') << std::setw(8) << std::uppercase << std::hex << ((UINT32_MAX + 1) - p.operands[c].imm32);
-						else
-						{
-							ss << "+" << std::setfill('0') << std::setw(8) << std::uppercase << std::hex << p.operands[c].imm32;
-						}
-					}
-					else
+			const auto get_sib = [&get_imm8, &get_imm32, &op, &at, rex_x, rex_b, addr_size](const std::uint8_t imm)
+			{
+				// get the SIB byte based on the operand's MOD byte.
+				// See http://www.c-jump.com/CIS77/CPU/x86/X77_0100_sib_byte_layout.htm
+				// See https://www.cs.uaf.edu/2002/fall/cs301/Encoding%20instructions.htm
+				// 
+				// To-do: Label the values that make up scale, index, and byte
+				// I didn't label too much here so it is pretty indecent atm...
+				// 
+
+				const std::uint8_t sib_byte = *++at; // notice we skip to the next byte for this
+				const std::uint8_t r1 = longreg(sib_byte);
+				const std::uint8_t r2 = finalreg(sib_byte);
+
+				// (an index of 4 is no index, unless REX.X makes it r12)
+				if ((sib_byte + 32) / 32 % 2 == 0 && sib_byte % 32 < 8 && !rex_x)
+				{
+					// with no base either, it's only the disp32
+					if (!(r2 == 5 && *(at - 1) < 64))
 					{
-						p.operands[c].disp32 = *reinterpret_cast<std::uint32_t*>(x);
-						p.operands[c].flags |= OP_DISP32;
-
-						ss << std::setfill('0') << std::setw(8) << std::uppercase << std::hex << p.operands[c].disp32;
+						append_reg(op, r2 + rex_b);
+						op.flags |= addr_size;
 					}
-
-					p.data += ss.str();
-
-					at += sizeof(std::uint32_t);
-				};
-
-				const auto get_sib = [&get_imm8, &get_imm32, &p, &at, &c](const std::uint8_t imm)
+				}
+				else
 				{
-					// get the SIB byte based on the operand's MOD byte.
-					// See http://www.c-jump.com/CIS77/CPU/x86/X77_0100_sib_byte_layout.htm
-					// See https://www.cs.uaf.edu/2002/fall/cs301/Encoding%20instructions.htm
-					// 
-					// To-do: Label the values that make up scale, index, and byte
-					// I didn't label too much here so it is pretty indecent atm...
-					// 
-
-					const std::uint8_t sib_byte = *++at; // notice we skip to the next byte for this
-					const std::uint8_t r1 = longreg(sib_byte);
-					const std::uint8_t r2 = finalreg(sib_byte);
-
-					if ((sib_byte + 32) / 32 % 2 == 0 && sib_byte % 32 < 8)
+					// we need to check the previous byte in this circumstance
+					if (r2 == 5 && *(at - 1) < 64)
 					{
-						// 
-						p.data += mnemonics::r32_names[p.operands[c].append_reg(r2)];
-						p.operands[c].flags |= OP_R32;
+						append_reg(op, r1 + rex_x);
+						op.flags |= addr_size;
 					}
 					else
 					{
-						// we need to check the previous byte in this circumstance
-						if (r2 == 5 && *(at - 1) < 64)
-						{
-							p.data += mnemonics::r32_names[p.operands[c].append_reg(r1)];
-							p.operands[c].flags |= OP_R32;
-						}
-						else
-						{
-							p.data += mnemonics::r32_names[p.operands[c].append_reg(r2)];
-							p.data += "+"; // + SIB Base
-							p.data += mnemonics::r32_names[p.operands[c].append_reg(r1)];
-							p.operands[c].flags |= OP_R32;
-						}
-
-						// Calculate SIB Scale
-						if (sib_byte / 64)
-						{
-							p.operands[c].mul = multipliers[sib_byte / 64];
-
-							std::stringstream ss;
-							ss << "*" << p.operands[c].mul;
-
-							p.data += ss.str();
-						}
+						append_reg(op, r2 + rex_b); // + SIB Base
+						append_reg(op, r1 + rex_x);
+						op.flags |= addr_size;
 					}
 
-					if (imm == sizeof(std::uint8_t))
+					// Calculate SIB Scale
+					if (sib_byte / 64)
 					{
-						get_imm8(at + 1, false);
-					}
-					else if (imm == sizeof(std::uint32_t) || (imm == 0 && r2 == 5))
-					{
-						get_imm32(at + 1, true);
+						op.mul = multipliers[sib_byte / 64];
 					}
-				};
+				}
 
-				// Gets the relative offset value at `x`
-				// and then increases `at` by rel8 size.
-				const auto get_rel8 = [&p, &c, &at](auto x)
+				if (imm == sizeof(std::uint8_t))
 				{
-					// get the current address of where `at` is located
-					const std::uint32_t location = p.address + (reinterpret_cast<std::uint32_t>(x) - reinterpret_cast<std::uint32_t>(p.bytes));
-					
-					// base the 8-bit relative offset on it
-					p.operands[c].rel8 = *reinterpret_cast<std::uint8_t*>(x);
-
-					std::stringstream ss;
-					ss << std::setfill('0') << std::setw(8) << std::uppercase << std::hex << (location + sizeof(std::uint8_t) + p.operands[c].rel8);
-					
-					p.data += ss.str();
-
-					at += sizeof(std::uint8_t);
-				};
-
-				// Gets the relative offset value at `x`
-				// and then increases `at` by rel16 size.
-				const auto get_rel16 = [&p, &c, &at](auto x)
+					get_imm8(at + 1, false);
+				}
+				else if (imm == sizeof(std::uint32_t) || (imm == 0 && r2 == 5))
 				{
-					// get the current address of where `at` is located
-					const std::uint32_t location = p.address + (reinterpret_cast<std::uint32_t>(x) - reinterpret_cast<std::uint32_t>(p.bytes));
-					
-					// base the 16-bit relative offset on it
-					p.operands[c].rel16 = *reinterpret_cast<std::uint16_t*>(x);
+					get_imm32(at + 1, true);
+				}
+			};
 
-					std::stringstream ss;
-					ss << std::setfill('0') << std::setw(8) << std::uppercase << std::hex << (location + sizeof(std::uint16_t) + p.operands[c].rel16);
+			// Reads the relative offset value at `x`
+			// and then increases `at` by rel8 size.
+			const auto get_rel8 = [&op, &at](auto x)
+			{
+				op.value = *reinterpret_cast<const std::uint8_t*>(x);
+				at += sizeof(std::uint8_t);
+			};
 
-					p.data += ss.str();
+			// Reads the relative offset value at `x`
+			// and then increases `at` by rel16 size.
+			const auto get_rel16 = [&op, &at](auto x)
+			{
+				op.value = *reinterpret_cast<const std::uint16_t*>(x);
+				at += sizeof(std::uint16_t);
+			};
 
-					at += sizeof(std::uint16_t);
-				};
+			// Reads the relative offset value at `x`
+			// and then increases `at` by rel32 size.
+			const auto get_rel32 = [&op, &at](auto x)
+			{
+				op.value = *reinterpret_cast<const std::uint32_t*>(x);
+				at += sizeof(std::uint32_t);
+			};
 
-				// Gets the relative offset value at `x`
-				// and then increases `at` by rel32 size.
-				const auto get_rel32 = [&p, &c, &at](auto x)
-				{
-					// get the current address of where `at` is located
-					const std::uint32_t location = p.address + (reinterpret_cast<std::uint32_t>(x) - reinterpret_cast<std::uint32_t>(p.bytes));
-					// base the 32-bit relative offset on it
-					p.operands[c].rel32 = *reinterpret_cast<std::uint32_t*>(x);
+			std::uint8_t r = prev;
 
-					std::stringstream ss;
-					ss << std::setfill('0') << std::setw(8) << std::uppercase << std::hex << (location + sizeof(std::uint32_t) + p.operands[c].rel32);
+			// grab the basic register initially
+			if (prev == mod_byte_not_first)
+			{
+				r = longreg(*at);
+			}
 
-					p.data += ss.str();
+			if (reg_from_opcode_byte)
+			{
+				r = finalreg(*(at - 1));
+			}
 
-					at += sizeof(std::uint32_t);
-				};
+			const std::uint8_t reg_ext = reg_from_opcode_byte ? rex_b : rex_r;
 
-				const auto apply_segment_info = [&p]()
-				{
-					if (p.flags & PRE_SEG_CS) p.data += "cs:";
-					if (p.flags & PRE_SEG_DS) p.data += "ds:";
-					if (p.flags & PRE_SEG_ES) p.data += "es:";
-					if (p.flags & PRE_SEG_SS) p.data += "ss:";
-					if (p.flags & PRE_SEG_FS) p.data += "fs:";
-					if (p.flags & PRE_SEG_GS) p.data += "gs:";
-				};
-
-				std::uint8_t r = prev;
-
-				// grab the basic register initially
-				if (prev == mod_byte_not_first)
+			switch (op.opmode)
+			{
+			case disa_optypes::one:
+				op.value = 1;
+				break;
+			case disa_optypes::xmm0:
+				append_reg(op, 0);
+				op.flags |= OP_XMM;
+				break;
+			case disa_optypes::AL:
+				append_reg(op, R8_AL);
+				op.flags |= OP_R8;
+				break;
+			case disa_optypes::AH:
+				append_reg(op, R8_AH);
+				op.flags |= OP_R8;
+				break;
+			case disa_optypes::AX:
+				append_reg(op, R16_AX);
+				op.flags |= OP_R16;
+				break;
+			case disa_optypes::CL:
+				append_reg(op, R8_CL);
+				op.flags |= OP_R8;
+				break;
+			case disa_optypes::EAX:
+				append_reg(op, R32_EAX);
+				op.flags |= op_size;
+				break;
+			case disa_optypes::ECX:
+				append_reg(op, R32_ECX);
+				op.flags |= op_size;
+				break;
+			case disa_optypes::EBP:
+				append_reg(op, R32_EBP);
+				op.flags |= op_size;
+				break;
+			case disa_optypes::DRn:
+				append_reg(op, r);
+				op.flags |= OP_DR;
+				break;
+			case disa_optypes::CRn:
+				append_reg(op, r + reg_ext);
+				op.flags |= OP_CR;
+				break;
+			case disa_optypes::ST:
+				append_reg(op, 0);
+				op.flags |= OP_ST;
+				break;
+			case disa_optypes::Sreg:
+				append_reg(op, r);
+				op.flags |= OP_SREG;
+				break;
+			case disa_optypes::mm:
+				append_reg(op, r);
+				op.flags |= OP_MM;
+				break;
+			case disa_optypes::xmm:
+				append_reg(op, r + reg_ext);
+				op.flags |= OP_XMM;
+				break;
+			case disa_optypes::r8:
+				append_reg(op, r + reg_ext);
+				op.flags |= OP_R8;
+				break;
+			case disa_optypes::r16:
+				append_reg(op, r + reg_ext);
+				op.flags |= OP_R16;
+				break;
+			case disa_optypes::r16_32:
+				append_reg(op, r + reg_ext);
+				op.flags |= op_size;
+				break;
+			case disa_optypes::r32:
+				append_reg(op, r + reg_ext);
+				op.flags |= OP_R32;
+				break;
+			case disa_optypes::r64:
+				append_reg(op, r + reg_ext);
+				op.flags |= OP_R64;
+				break;
+			case disa_optypes::m8:
+			case disa_optypes::m16:
+			case disa_optypes::m16_32:
+			case disa_optypes::m32:
+			case disa_optypes::m64real:
+			case disa_optypes::r_m8:
+			case disa_optypes::r_m16:
+			case disa_optypes::r_m16_32:
+			case disa_optypes::r_m32:
+			case disa_optypes::m16_32_and_16_32:
+			case disa_optypes::m128:
+			case disa_optypes::mm_m64:
+			case disa_optypes::xmm_m32:
+			case disa_optypes::xmm_m64:
+			case disa_optypes::xmm_m128:
+			case disa_optypes::STi:
+			case disa_optypes::moffs16_32: // segment info applies to this actually
+			{
+				// Potentially holds a memory offset/pointer?
+				if (op.opmode == disa_optypes::moffs16_32)
 				{
-					r = longreg(*at);
+					if (moffs64) get_imm64(at);
+					else get_imm32(at, true); // changes to a disp32
+					op.flags |= OP_MEM;
+					break;
 				}
 
-				if (reg_from_opcode_byte)
-				{
-					r = finalreg(*(at - 1));
-				}
+				if (c == 0) prev = r;
 
-				switch (p.operands[c].opmode)
-				{
-				case disa_optypes::one:
-					p.operands[c].disp32 = p.operands[c].disp16 = p.operands[c].disp8 = 1;
-					p.data += "1";
-					break;
-				case disa_optypes::xmm0:
-					p.operands[c].append_reg(0);
-					p.data += "xmm0";
-					p.operands[c].flags |= OP_XMM;
-					break;
-				case disa_optypes::AL:
-					p.operands[c].append_reg(R8_AL);
-					p.data += "al";
-					p.operands[c].flags |= OP_R8;
-					break;
-				case disa_optypes::AH:
-					p.operands[c].append_reg(R8_AH);
-					p.data += "ah";
-					p.operands[c].flags |= OP_R8;
-					break;
-				case disa_optypes::AX:
-					p.operands[c].append_reg(R16_AX);
-					p.data += "ax";
-					p.operands[c].flags |= OP_R16;
-					break;
-				case disa_optypes::CL:
-					p.operands[c].append_reg(R8_CL);
-					p.data += "cl";
-					p.operands[c].flags |= OP_R8;
-					break;
-				case disa_optypes::ES:
-					p.data += "es";
-					break;
-				case disa_optypes::SS:
-					p.data += "ss";
-					break;
-				case disa_optypes::DS:
-					p.data += "ds";
-					break;
-				case disa_optypes::GS:
-					p.data += "gs";
-					break;
-				case disa_optypes::FS:
-					p.data += "fs";
-					break;
-				case disa_optypes::EAX:
-					p.operands[c].append_reg(R32_EAX);
-					p.data += "eax";
-					p.operands[c].flags |= OP_R32;
-					break;
-				case disa_optypes::ECX:
-					p.operands[c].append_reg(R32_ECX);
-					p.data += "ecx";
-					p.operands[c].flags |= OP_R32;
-					break;
-				case disa_optypes::EBP:
-					p.operands[c].append_reg(R32_EBX);
-					p.data += "ebp";
-					p.operands[c].flags |= OP_R32;
-					break;
-				case disa_optypes::DRn:
-					p.data += mnemonics::dr_names[p.operands[c].append_reg(r)];
-					p.operands[c].flags |= OP_DR;
-					break;
-				case disa_optypes::CRn:
-					p.data += mnemonics::cr_names[p.operands[c].append_reg(r)];
-					p.operands[c].flags |= OP_CR;
-					break;
-				case disa_optypes::ST:
-					p.data += mnemonics::st_names[p.operands[c].append_reg(0)];
-					p.operands[c].flags |= OP_ST;
-					break;
-				case disa_optypes::Sreg:
-					p.data += mnemonics::sreg_names[p.operands[c].append_reg(r)];
-					p.operands[c].flags |= OP_SREG;
-					break;
-				case disa_optypes::mm:
-					p.data += mnemonics::mm_names[p.operands[c].append_reg(r)];
-					p.operands[c].flags |= OP_MM;
-					break;
-				case disa_optypes::xmm:
-					p.data += mnemonics::xmm_names[p.operands[c].append_reg(r)];
-					p.operands[c].flags |= OP_XMM;
-					break;
-				case disa_optypes::r8:
-					p.data += mnemonics::r8_names[p.operands[c].append_reg(r)];
-					p.operands[c].flags |= OP_R8;
-					break;
-				case disa_optypes::r16:
-					p.data += mnemonics::r16_names[p.operands[c].append_reg(r)];
-					p.operands[c].flags |= OP_R16;
-					break;
-				case disa_optypes::r16_32:
-				case disa_optypes::r32:
-					p.data += mnemonics::r32_names[p.operands[c].append_reg(r)];
-					p.operands[c].flags |= OP_R32;
-					break;
-				case disa_optypes::r64:
-					p.data += mnemonics::r64_names[p.operands[c].append_reg(r)];
-					p.operands[c].flags |= OP_R64;
-					break;
-				case disa_optypes::m8:
-				case disa_optypes::m16:
-				case disa_optypes::m16_32:
-				case disa_optypes::m32:
-				case disa_optypes::m64real:
-				case disa_optypes::r_m8:
-				case disa_optypes::r_m16:
-				case disa_optypes::r_m16_32:
-				case disa_optypes::r_m32:
-				case disa_optypes::m16_32_and_16_32:
-				case disa_optypes::m128:
-				case disa_optypes::mm_m64:
-				case disa_optypes::xmm_m32:
-				case disa_optypes::xmm_m64:
-				case disa_optypes::xmm_m128:
-				case disa_optypes::STi:
-				case disa_optypes::moffs16_32: // segment info applies to this actually
+				r = finalreg(*at);
+
+				switch (control_move ? 3 : *at / 64) // determine mode from `MOD` byte
 				{
-					// Potentially holds a memory offset/pointer?
-					// apply segment information...
-					apply_segment_info();
+				case 3:
+					// (REX.B doesn't reach the mm and st registers)
+					append_reg(op, (op.opmode == disa_optypes::mm_m64 || op.opmode == disa_optypes::STi) ? r : r + rex_b);
 
-					// small edit..
-					if (p.operands[c].opmode == disa_optypes::moffs16_32)
+					switch (op.opmode)
 					{
-						p.data += "[";
-						get_imm32(at, true); // changes to a disp32
-						p.data += "]";
+					case disa_optypes::r_m8:
+					case disa_optypes::m8:
+						op.flags |= OP_R8;
+						break;
+					case disa_optypes::r_m16:
+					case disa_optypes::m16:
+						op.flags |= OP_R16;
+						break;
+					case disa_optypes::mm_m64:
+						op.flags |= OP_MM;
+						break;
+					case disa_optypes::xmm_m32:
+					case disa_optypes::xmm_m64:
+					case disa_optypes::xmm_m128:
+					case disa_optypes::m128:
+						op.flags |= OP_XMM;
+						break;
+					case disa_optypes::ST:
+					case disa_optypes::STi:
+						op.flags |= OP_ST;
+						break;
+					case disa_optypes::CRn:
+						op.flags |= OP_CR;
+						break;
+					case disa_optypes::DRn:
+						op.flags |= OP_DR;
+						break;
+					case disa_optypes::r_m16_32:
+					case disa_optypes::m16_32:
+						op.flags |= op_size;
+						break;
+					default: // Anything else is going to be 32-bit
+						op.flags |= (control_move && mode64) ? OP_R64 : OP_R32;
 						break;
 					}
+					break;
+				case 0:
+					op.flags |= OP_MEM;
 
-					if (c == 0) prev = r;
-
-					r = finalreg(*at);
-
-					switch (*at / 64) // determine mode from `MOD` byte
-					{
-					case 3:
-						switch (p.operands[c].opmode)
-						{
-						case disa_optypes::r_m8:
-						case disa_optypes::m8:
-							p.data += mnemonics::r8_names[p.operands[c].append_reg(r)];
-							p.operands[c].flags |= OP_R8;
-							break;
-						case disa_optypes::r_m16:
-						case disa_optypes::m16:
-							p.data += mnemonics::r16_names[p.operands[c].append_reg(r)];
-							p.operands[c].flags |= OP_R16;
-							break;
-						case disa_optypes::mm_m64:
-							p.data += mnemonics::mm_names[p.operands[c].append_reg(r)];
-							p.operands[c].flags |= OP_MM;
-							break;
-						case disa_optypes::xmm_m32:
-						case disa_optypes::xmm_m64:
-						case disa_optypes::xmm_m128:
-						case disa_optypes::m128:
-							p.data += mnemonics::xmm_names[p.operands[c].append_reg(r)];
-							p.operands[c].flags |= OP_XMM;
-							break;
-						case disa_optypes::ST:
-						case disa_optypes::STi:
-							p.data += mnemonics::st_names[p.operands[c].append_reg(r)];
-							p.operands[c].flags |= OP_ST;
-							break;
-						case disa_optypes::CRn:
-							p.data += mnemonics::cr_names[p.operands[c].append_reg(r)];
-							p.operands[c].flags |= OP_CR;
-							break;
-						case disa_optypes::DRn:
-							p.data += mnemonics::dr_names[p.operands[c].append_reg(r)];
-							p.operands[c].flags |= OP_DR;
-							break;
-						default: // Anything else is going to be 32-bit
-							p.data += mnemonics::r32_names[p.operands[c].append_reg(r)];
-							p.operands[c].flags |= OP_R32;
-							break;
-						}
-						break;
-					case 0:
+					switch (r)
 					{
-						p.data += "[";
-
-						switch (r)
-						{
-						case 4:
-							get_sib(0); // Translate SIB byte (no offsets)
-							break;
-						case 5:
-						{
-							p.operands[c].disp32 = *reinterpret_cast<std::uint32_t*>(at + 1);
-							p.operands[c].flags |= OP_DISP32;
-
-							std::stringstream ss;
-							ss << std::setfill('0') << std::setw(8) << std::uppercase << std::hex << p.operands[c].disp32;
-
-							p.data += ss.str();
-
-							at += sizeof(std::uint32_t);
-							break;
-						}
-						default:
-							p.data += mnemonics::r32_names[p.operands[c].append_reg(r)];
-							p.operands[c].flags |= OP_R32;
-							break;
-						}
-
-						p.data += "]";
+					case 4:
+						get_sib(0); // Translate SIB byte (no offsets)
 						break;
-					}
-					case 1:
-						p.data += "[";
-
-						if (r == 4)
-							get_sib(sizeof(std::uint8_t)); // Translate SIB byte (with BYTE offset)
-						else 
-						{
-							p.data += mnemonics::r32_names[p.operands[c].append_reg(r)];
-							p.operands[c].flags |= OP_R32;
-							get_imm8(at + 1, false);
-						}
-
-						p.data += "]";
+					case 5:
+						// [rip+disp32] in 64-bit mode
+						op.value = *reinterpret_cast<const std::uint32_t*>(at + 1);
+						op.flags |= OP_DISP32 | (mode64 ? OP_RIP : 0);
+						at += sizeof(std::uint32_t);
 						break;
-					case 2:
-						p.data += "[";
-
-						if (r == 4)
-							get_sib(sizeof(std::uint32_t)); // Translate SIB byte (with DWORD offset)
-						else 
-						{
-							p.data += mnemonics::r32_names[p.operands[c].append_reg(r)];
-							p.operands[c].flags |= OP_R32;
-							get_imm32(at + 1, false);
-						}
-
-						p.data += "]";
+					default:
+						append_reg(op, r + rex_b);
+						op.flags |= addr_size;
 						break;
 					}
-					at++;
 					break;
-				}
-				case disa_optypes::imm8:
-					get_imm8(at, true); // changes to a disp32
-					break;
-				case disa_optypes::imm16:
-					get_imm16(at, true); // changes to a disp32
-					break;
-				case disa_optypes::imm16_32:
-				case disa_optypes::imm32:
-					get_imm32(at, true); // changes to a disp32
-					break;
-				case disa_optypes::moffs8:
-					p.data += "[";
-					get_imm32(at, true); // changes to a disp32
-					p.data += "]";
-					break;
-				case disa_optypes::rel8:
-					get_rel8(at);
-					break;
-				case disa_optypes::rel16:
-					get_rel16(at);
-					break;
-				case disa_optypes::rel16_32:
-				case disa_optypes::rel32:
-					get_rel32(at);
-					break;
-				case disa_optypes::ptr16_32:
-					get_imm32(at, true);
-					p.data += ":";
-					get_imm16(at, true);
+				case 1:
+					op.flags |= OP_MEM;
+
+					if (r == 4)
+						get_sib(sizeof(std::uint8_t)); // Translate SIB byte (with BYTE offset)
+					else 
+					{
+						append_reg(op, r + rex_b);
+						op.flags |= addr_size;
+						get_imm8(at + 1, false);
+					}
 					break;
-				}
+				case 2:
+					op.flags |= OP_MEM;
 
-				// move up to the next operand
-				if (c < noperands - 1 && noperands > 1)
-				{
-					p.data += ",";
+					if (r == 4)
+						get_sib(sizeof(std::uint32_t)); // Translate SIB byte (with DWORD offset)
+					else 
+					{
+						append_reg(op, r + rex_b);
+						op.flags |= addr_size;
+						get_imm32(at + 1, false);
+					}
+					break;
 				}
+				at++;
+				break;
+			}
+			case disa_optypes::imm8:
+				get_imm8(at, true); // changes to a disp32
+				break;
+			case disa_optypes::imm16:
+				// REX.W wins over the 66 of 66 C7 (mov r/m64, imm32)
+				if (rex & 8)
+					get_imm32(at, true);
+				else
+					get_imm16(at, true); // changes to a disp32
+				break;
+			case disa_optypes::imm16_32:
+			case disa_optypes::imm32:
+				// mov r64, imm64 is the only instruction with a 64-bit immediate
+				if ((rex & 8) && reg_from_opcode_byte && op_info.bytes[0] == 0xB8)
+					get_imm64(at);
+				else
+					get_imm32(at, true); // changes to a disp32
+				break;
+			case disa_optypes::moffs8:
+				if (moffs64) get_imm64(at);
+				else get_imm32(at, true); // changes to a disp32
+				op.flags |= OP_MEM;
+				break;
+			case disa_optypes::rel8:
+				get_rel8(at);
+				break;
+			case disa_optypes::rel16:
+				get_rel16(at);
+				break;
+			case disa_optypes::rel16_32:
+			case disa_optypes::rel32:
+				get_rel32(at);
+				break;
+			case disa_optypes::ptr16_32:
+				get_imm32(at, true);
+				rec.selector = *reinterpret_cast<const std::uint16_t*>(at);
+				op.flags |= OP_DISP16;
+				at += sizeof(std::uint16_t);
+				break;
 			}
-
-			break;
 		}
 	}
+	else
+	{
+		at = code;
+		rex_skipped = 0;
+		rec.prefix = mode64 ? PRE_MODE_64 : 0;
+	}
 
-	p.len = reinterpret_cast<std::size_t>(at) - reinterpret_cast<std::size_t>(p.bytes);
+	rec.len = static_cast<std::uint8_t>(at - code + rex_skipped);
 
-	if (p.len == 0)
+	if (rec.len == 0)
 	{
-		p.len = 1;
-		p.data = "???";
+		rec.len = 1;
 	}
 
-	return p;
+	DISA_STATS(disa_stats_decoded(rec, stats_start));
 }
 
-disa_inst disa_read(const std::uintptr_t address)
+// Writes text into a caller-supplied buffer.
+// Everything past the end of the buffer is counted but dropped,
+// and the buffer is always null-terminated (if there is one)
+struct disa_writer
 {
-	return read(address);
-}
+	char* at;
+	char* end; // last byte, kept for the terminator. Null if there's no buffer (size 0)
+	std::size_t len;
+	bool uppercase;
+
+	disa_writer(char* buffer, const std::size_t size, const bool uppercase)
+		: at(size ? buffer : nullptr)
+		, end(size ? buffer + size - 1 : nullptr)
+		, len(0)
+		, uppercase(uppercase)
+	{
+	}
 
-std::vector<disa_inst> disa_read(const std::uintptr_t address, const std::size_t count)
-{
-	std::uintptr_t at = address;
-	std::vector<disa_inst> inst_list;
+	void put(const char c)
+	{
+		if (at < end)
+		{
+			*at++ = c;
+		}
 
-	for (std::size_t c = 0; c < count; c++)
+		len++;
+	}
+
+	void put(const char* s)
 	{
-		const auto i = read(at);
-		inst_list.push_back(i);
-		at += i.len;
+		while (*s)
+		{
+			put(*s++);
+		}
 	}
 
-	return inst_list;
-}
+	// mnemonics, registers and keywords follow the case option
+	void name(const char* s, const std::size_t n = SIZE_MAX)
+	{
+		for (std::size_t i = 0; i < n && s[i]; i++)
+		{
+			const char c = s[i];
+			put((uppercase && c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c);
+		}
+	}
 
-std::vector<disa_inst> disa_ranged_read(const std::uintptr_t from, const std::uintptr_t to)
-{
-	std::uintptr_t at = from;
-	std::vector<disa_inst> inst_list = { };
+	// takes back whatever was put since save()
+	struct mark
+	{
+		char* at;
+		std::size_t len;
+	};
 
-	while (at < to)
+	mark save() const
 	{
-		const auto i = read(at);
-		inst_list.push_back(i);
-		at += i.len;
+		return { at, len };
 	}
 
-	return inst_list;
-}
+	void restore(const mark& m)
+	{
+		at = m.at;
+		len = m.len;
+	}
+
+	// `width` digits, zero-padded
+	void hex(const std::uint64_t value, const int width, const char* digits = disa_hex_upper)
+	{
+		for (int i = width - 1; i >= 0; i--)
+		{
+			put(digits[(value >> (i * 4)) & 0xF]);
+		}
+	}
 
+	// as few digits as possible
+	void hex(const std::uint64_t value, const char* digits)
+	{
+		int width = 1;
+
+		while (width < 16 && (value >> (width * 4)))
+		{
+			width++;
+		}
+
+		hex(value, width, digits);
+	}
+
+	void finish()
+	{
+		if (end)
+		{
+			*at = '\0';
+		}
+	}
+
+	static constexpr const char* disa_hex_upper = "0123456789ABCDEF";
+	static constexpr const char* disa_hex_lower = "0123456789abcdef";
+};
 
+constexpr const char* disa_writer::disa_hex_upper;
+constexpr const char* disa_writer::disa_hex_lower;
 
+// MASM numbers: 8, 0Ch, 0FFFFFFF0h
+static void put_masm_number(disa_writer& out, const std::uint64_t value)
+{
+	if (value < 10)
+	{
+		out.put(static_cast<char>('0' + value));
+		return;
+	}
 
+	char digits[17];
+	disa_writer tmp(digits, sizeof(digits), false);
+	tmp.hex(value, disa_writer::disa_hex_upper);
+	tmp.finish();
+
+	if (digits[0] >= 'A')
+	{
+		out.put('0');
+	}
+
+	out.put(digits);
+	out.put('h');
+}
+
+// AT&T numbers: 0x8, 0xfffffff0
+static void put_att_number(disa_writer& out, const std::uint64_t value)
+{
+	out.put("0x");
+	out.hex(value, disa_writer::disa_hex_lower);
+}
+
+static void put_number(disa_writer& out, const disa_syntax syntax, const std::uint64_t value, const int width)
+{
+	switch (syntax)
+	{
+	case DISA_SYNTAX_MASM:
+		put_masm_number(out, value);
+		break;
+	case DISA_SYNTAX_ATT:
+		put_att_number(out, value);
+		break;
+	default:
+		out.hex(value, width);
+		break;
+	}
+}
+
+// The imm8 of 83, 6A and 6B is sign-extended to the operand size, which
+// MASM and AT&T show (or eax, 0FFFFFFFFh). Any other imm8 is as it is
+static std::uint64_t disa_imm8_value(const disa_record& record, const disa_record_operand& operand)
+{
+	const auto& op_info = disa_optable[record.row];
+
+	if (op_info.nbytes != 1 || (op_info.bytes[0] != 0x83 && op_info.bytes[0] != 0x6A && op_info.bytes[0] != 0x6B))
+	{
+		return operand.value;
+	}
+
+	const std::uint64_t value = static_cast<std::uint64_t>(static_cast<std::int64_t>(static_cast<std::int8_t>(operand.value)));
+
+	if (disa_op64(record))
+	{
+		return value;
+	}
+
+	return value & ((record.prefix & PRE_66) ? 0xFFFF : 0xFFFFFFFF);
+}
+
+// Size of the memory an operand refers to (0 if it's not known)
+static std::size_t disa_mem_size(const disa_record& record, const disa_record_operand& operand)
+{
+	switch (operand.opmode)
+	{
+	case disa_optypes::m8:
+	case disa_optypes::r_m8:
+	case disa_optypes::moffs8:
+		return 1;
+	case disa_optypes::m16:
+	case disa_optypes::r_m16:
+		return 2;
+	case disa_optypes::m16_32:
+	case disa_optypes::r_m16_32:
+	case disa_optypes::moffs16_32:
+		return disa_op64(record) ? 8 : (record.prefix & PRE_66) ? 2 : 4;
+	case disa_optypes::m32:
+	case disa_optypes::r_m32:
+	case disa_optypes::xmm_m32:
+		return 4;
+	case disa_optypes::m16_32_and_16_32:
+		return 6;
+	case disa_optypes::m64real:
+	case disa_optypes::mm_m64:
+	case disa_optypes::xmm_m64:
+		return 8;
+	case disa_optypes::m128:
+	case disa_optypes::xmm_m128:
+		return 16;
+	default:
+		return 0;
+	}
+}
+
+static const char* disa_masm_ptr(const std::size_t size)
+{
+	switch (size)
+	{
+	case 1: return "byte ptr ";
+	case 2: return "word ptr ";
+	case 4: return "dword ptr ";
+	case 6: return "fword ptr ";
+	case 8: return "qword ptr ";
+	case 16: return "xmmword ptr ";
+	default: return "";
+	}
+}
+
+static void put_segment(disa_writer& out, const disa_syntax syntax, const std::uint16_t prefix)
+{
+	const char* const reg = (syntax == DISA_SYNTAX_ATT) ? "%" : "";
+
+	const auto put_one = [&out, reg](const char* name)
+	{
+		out.put(reg);
+		out.name(name);
+		out.put(':');
+	};
+
+	if (prefix & PRE_SEG_CS) put_one("cs");
+	if (prefix & PRE_SEG_DS) put_one("ds");
+	if (prefix & PRE_SEG_ES) put_one("es");
+	if (prefix & PRE_SEG_SS) put_one("ss");
+	if (prefix & PRE_SEG_FS) put_one("fs");
+	if (prefix & PRE_SEG_GS) put_one("gs");
+}
+
+// Name of the register in an operand that isn't a memory reference
+static const char* disa_reg_name(const disa_record& record, const disa_record_operand& operand)
+{
+	const auto reg = operand.reg[0] % 16; // r8-r15, xmm8-xmm15 and cr8 are 64-bit mode only
+
+	if (operand.reg_count() == 0) return nullptr;
+	else if (operand.flags & OP_R8) return (record.prefix & PRE_REX) ? mnemonics::r8_rex_names[reg] : mnemonics::r8_names[reg % 8];
+	else if (operand.flags & OP_R16) return mnemonics::r16_names[reg];
+	else if (operand.flags & OP_R32) return mnemonics::r32_names[reg];
+	else if (operand.flags & OP_R64) return mnemonics::r64_names[reg];
+	else if (operand.flags & OP_XMM) return mnemonics::xmm_names[reg];
+	else if (operand.flags & OP_MM) return mnemonics::mm_names[reg % 8];
+	else if (operand.flags & OP_ST) return mnemonics::st_names[reg % 8];
+	else if (operand.flags & OP_SREG) return mnemonics::sreg_names[reg % 8];
+	else if (operand.flags & OP_DR) return mnemonics::dr_names[reg % 8];
+	else if (operand.flags & OP_CR) return mnemonics::cr_names[reg];
+	return nullptr;
+}
+
+// Name of a base or index register inside [...]
+static const char* disa_address_reg_name(const disa_record_operand& operand, const std::uint8_t reg)
+{
+	return (operand.flags & OP_R64) ? mnemonics::r64_names[reg % 16] : mnemonics::r32_names[reg % 16];
+}
+
+// Digits of an absolute address
+static int disa_address_width(const disa_record& record)
+{
+	return (record.prefix & PRE_MODE_64) ? 16 : 8;
+}
+
+static bool disa_is_memory(const disa_record_operand& operand)
+{
+	return (operand.flags & OP_MEM) || operand.opmode == disa_optypes::moffs8 || operand.opmode == disa_optypes::moffs16_32;
+}
+
+// The offset inside [...], with its sign
+static void put_offset(disa_writer& out, const disa_format_options& options, const disa_record_operand& operand, const bool after_reg)
+{
+	std::uint32_t value = operand.value;
+	int width = 8;
+	bool negative = false;
+
+	if (operand.flags & OP_IMM8)
+	{
+		width = 2;
+		negative = (options.disp != DISA_DISP_UNSIGNED) && value > CHAR_MAX;
+		if (negative) value = (UCHAR_MAX + 1) - value;
+	}
+	else if (operand.flags & OP_IMM32)
+	{
+		negative = (options.disp == DISA_DISP_SIGNED) && (value >> 31);
+		if (negative) value = 0u - value;
+	}
+	else if (operand.flags & OP_DISP32)
+	{
+		if (options.syntax == DISA_SYNTAX_DISA)
+		{
+			// disp32 (absolute, or after a SIB byte) is written as-is
+			if (after_reg) out.put('+');
+			out.hex(value, 8);
+			return;
+		}
+
+		negative = after_reg && (options.disp == DISA_DISP_SIGNED) && (value >> 31);
+		if (negative) value = 0u - value;
+	}
+	else
+	{
+		return;
+	}
+
+	if (options.syntax == DISA_SYNTAX_ATT)
+	{
+		if (negative) out.put('-');
+		put_att_number(out, value);
+		return;
+	}
+
+	if (negative) out.put('-');
+	else if (after_reg) out.put('+');
+
+	put_number(out, options.syntax, value, width);
+}
+
+static void put_memory(disa_writer& out, const disa_format_options& options, const disa_record& record, const disa_record_operand& operand)
+{
+	const bool moffs = (operand.opmode == disa_optypes::moffs8 || operand.opmode == disa_optypes::moffs16_32);
+	const bool rip = (operand.flags & OP_RIP) != 0;
+
+	if (options.syntax == DISA_SYNTAX_ATT)
+	{
+		put_segment(out, options.syntax, record.prefix);
+
+		if (moffs)
+		{
+			put_att_number(out, disa_value64(record, operand));
+			return;
+		}
+
+		put_offset(out, options, operand, rip);
+
+		if (rip)
+		{
+			out.put("(%");
+			out.name("rip");
+			out.put(')');
+		}
+		else if (operand.reg_count())
+		{
+			out.put('(');
+
+			// a single register with a scale is an index without a base
+			if (operand.reg_count() == 2 || operand.mul == 0)
+			{
+				out.put('%');
+				out.name(disa_address_reg_name(operand, operand.reg[0]));
+			}
+
+			if (operand.reg_count() == 2 || operand.mul)
+			{
+				out.put(",%");
+				out.name(disa_address_reg_name(operand, operand.reg[operand.reg_count() - 1]));
+				out.put(',');
+				out.put(static_cast<char>('0' + (operand.mul ? operand.mul : 1)));
+			}
+
+			out.put(')');
+		}
+		return;
+	}
+
+	if (options.syntax == DISA_SYNTAX_MASM)
+	{
+		out.name(disa_masm_ptr(disa_mem_size(record, operand)));
+	}
+
+	// DISA style only shows the segment of a moffs16/32
+	if (options.syntax != DISA_SYNTAX_DISA || operand.opmode != disa_optypes::moffs8)
+	{
+		put_segment(out, options.syntax, record.prefix);
+	}
+
+	out.put('[');
+
+	if (moffs)
+	{
+		put_number(out, options.syntax, disa_value64(record, operand), (operand.flags & OP_DISP64) ? 16 : 8);
+	}
+	else if (rip && options.syntax == DISA_SYNTAX_DISA)
+	{
+		// DISA style shows where it points to
+		std::uintptr_t target = 0;
+		record.memory_target(target);
+		out.hex(target, 16);
+	}
+	else if (rip)
+	{
+		out.name("rip");
+		put_offset(out, options, operand, true);
+	}
+	else
+	{
+		for (std::uint8_t i = 0; i < operand.reg_count(); i++)
+		{
+			if (i) out.put('+');
+			out.name(disa_address_reg_name(operand, operand.reg[i]));
+		}
+
+		if (operand.mul)
+		{
+			out.put('*');
+			out.put(static_cast<char>('0' + operand.mul));
+		}
+
+		put_offset(out, options, operand, operand.reg_count() != 0);
+	}
+
+	out.put(']');
+}
+
+static void put_operand(disa_writer& out, const disa_format_options& options, const disa_record& record, const disa_record_operand& operand)
+{
+	const bool att = (options.syntax == DISA_SYNTAX_ATT);
+	const char* const reg = att ? "%" : "";
+	const char* const imm = att ? "$" : "";
+
+	switch (operand.opmode)
+	{
+	case disa_optypes::one:
+		out.put(imm);
+		put_number(out, options.syntax, 1, 1);
+		return;
+	case disa_optypes::ES:
+	case disa_optypes::SS:
+	case disa_optypes::DS:
+	case disa_optypes::GS:
+	case disa_optypes::FS:
+	{
+		const char* const names[] = { "es", "ss", "ds", "gs", "fs" };
+		const std::size_t n = (operand.opmode == disa_optypes::ES) ? 0 : (operand.opmode == disa_optypes::SS) ? 1 : (operand.opmode == disa_optypes::DS) ? 2 : (operand.opmode == disa_optypes::GS) ? 3 : 4;
+		out.put(reg);
+		out.name(names[n]);
+		return;
+	}
+	case disa_optypes::imm8:
+		out.put(imm);
+		put_number(out, options.syntax, (options.syntax == DISA_SYNTAX_DISA) ? operand.value : disa_imm8_value(record, operand), 2);
+		return;
+	case disa_optypes::imm16:
+		out.put(imm);
+		put_number(out, options.syntax, operand.value, (operand.flags & OP_DISP32) ? 8 : 4);
+		return;
+	case disa_optypes::imm16_32:
+	case disa_optypes::imm32:
+		out.put(imm);
+		put_number(out, options.syntax, disa_value64(record, operand), (operand.flags & OP_DISP64) ? 16 : 8);
+		return;
+	case disa_optypes::rel8:
+	case disa_optypes::rel16:
+	case disa_optypes::rel16_32:
+	case disa_optypes::rel32:
+	{
+		// relative offsets are always the last part of the instruction
+		std::int32_t offset = 0;
+		disa_rel_offset(operand, offset);
+		put_number(out, options.syntax, disa_relative(record, offset), disa_address_width(record));
+		return;
+	}
+	case disa_optypes::ptr16_32:
+		if (att)
+		{
+			out.put('$');
+			put_att_number(out, record.selector);
+			out.put(",$");
+			put_att_number(out, operand.value);
+		}
+		else
+		{
+			put_number(out, options.syntax, operand.value, 8);
+			out.put(':');
+			put_number(out, options.syntax, record.selector, 4);
+		}
+		return;
+	case disa_optypes::moffs8:
+	case disa_optypes::moffs16_32:
+		put_memory(out, options, record, operand);
+		return;
+	case disa_optypes::m8:
+	case disa_optypes::m16:
+	case disa_optypes::m16_32:
+	case disa_optypes::m32:
+	case disa_optypes::m64real:
+	case disa_optypes::r_m8:
+	case disa_optypes::r_m16:
+	case disa_optypes::r_m16_32:
+	case disa_optypes::r_m32:
+	case disa_optypes::m16_32_and_16_32:
+	case disa_optypes::m128:
+	case disa_optypes::mm_m64:
+	case disa_optypes::xmm_m32:
+	case disa_optypes::xmm_m64:
+	case disa_optypes::xmm_m128:
+	case disa_optypes::STi:
+		if (operand.flags & OP_MEM)
+		{
+			put_memory(out, options, record, operand);
+			return;
+		}
+
+		if (options.syntax == DISA_SYNTAX_DISA)
+		{
+			// (the segment is shown on registers too)
+			put_segment(out, options.syntax, record.prefix);
+		}
+		break;
+	default:
+		break;
+	}
+
+	// a register
+	const char* const name = disa_reg_name(record, operand);
+
+	if (name)
+	{
+		out.put(reg);
+		out.name(name);
+	}
+}
+
+std::size_t disa_format(const disa_record& record, char* buffer, const std::size_t size, const disa_format_options& options)
+{
+	disa_writer out(buffer, size, options.uppercase);
+
+	if (record.row == DISA_NO_ROW)
+	{
+		out.put("???");
+		out.finish();
+		DISA_STATS(disa_stats_formatted(out.len));
+		return out.len;
+	}
+
+	const auto& op_info = disa_optable[record.row];
+	const std::uint8_t prefix_byte = (record.prefix & PRE_LOCK) ? OP_LOCK : (record.prefix & PRE_REPNE) ? OP_REPNE : OP_REPE;
+
+	// Lock/rep prefixes are included in the text translation,
+	// unless the same byte is repeated (in which case it's part
+	// of the opcode in our table)
+	if ((record.prefix & (PRE_LOCK | PRE_REPNE | PRE_REPE)) && op_info.bytes[0] != prefix_byte)
+	{
+		if (record.prefix & PRE_LOCK)  out.name("lock ");
+		if (record.prefix & PRE_REPNE) out.name("repne ");
+		if (record.prefix & PRE_REPE)  out.name("repe ");
+	}
+
+	const bool att = (options.syntax == DISA_SYNTAX_ATT);
+
+	// GAS has no "jmp short"
+	const char* const short_suffix = att ? std::strstr(op_info.opcode_name, " short") : nullptr;
+	out.name(op_info.opcode_name, short_suffix ? short_suffix - op_info.opcode_name : SIZE_MAX);
+
+	// call/jmp through a register or memory
+	const auto mnemonic = record.mnemonic();
+	const bool indirect = att && (mnemonic == MN_CALL || mnemonic == MN_JMP || mnemonic == MN_CALLF || mnemonic == MN_JMPF);
+
+	if (att && !indirect)
+	{
+		// with no register to tell the size apart, it goes onto the mnemonic
+		std::size_t mem_size = 0;
+		bool has_reg = false;
+
+		for (std::size_t c = 0; c < record.noperands; c++)
+		{
+			const auto& operand = record.operands[c];
+
+			if (disa_is_memory(operand)) mem_size = disa_mem_size(record, operand);
+			else if (disa_reg_name(record, operand)) has_reg = true;
+		}
+
+		if (!has_reg)
+		{
+			switch (mem_size)
+			{
+			case 1: out.name("b"); break;
+			case 2: out.name("w"); break;
+			case 4: out.name("l"); break;
+			case 8: out.name("q"); break;
+			}
+		}
+	}
+
+	if (options.syntax == DISA_SYNTAX_DISA)
+	{
+		out.put(' ');
+	}
+
+	// MASM and AT&T leave out implicit operands that have no text,
+	// along with their separator (DISA keeps them: "idiv ,eax,ecx")
+	std::size_t written = 0;
+
+	for (std::size_t i = 0; i < record.noperands; i++)
+	{
+		// AT&T has the operands in reverse (source first)
+		const std::size_t c = att ? record.noperands - 1 - i : i;
+		const auto& operand = record.operands[c];
+		const auto before = out.save();
+
+		if (options.syntax == DISA_SYNTAX_DISA)
+		{
+			if (i) out.put(',');
+		}
+		else
+		{
+			out.put(written ? ", " : " ");
+		}
+
+		const std::size_t start = out.len;
+
+		if (indirect && (disa_is_memory(operand) || (operand.flags & (OP_R32 | OP_R64))))
+		{
+			out.put('*');
+		}
+
+		put_operand(out, options, record, operand);
+
+		if (out.len == start && options.syntax != DISA_SYNTAX_DISA)
+		{
+			out.restore(before);
+			continue;
+		}
+
+		written++;
+	}
+
+	out.finish();
+	DISA_STATS(disa_stats_formatted(out.len));
+	return out.len;
+}
+
+std::string disa_format(const disa_record& record, const disa_format_options& options)
+{
+	char text[DISA_TEXT_SIZE];
+	const std::size_t len = disa_format(record, text, sizeof(text), options);
+
+	if (len >= sizeof(text))
+	{
+		std::string data(len, '\0');
+		disa_format(record, &data[0], len + 1, options);
+		DISA_STATS(disa_stats_allocated(heap_blocks(data)));
+		return data;
+	}
+
+	std::string data(text, len);
+	DISA_STATS(disa_stats_allocated(heap_blocks(data)));
+	return data;
+}
+
+std::string disa_format(const disa_inst& inst, const disa_format_options& options)
+{
+	return disa_format(inst.record, options);
+}
+
+// All the state of a decode is in `record` and on the stack
+static std::size_t decode(const disa_index& index, const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, disa_record& record)
+{
+	if (size >= sizeof(disa_inst::bytes))
+	{
+		read(index, buffer, address, record);
+	}
+	else
+	{
+		// Near the end of the buffer we decode from a zero-padded
+		// copy of what's left, so nothing past `size` is ever read
+		std::uint8_t window[sizeof(disa_inst::bytes)] = { 0 };
+		std::memcpy(window, buffer, size);
+
+		read(index, window, address, record);
+
+		if (record.len > size)
+		{
+			// the instruction doesn't fit into what's left of the buffer
+			record = disa_record();
+			record.address = address;
+			record.prefix = (index.mode == DISA_MODE_64) ? PRE_MODE_64 : 0;
+			record.len = (size > 0) ? 1 : 0;
+		}
+	}
+
+	return record.len;
+}
+
+std::size_t disa_decode(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, disa_record& record, const disa_mode mode)
+{
+	return decode(disa_mode_index(mode), buffer, size, address, record);
+}
+
+disa_inst disa_decode(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const bool text, const disa_mode mode)
+{
+	disa_record record;
+	disa_decode(buffer, size, address, record, mode);
+
+	disa_inst p = disa_inst(record);
+	std::memcpy(p.bytes, buffer, (size < sizeof(p.bytes)) ? size : sizeof(p.bytes));
+
+	if (text)
+	{
+		p.data = disa_format(record);
+	}
+
+	return p;
+}
+
+// Adds a copy of `inst` to `list` (which copies its strings and vectors, and
+// the ones of every instruction already in `list` when it has to grow)
+static void append_inst(std::vector<disa_inst>& list, const disa_inst& inst)
+{
+#ifdef DISA_INSTRUMENT
+	std::size_t allocations = heap_blocks(inst, true);
+
+	if (list.size() == list.capacity())
+	{
+		allocations++;
+
+		for (const auto& i : list)
+		{
+			allocations += heap_blocks(i, true);
+		}
+	}
+
+	disa_stats_allocated(allocations);
+#endif
+	list.push_back(inst);
+}
+
+// Decodes from the memory of the current process
+static disa_inst read(const std::uintptr_t address, const bool text = true)
+{
+	return disa_decode(reinterpret_cast<const std::uint8_t*>(address), sizeof(disa_inst::bytes), address, text);
+}
+
+disa_inst disa_read(const std::uintptr_t address)
+{
+	return read(address);
+}
+
+std::vector<disa_inst> disa_read(const std::uintptr_t address, const std::size_t count, const bool text)
+{
+	std::uintptr_t at = address;
+	std::vector<disa_inst> inst_list;
+
+	for (std::size_t c = 0; c < count; c++)
+	{
+		const auto i = read(at, text);
+		append_inst(inst_list, i);
+		at += i.len;
+	}
+
+	return inst_list;
+}
+
+std::vector<disa_inst> disa_ranged_read(const std::uintptr_t from, const std::uintptr_t to, const bool text)
+{
+	std::uintptr_t at = from;
+	std::vector<disa_inst> inst_list = { };
+
+	while (at < to)
+	{
+		const auto i = read(at, text);
+		append_inst(inst_list, i);
+		at += i.len;
+	}
+
+	return inst_list;
+}
+
+std::vector<disa_inst> disa_read(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const std::size_t count, const bool text, const disa_mode mode)
+{
+	std::size_t at = 0;
+	std::vector<disa_inst> inst_list;
+
+	for (std::size_t c = 0; c < count && at < size; c++)
+	{
+		const auto i = disa_decode(buffer + at, size - at, address + at, text, mode);
+		append_inst(inst_list, i);
+		at += i.len;
+	}
+
+	return inst_list;
+}
+
+std::vector<disa_inst> disa_ranged_read(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const bool text, const disa_mode mode)
+{
+	std::size_t at = 0;
+	std::vector<disa_inst> inst_list = { };
+
+	while (at < size)
+	{
+		const auto i = disa_decode(buffer + at, size - at, address + at, text, mode);
+		append_inst(inst_list, i);
+		at += i.len;
+	}
+
+	return inst_list;
+}
+
+disa_stream::iterator::iterator() : decoder(nullptr), at(nullptr), end(nullptr), address(0), bounded(true)
+{
+}
+
+disa_stream::iterator::iterator(const disa_decoder* decoder, const std::uint8_t* at, const std::uint8_t* end, const std::uintptr_t address, const bool bounded)
+	: decoder(decoder)
+	, at(at)
+	, end(end)
+	, address(address)
+	, bounded(bounded)
+{
+	decode();
+}
+
+void disa_stream::iterator::decode()
+{
+	if (at < end)
+	{
+		// unbounded (live) reads may run past `end`, same as disa_ranged_read
+		const std::size_t size = bounded ? static_cast<std::size_t>(end - at) : sizeof(disa_inst::bytes);
+		if (decoder)
+		{
+			decoder->decode(at, size, address, record);
+		}
+		else
+		{
+			disa_decode(at, size, address, record);
+		}
+	}
+}
+
+disa_stream::iterator& disa_stream::iterator::operator++()
+{
+	at += record.len;
+	address += record.len;
+	decode();
+
+	return *this;
+}
+
+disa_stream::iterator disa_stream::iterator::operator++(int)
+{
+	const iterator prev = *this;
+	++*this;
+	return prev;
+}
+
+bool disa_stream::iterator::operator==(const iterator& other) const
+{
+	const bool done = (at >= end);
+	const bool other_done = (other.at >= other.end);
+
+	if (done || other_done)
+	{
+		return done == other_done;
+	}
+
+	return at == other.at;
+}
+
+disa_stream::disa_stream(const std::uintptr_t address_from, const std::uintptr_t address_to)
+	: decoder(nullptr)
+	, from(reinterpret_cast<const std::uint8_t*>(address_from))
+	, to(reinterpret_cast<const std::uint8_t*>(address_to))
+	, address(address_from)
+	, bounded(false)
+{
+}
+
+disa_stream::disa_stream(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address)
+	: decoder(nullptr)
+	, from(buffer)
+	, to(buffer + size)
+	, address(address)
+	, bounded(true)
+{
+}
+
+disa_stream::disa_stream(const disa_decoder& decoder, const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address)
+	: decoder(&decoder)
+	, from(buffer)
+	, to(buffer + size)
+	, address(address)
+	, bounded(true)
+{
+}
+
+disa_stream::iterator disa_stream::begin() const
+{
+	return iterator(decoder, from, to, address, bounded);
+}
+
+disa_stream::iterator disa_stream::end() const
+{
+	return iterator(decoder, to, to, address + (to - from), bounded);
+}
+
+// Byte classes for the length decoder.
+// The low bits are the kind of immediate that follows the opcode
+// (and the ModRM/SIB/displacement, if there is one).
+constexpr std::uint8_t LEN_NONE				= 0x00;
+constexpr std::uint8_t LEN_I8				= 0x01; // imm8, rel8
+constexpr std::uint8_t LEN_I16				= 0x02; // imm16
+constexpr std::uint8_t LEN_IZ				= 0x03; // imm32, rel32 (imm16/rel16 with a 66 prefix)
+constexpr std::uint8_t LEN_I16_I8			= 0x04; // enter
+constexpr std::uint8_t LEN_PTR				= 0x05; // ptr16:32 (ptr16:16 with a 66 prefix)
+constexpr std::uint8_t LEN_MOFFS			= 0x06; // moffs32 (moffs16 with a 67 prefix; moffs64, or moffs32 with a 67 prefix, in 64-bit mode)
+constexpr std::uint8_t LEN_IMM_MASK			= 0x07;
+constexpr std::uint8_t LEN_REG				= 0x08; // the ModRM is always register-direct, whatever its mod (mov to/from CR/DR)
+constexpr std::uint8_t LEN_MODRM			= 0x10;
+constexpr std::uint8_t LEN_PREFIX			= 0x20;
+constexpr std::uint8_t LEN_ESCAPE			= 0x40; // 0F, 0F 38, 0F 3A
+constexpr std::uint8_t LEN_BAD				= 0x80;
+
+constexpr std::uint8_t LEN_M				= LEN_MODRM;
+constexpr std::uint8_t LEN_MI8				= LEN_MODRM | LEN_I8;
+constexpr std::uint8_t LEN_MIZ				= LEN_MODRM | LEN_IZ;
+constexpr std::uint8_t LEN_MR				= LEN_MODRM | LEN_REG;
+
+// one-byte opcode map
+static constexpr std::uint8_t disa_lenclass_1[256] =
+{
+	//	x0			x1			x2			x3			x4			x5			x6			x7			x8			x9			xA			xB			xC			xD			xE			xF
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_I8,		LEN_IZ,		LEN_NONE,	LEN_NONE,	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_I8,		LEN_IZ,		LEN_NONE,	LEN_ESCAPE,	// 0x
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_I8,		LEN_IZ,		LEN_NONE,	LEN_NONE,	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_I8,		LEN_IZ,		LEN_NONE,	LEN_NONE,	// 1x
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_I8,		LEN_IZ,		LEN_PREFIX,	LEN_NONE,	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_I8,		LEN_IZ,		LEN_PREFIX,	LEN_NONE,	// 2x
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_I8,		LEN_IZ,		LEN_PREFIX,	LEN_NONE,	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_I8,		LEN_IZ,		LEN_PREFIX,	LEN_NONE,	// 3x
+	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	// 4x
+	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	// 5x
+	LEN_NONE,	LEN_NONE,	LEN_M,		LEN_M,		LEN_PREFIX,	LEN_PREFIX,	LEN_PREFIX,	LEN_PREFIX,	LEN_IZ,		LEN_MIZ,	LEN_I8,		LEN_MI8,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	// 6x
+	LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		// 7x
+	LEN_MI8,	LEN_MIZ,	LEN_MI8,	LEN_MI8,	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		// 8x
+	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_PTR,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	// 9x
+	LEN_MOFFS,	LEN_MOFFS,	LEN_MOFFS,	LEN_MOFFS,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_I8,		LEN_IZ,		LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	// Ax
+	LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		// Bx
+	LEN_MI8,	LEN_MI8,	LEN_I16,	LEN_NONE,	LEN_M,		LEN_M,		LEN_MI8,	LEN_MIZ,	LEN_I16_I8,	LEN_NONE,	LEN_I16,	LEN_NONE,	LEN_NONE,	LEN_I8,		LEN_NONE,	LEN_NONE,	// Cx
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_I8,		LEN_I8,		LEN_NONE,	LEN_NONE,	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		// Dx
+	LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_I8,		LEN_IZ,		LEN_IZ,		LEN_PTR,	LEN_I8,		LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	// Ex
+	LEN_PREFIX,	LEN_NONE,	LEN_PREFIX,	LEN_PREFIX,	LEN_NONE,	LEN_NONE,	LEN_M,		LEN_M,		LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_M,		LEN_M,		// Fx
+};
+
+// two-byte opcode map (0F xx)
+static constexpr std::uint8_t disa_lenclass_0F[256] =
+{
+	//	x0			x1			x2			x3			x4			x5			x6			x7			x8			x9			xA			xB			xC			xD			xE			xF
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_BAD,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_BAD,	LEN_NONE,	LEN_BAD,	LEN_M,		LEN_NONE,	LEN_MI8,	// 0x
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		// 1x
+	LEN_MR,		LEN_MR,		LEN_MR,		LEN_MR,		LEN_BAD,	LEN_BAD,	LEN_BAD,	LEN_BAD,	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		// 2x
+	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_BAD,	LEN_NONE,	LEN_ESCAPE,	LEN_BAD,	LEN_ESCAPE,	LEN_BAD,	LEN_BAD,	LEN_BAD,	LEN_BAD,	LEN_BAD,	// 3x
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		// 4x
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		// 5x
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		// 6x
+	LEN_MI8,	LEN_MI8,	LEN_MI8,	LEN_MI8,	LEN_M,		LEN_M,		LEN_M,		LEN_NONE,	LEN_M,		LEN_M,		LEN_BAD,	LEN_BAD,	LEN_M,		LEN_M,		LEN_M,		LEN_M,		// 7x
+	LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		LEN_IZ,		// 8x
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		// 9x
+	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_M,		LEN_MI8,	LEN_M,		LEN_BAD,	LEN_BAD,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_M,		LEN_MI8,	LEN_M,		LEN_M,		LEN_M,		// Ax
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_MI8,	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		// Bx
+	LEN_M,		LEN_M,		LEN_MI8,	LEN_M,		LEN_MI8,	LEN_MI8,	LEN_MI8,	LEN_M,		LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	LEN_NONE,	// Cx
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		// Dx
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		// Ex
+	LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		LEN_M,		// Fx
+};
+
+// Size of whatever follows the ModRM byte (SIB + displacement)
+static std::size_t disa_modrm_size(const std::uint8_t* at, const std::uint8_t* end, const bool addr16)
+{
+	const std::uint8_t modrm = *at;
+	const std::uint8_t mod = modrm >> 6;
+	const std::uint8_t rm = modrm & 7;
+
+	if (mod == 3)
+	{
+		return 0;
+	}
+
+	if (addr16)
+	{
+		if (mod == 0) return (rm == 6) ? 2 : 0;
+		return (mod == 1) ? 1 : 2;
+	}
+
+	std::size_t size = 0;
+	std::uint8_t base = rm;
+
+	if (rm == 4)
+	{
+		// SIB byte
+		if (at + 1 >= end)
+		{
+			return 1;
+		}
+
+		size++;
+		base = at[1] & 7;
+	}
+
+	if (mod == 0) return size + ((base == 5) ? 4 : 0);
+	return size + ((mod == 1) ? 1 : 4);
+}
+
+std::size_t disa_length(const std::uint8_t* buffer, const std::size_t size, const disa_mode mode)
+{
+	// an instruction is never longer than 15 bytes
+	const std::uint8_t* end = buffer + ((size < 15) ? size : 15);
+	const std::uint8_t* at = buffer;
+
+	const bool mode64 = (mode == DISA_MODE_64);
+	bool op16 = false;
+	bool addr16 = false;
+	bool addr32 = false; // 67 in 64-bit mode
+	bool rex_w = false;
+
+	// any number of prefixes, in any order.
+	// A REX prefix only counts when it comes last
+	while (at < end && ((disa_lenclass_1[*at] & LEN_PREFIX) || (mode64 && (*at & 0xF0) == 0x40)))
+	{
+		if (*at == OP_66) op16 = true;
+		if (*at == OP_67) addr16 = !mode64;
+		if (*at == OP_67) addr32 = mode64;
+		rex_w = mode64 && (*at & 0xF8) == 0x48;
+		at++;
+	}
+
+	if (at >= end)
+	{
+		return 0;
+	}
+
+	const std::uint8_t opcode = *at++;
+	std::uint8_t lenclass = disa_lenclass_1[opcode];
+	const bool escaped = (lenclass & LEN_ESCAPE) != 0;
+
+	if (mode64 && disa_invalid_64(opcode))
+	{
+		return 0;
+	}
+
+	if (escaped)
+	{
+		if (at >= end)
+		{
+			return 0;
+		}
+
+		lenclass = disa_lenclass_0F[*at++];
+
+		if (lenclass & LEN_ESCAPE)
+		{
+			// 0F 38 xx has a ModRM, 0F 3A xx has a ModRM and an imm8
+			lenclass = (at[-1] == 0x38) ? LEN_M : LEN_MI8;
+
+			if (at++ >= end)
+			{
+				return 0;
+			}
+		}
+	}
+
+	if (lenclass & LEN_BAD)
+	{
+		return 0;
+	}
+
+	std::size_t len = at - buffer;
+
+	if (lenclass & LEN_MODRM)
+	{
+		if (at >= end)
+		{
+			return 0;
+		}
+
+		// test r/m,imm is the only member of the F6/F7 group with an immediate
+		if (!escaped && (opcode == 0xF6 || opcode == 0xF7) && (*at & 0x38) < 0x10)
+		{
+			lenclass |= (opcode == 0xF6) ? LEN_I8 : LEN_IZ;
+		}
+
+		len += 1 + ((lenclass & LEN_REG) ? 0 : disa_modrm_size(at, end, addr16));
+	}
+
+	switch (lenclass & LEN_IMM_MASK)
+	{
+	case LEN_I8:
+		len += 1;
+		break;
+	case LEN_I16:
+		len += 2;
+		break;
+	case LEN_IZ:
+		// mov r64, imm64 is the only instruction with a 64-bit immediate.
+		// REX.W wins over a 66 prefix
+		len += (rex_w && !escaped && (opcode & 0xF8) == 0xB8) ? 8 : (op16 && !rex_w) ? 2 : 4;
+		break;
+	case LEN_I16_I8:
+		len += 3;
+		break;
+	case LEN_PTR:
+		len += op16 ? 4 : 6;
+		break;
+	case LEN_MOFFS:
+		len += mode64 ? (addr32 ? 4 : 8) : addr16 ? 2 : 4;
+		break;
+	}
+
+	if (buffer + len > end)
+	{
+		return 0;
+	}
+
+	return len;
+}
+
+std::size_t disa_lengths(const std::uint8_t* buffer, const std::size_t size, std::uint8_t* lengths, const std::size_t max_count, const disa_mode mode)
+{
+	std::size_t at = 0;
+	std::size_t count = 0;
+
+	while (count < max_count && at < size)
+	{
+		const std::size_t len = disa_length(buffer + at, size - at, mode);
+
+		if (len == 0)
+		{
+			break;
+		}
+
+		lengths[count++] = static_cast<std::uint8_t>(len);
+		at += len;
+	}
+
+	return count;
+}
+
+std::size_t disa_batch::size() const
+{
+	return address.size();
+}
+
+void disa_batch::clear()
+{
+	address.clear();
+	len.clear();
+	row.clear();
+	flags.clear();
+	prefix.clear();
+	selector.clear();
+
+	for (auto& columns : operands)
+	{
+		columns.opmode.clear();
+		columns.flags.clear();
+		columns.base.clear();
+		columns.index.clear();
+		columns.mul.clear();
+		columns.value.clear();
+	}
+}
+
+// every column of a disa_batch, for counting allocations (they all grow together)
+constexpr std::size_t DISA_BATCH_COLUMNS = 6 + 4 * 6;
+
+void disa_batch::reserve(const std::size_t count)
+{
+	DISA_STATS(if (count > address.capacity()) disa_stats_allocated(DISA_BATCH_COLUMNS));
+
+	address.reserve(count);
+	len.reserve(count);
+	row.reserve(count);
+	flags.reserve(count);
+	prefix.reserve(count);
+	selector.reserve(count);
+
+	for (auto& columns : operands)
+	{
+		columns.opmode.reserve(count);
+		columns.flags.reserve(count);
+		columns.base.reserve(count);
+		columns.index.reserve(count);
+		columns.mul.reserve(count);
+		columns.value.reserve(count);
+	}
+}
+
+void disa_batch::push_back(const disa_record& record)
+{
+	DISA_STATS(if (address.size() == address.capacity()) disa_stats_allocated(DISA_BATCH_COLUMNS));
+
+	address.push_back(record.address);
+	len.push_back(record.len);
+	row.push_back(record.row);
+	flags.push_back(record.flags());
+	prefix.push_back(record.prefix);
+	selector.push_back(record.selector);
+
+	for (std::size_t c = 0; c < 4; c++)
+	{
+		const auto& operand = record.operands[c];
+		auto& columns = operands[c];
+
+		columns.opmode.push_back(operand.opmode);
+		columns.flags.push_back(operand.flags);
+		columns.base.push_back(operand.reg[0]);
+		columns.index.push_back(operand.reg[1]);
+		columns.mul.push_back(operand.mul);
+		columns.value.push_back(operand.value);
+	}
+}
+
+disa_record disa_batch::record(const std::size_t i) const
+{
+	disa_record record;
+
+	record.address = address[i];
+	record.len = len[i];
+	record.row = row[i];
+	record.prefix = prefix[i];
+	record.noperands = (row[i] == DISA_NO_ROW) ? 0 : disa_optable[row[i]].operands.count;
+	record.selector = selector[i];
+
+	for (std::size_t c = 0; c < 4; c++)
+	{
+		auto& operand = record.operands[c];
+		const auto& columns = operands[c];
+
+		operand.opmode = columns.opmode[i];
+		operand.flags = columns.flags[i];
+		operand.reg[0] = columns.base[i];
+		operand.reg[1] = columns.index[i];
+		operand.mul = columns.mul[i];
+		operand.value = columns.value[i];
+	}
+
+	return record;
+}
+
+static std::size_t decode_batch(const disa_stream& stream, const std::size_t size, disa_batch& batch, const std::size_t max_count)
+{
+	// roughly one instruction for every 4 bytes of code. Grows geometrically, so
+	// appending to a batch that's reused doesn't copy every column each time
+	const std::size_t needed = batch.size() + ((size / 4 < max_count) ? size / 4 : max_count);
+	const std::size_t capacity = batch.address.capacity();
+
+	if (needed > capacity)
+	{
+		batch.reserve((needed > 2 * capacity) ? needed : 2 * capacity);
+	}
+
+	std::size_t count = 0;
+
+	for (const auto& record : stream)
+	{
+		if (count == max_count)
+		{
+			break;
+		}
+
+		batch.push_back(record);
+		count++;
+	}
+
+	return count;
+}
+
+std::size_t disa_decode_batch(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, disa_batch& batch, const std::size_t max_count)
+{
+	return decode_batch(disa_stream(buffer, size, address), size, batch, max_count);
+}
+
+disa_decoder::disa_decoder(const disa_mode mode, const disa_format_options& options)
+	: index(&disa_mode_index(mode))
+	, mode(mode)
+	, options(options)
+{
+}
+
+disa_mode disa_decoder::get_mode() const
+{
+	return mode;
+}
+
+const disa_format_options& disa_decoder::get_options() const
+{
+	return options;
+}
+
+std::size_t disa_decoder::decode(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, disa_record& record) const
+{
+	return ::decode(*index, buffer, size, address, record);
+}
+
+std::size_t disa_decoder::decode_batch(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, disa_batch& batch, const std::size_t max_count) const
+{
+	return ::decode_batch(stream(buffer, size, address), size, batch, max_count);
+}
+
+disa_stream disa_decoder::stream(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address) const
+{
+	return disa_stream(*this, buffer, size, address);
+}
+
+std::size_t disa_decoder::format(const disa_record& record, char* buffer, const std::size_t size) const
+{
+	return disa_format(record, buffer, size, options);
+}
+
+std::string disa_decoder::format(const disa_record& record) const
+{
+	return disa_format(record, options);
+}
@@ -2,6 +2,10 @@
 #include <cstdint>
 #include <string>
 #include <vector>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include "disa_ids.hpp"
 
 // basic filters
 constexpr std::uint32_t OP_NONE				= 0x00000000;
@@ -24,8 +28,29 @@ constexpr std::uint32_t OP_ST				= 0x00010000;
 constexpr std::uint32_t OP_SREG				= 0x00020000; 
 constexpr std::uint32_t OP_DR				= 0x00040000; 
 constexpr std::uint32_t OP_CR				= 0x00080000; 
+constexpr std::uint32_t OP_MEM				= 0x00100000; // operand is a memory reference ([...])
+constexpr std::uint32_t OP_DISP64			= 0x00200000; // imm64/moffs64 (see disa_record::value64)
+constexpr std::uint32_t OP_RIP				= 0x00400000; // [rip+disp32], relative to the next instruction
 
-const enum : std::uint8_t
+// Prefix flags (disa_inst::prefix, disa_record::prefix)
+constexpr std::uint16_t PRE_REPNE   		= 0x0001;
+constexpr std::uint16_t PRE_REPE   			= 0x0002;
+constexpr std::uint16_t PRE_66   			= 0x0004;
+constexpr std::uint16_t PRE_67   			= 0x0008;
+constexpr std::uint16_t PRE_LOCK 			= 0x0010;
+constexpr std::uint16_t PRE_SEG_CS  		= 0x0020;
+constexpr std::uint16_t PRE_SEG_SS  		= 0x0040;
+constexpr std::uint16_t PRE_SEG_DS  		= 0x0080;
+constexpr std::uint16_t PRE_SEG_ES  		= 0x0100;
+constexpr std::uint16_t PRE_SEG_FS  		= 0x0200;
+constexpr std::uint16_t PRE_SEG_GS  		= 0x0400;
+constexpr std::uint16_t PRE_REX				= 0x0800; // any REX prefix (40-4F, 64-bit mode only)
+constexpr std::uint16_t PRE_REX_W			= 0x1000; // REX.W: 64-bit operand size
+constexpr std::uint16_t PRE_MODE_64			= 0x2000; // not a prefix: the instruction was decoded in DISA_MODE_64
+
+// Registers 8-15 (r8-r15, xmm8-xmm15, cr8) only exist in 64-bit mode, and are
+// numbered on from these. With a REX prefix, R8_AH to R8_BH are spl, bpl, sil and dil
+enum : std::uint8_t
 {
 	R8_AL,
 	R8_CL,
@@ -37,7 +62,7 @@ const enum : std::uint8_t
 	R8_BH,
 };
 
-const enum : std::uint8_t
+enum : std::uint8_t
 {
 	R16_AX,
 	R16_CX,
@@ -49,7 +74,7 @@ const enum : std::uint8_t
 	R16_DI,
 };
 
-const enum : std::uint8_t
+enum : std::uint8_t
 {
 	R32_EAX,
 	R32_ECX,
@@ -61,12 +86,85 @@ const enum : std::uint8_t
 	R32_EDI,
 };
 
+enum : std::uint8_t
+{
+	R64_RAX,
+	R64_RCX,
+	R64_RDX,
+	R64_RBX,
+	R64_RSP,
+	R64_RBP,
+	R64_RSI,
+	R64_RDI,
+	R64_R8,
+	R64_R9,
+	R64_R10,
+	R64_R11,
+	R64_R12,
+	R64_R13,
+	R64_R14,
+	R64_R15,
+};
+
+constexpr std::uint16_t DISA_NO_ROW		= 0xFFFF; // disa_record::row of bytes that aren't in the table
+constexpr std::uint8_t DISA_NO_REG			= 0xFF; // unused disa_record_operand::reg slot
+
+// Compact form of a decoded operand.
+// `value` holds whichever of imm8/16/32, disp8/16/32 or rel8/16/32
+// the operand has (see `flags` and `opmode`), zero-extended.
+// Of an imm64/moffs64 it holds the low half
+struct disa_record_operand
+{
+	std::uint32_t flags = 0;
+	std::uint32_t value = 0;
+	std::uint8_t opmode = 0;
+	std::uint8_t reg[2] = { DISA_NO_REG, DISA_NO_REG }; // base, index
+	std::uint8_t mul = 0; // single multiplier
+
+	std::uint8_t reg_count() const { return (reg[0] != DISA_NO_REG) + (reg[1] != DISA_NO_REG); }
+};
+
+// Compact, fixed-size form of a decoded instruction.
+// No heap storage: it can be copied with memcpy and kept in
+// plain arrays. The opcode information stays in the opcode
+// table and is referred to by `row`
+struct disa_record
+{
+	std::uintptr_t address = 0;
+	std::uint16_t row = DISA_NO_ROW;
+	std::uint16_t prefix = 0;
+	std::uint8_t len = 0;
+	std::uint8_t noperands = 0;
+	std::uint16_t selector = 0; // segment of a ptr16:32 operand (callf/jmpf)
+
+	disa_record_operand operands[4];
+
+	disa_form form() const { return static_cast<disa_form>(row); }
+	disa_mnemonic mnemonic() const { return disa_form_mnemonic(form()); }
+
+	std::uint32_t flags() const; // OP_SINGLE/OP_SRC_DEST/OP_EXTENDED | prefix (but not PRE_REX, PRE_REX_W or PRE_MODE_64)
+	bool branch_target(std::uintptr_t& target) const; // absolute target of a rel8/rel16/rel32 operand, if there is one
+	bool memory_target(std::uintptr_t& target) const; // absolute address of a [rip+disp32], moffs or [disp32] operand, if there is one
+
+	// All of an operand's value. An imm64/moffs64 (OP_DISP64) keeps its upper
+	// half in operands[3].value, which instructions with one never use
+	std::uint64_t value64(const std::size_t n) const;
+	const char* opcode_name() const; // "" for unknown bytes
+	const char* description() const;
+};
+
+static_assert(sizeof(disa_record) <= 64, "disa_record should fit into a cache line");
+static_assert(std::is_trivially_copyable<disa_record>::value, "disa_record should be trivially copyable");
+
 struct disa_opinfo
 {
 	std::string code;
 	std::string opcode_name;
 	std::vector<std::uint8_t> operands;
 	std::string description;
+
+	disa_mnemonic mnemonic = MN_NONE;
+	disa_form form = FORM_NONE;
 };
 
 class disa_operand
@@ -79,10 +177,11 @@ public:
 
 	std::uint32_t flags;
 	std::uint8_t opmode;
-	std::vector<std::uint8_t> reg;
+	std::uint8_t reg[4];
 	std::uint8_t mul; // single multiplier
 
 	std::uint8_t append_reg(const std::uint8_t reg_type);
+	std::uint8_t reg_count() const; // number of registers used in `reg`
 
 	union
 	{
@@ -106,29 +205,228 @@ public:
 	};
 };
 
+// The full form of a decoded instruction, built from a disa_record
 class disa_inst
 {
 public:
 	disa_inst();
+	disa_inst(const disa_record& record);
 	~disa_inst();
 
 	std::string data;
 	disa_opinfo info;
 
 	std::uint32_t flags;
+	std::uint16_t prefix;
 	std::uint8_t bytes[16];
 	std::uintptr_t address;
 	std::size_t len;
 
 	std::vector<disa_operand>operands;
 
-	disa_operand src();
-	disa_operand dest();
+	disa_record record; // what everything above was built from
+
+	const disa_operand& src() const;
+	const disa_operand& dest() const;
+};
+
+// The kind of code to decode: per call in the functions below, or per disa_decoder
+enum disa_mode : std::uint8_t
+{
+	DISA_MODE_32,
+	DISA_MODE_64, // REX prefixes, r8-r15, [rip+disp32], 64-bit addresses and operands
 };
 
 bool disa_load();
 
-std::vector<disa_inst> disa_read(const std::uintptr_t address, const size_t count = 1);
-std::vector<disa_inst> disa_ranged_read(const std::uintptr_t address_from, const std::uintptr_t address_to);
+// `text` controls whether disa_inst::data is filled in.
+// Pass false when only the structure (flags, operands, len) is needed,
+// and call disa_format() later for the instructions you want to print.
+std::vector<disa_inst> disa_read(const std::uintptr_t address, const size_t count = 1, const bool text = true);
+std::vector<disa_inst> disa_ranged_read(const std::uintptr_t address_from, const std::uintptr_t address_to, const bool text = true);
+
+// Buffer-based decoding.
+// These never touch `address`; the bytes come from `buffer` (and nothing
+// past `buffer + size` is read). `address` is where the first byte of
+// `buffer` lives in the target, which is what rel8/rel16/rel32 targets
+// are based on.
+disa_inst disa_decode(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const bool text = true, const disa_mode mode = DISA_MODE_32);
+std::vector<disa_inst> disa_read(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const size_t count = 1, const bool text = true, const disa_mode mode = DISA_MODE_32);
+std::vector<disa_inst> disa_ranged_read(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, const bool text = true, const disa_mode mode = DISA_MODE_32);
+
+// Decodes into a compact record, without allocating.
+// Same rules as disa_decode above. Returns record.len
+std::size_t disa_decode(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, disa_record& record, const disa_mode mode = DISA_MODE_32);
+
+// Length of the instruction at `buffer`, without decoding anything else.
+// Returns 0 if the bytes aren't a valid instruction, or if it doesn't
+// fit into `size`. Meant for hooking/patching, where only the
+// instruction boundaries matter.
+std::size_t disa_length(const std::uint8_t* buffer, const std::size_t size, const disa_mode mode = DISA_MODE_32);
+
+// Writes the lengths of consecutive instructions in `buffer` to `lengths`,
+// until `max_count` are written, the buffer ends or disa_length returns 0.
+// Returns the number of lengths written
+std::size_t disa_lengths(const std::uint8_t* buffer, const std::size_t size, std::uint8_t* lengths, const std::size_t max_count, const disa_mode mode = DISA_MODE_32);
+
+// Decodes a region one instruction at a time, into storage that's reused
+// for every instruction, so memory use doesn't depend on the size of the region.
+// Works with range-for and the standard algorithms:
+//
+//	for (const auto& rec : disa_stream(from, to)) { if (...) break; }
+//	auto it = std::find_if(s.begin(), s.end(), [](const disa_record& rec) { ... });
+//
+// A dereferenced iterator stays valid until it's incremented.
+class disa_decoder;
+
+class disa_stream
+{
+public:
+	class iterator
+	{
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef disa_record value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef const disa_record* pointer;
+		typedef const disa_record& reference;
+
+		iterator();
+		iterator(const disa_decoder* decoder, const std::uint8_t* at, const std::uint8_t* end, const std::uintptr_t address, const bool bounded);
+
+		reference operator*() const { return record; }
+		pointer operator->() const { return &record; }
+
+		iterator& operator++();
+		iterator operator++(int);
+
+		bool operator==(const iterator& other) const;
+		bool operator!=(const iterator& other) const { return !(*this == other); }
+
+	private:
+		void decode();
+
+		const disa_decoder* decoder;
+		const std::uint8_t* at;
+		const std::uint8_t* end;
+		std::uintptr_t address; // of `at`
+		bool bounded; // never read past `end`
+		disa_record record;
+	};
+
+	// memory of the current process
+	disa_stream(const std::uintptr_t address_from, const std::uintptr_t address_to);
+	// a buffer that's located at `address` in the target
+	disa_stream(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address);
+	// same, decoded with the options of `decoder` (which has to outlive the stream)
+	disa_stream(const disa_decoder& decoder, const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address);
+
+	iterator begin() const;
+	iterator end() const;
 
+private:
+	const disa_decoder* decoder;
+	const std::uint8_t* from;
+	const std::uint8_t* to;
+	std::uintptr_t address;
+	bool bounded;
+};
 
+// Decoded instructions as columns (structure of arrays), for passes
+// that only look at a few fields of many instructions.
+// Element i of every column belongs to the same instruction.
+class disa_batch
+{
+public:
+	struct operand_columns
+	{
+		std::vector<std::uint8_t> opmode;
+		std::vector<std::uint32_t> flags;
+		std::vector<std::uint8_t> base; // reg[0] (the register, if it's not a memory operand)
+		std::vector<std::uint8_t> index; // reg[1]
+		std::vector<std::uint8_t> mul;
+		std::vector<std::uint32_t> value; // imm/disp/rel
+	};
+
+	std::vector<std::uintptr_t> address;
+	std::vector<std::uint8_t> len;
+	std::vector<std::uint16_t> row; // opcode table row, same as disa_form (DISA_NO_ROW for unknown bytes)
+	std::vector<std::uint32_t> flags; // disa_record::flags()
+	std::vector<std::uint16_t> prefix;
+	std::vector<std::uint16_t> selector;
+
+	operand_columns operands[4]; // every instruction has all 4, unused ones are empty
+
+	std::size_t size() const;
+	void clear();
+	void reserve(const std::size_t count);
+
+	void push_back(const disa_record& record);
+	disa_record record(const std::size_t i) const; // puts instruction `i` back together
+};
+
+// Decodes up to `max_count` instructions from `buffer`, appending them to `batch`.
+// Returns the number of instructions appended
+std::size_t disa_decode_batch(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, disa_batch& batch, const std::size_t max_count = SIZE_MAX);
+
+enum disa_syntax : std::uint8_t
+{
+	DISA_SYNTAX_DISA,	// mov eax,[ebp+08]
+	DISA_SYNTAX_MASM,	// mov eax, dword ptr [ebp+8]
+	DISA_SYNTAX_ATT,	// mov 0x8(%ebp), %eax
+};
+
+// How offsets inside [...] are signed
+enum disa_disp : std::uint8_t
+{
+	DISA_DISP_SIGNED8,	// only 8-bit offsets: [ebp-04], [eax+FFFFFFF0]
+	DISA_DISP_SIGNED,	// [ebp-04], [eax-00000010]
+	DISA_DISP_UNSIGNED,	// [ebp+FC], [eax+FFFFFFF0]
+};
+
+struct disa_format_options
+{
+	disa_syntax syntax = DISA_SYNTAX_DISA;
+	disa_disp disp = DISA_DISP_SIGNED8;
+	bool uppercase = false; // MOV EAX,[EBP+08]
+};
+
+// Enough room for the text of any instruction
+constexpr std::size_t DISA_TEXT_SIZE = 128;
+
+// Renders the text translation of a decoded instruction ("mov eax,[ebp+08]")
+// into `buffer`, without allocating. At most `size` bytes are written and the
+// text is always null-terminated (nothing is written if `size` is 0, so
+// `buffer` can be null). Returns the length of the full text,
+// which is >= size if it didn't fit (like snprintf)
+std::size_t disa_format(const disa_record& record, char* buffer, const std::size_t size, const disa_format_options& options = disa_format_options());
+
+std::string disa_format(const disa_inst& inst, const disa_format_options& options = disa_format_options());
+std::string disa_format(const disa_record& record, const disa_format_options& options = disa_format_options());
+
+struct disa_index;
+
+// A decoder with its own options.
+// It can't be changed after it's constructed and keeps no state between
+// calls (everything a call needs is in the record/buffer you pass, or on
+// the stack), so one decoder can be shared by any number of threads.
+// The free functions above behave like a default-constructed decoder.
+class disa_decoder
+{
+private:
+	const disa_index* index; // shared, read-only
+	disa_mode mode;
+	disa_format_options options;
+public:
+	explicit disa_decoder(const disa_mode mode = DISA_MODE_32, const disa_format_options& options = disa_format_options());
+
+	disa_mode get_mode() const;
+	const disa_format_options& get_options() const;
+
+	std::size_t decode(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, disa_record& record) const;
+	std::size_t decode_batch(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address, disa_batch& batch, const std::size_t max_count = SIZE_MAX) const;
+	disa_stream stream(const std::uint8_t* buffer, const std::size_t size, const std::uintptr_t address) const;
+
+	std::size_t format(const disa_record& record, char* buffer, const std::size_t size) const;
+	std::string format(const disa_record& record) const;
+};
@@ -0,0 +1,3877 @@
+#pragma once
+#include <cstdint>
+
+// Generated by Tools/disa_ids.py from disa_optable. Don't edit by hand.
+
+// Every distinct opcode_name in the table
+enum disa_mnemonic : std::uint16_t
+{
+	MN_NONE, // ???
+	MN_AAA, // aaa
+	MN_AAD, // aad
+	MN_AAM, // aam
+	MN_AAS, // aas
+	MN_ADC, // adc
+	MN_ADD, // add
+	MN_ADDPD, // addpd
+	MN_ADDPS, // addps
+	MN_ADDSD, // addsd
+	MN_ADDSS, // addss
+	MN_ADDSUBPD, // addsubpd
+	MN_AND, // and
+	MN_ANDNPD, // andnpd
+	MN_ANDNPS, // andnps
+	MN_ANDPD, // andpd
+	MN_ANDPS, // andps
+	MN_ARPL, // arpl
+	MN_BLENDPD, // blendpd
+	MN_BLENDPS, // blendps
+	MN_BLENDVPD, // blendvpd
+	MN_BLENDVPS, // blendvps
+	MN_BOUND, // bound
+	MN_BSF, // bsf
+	MN_BSR, // bsr
+	MN_BSWAP, // bswap
+	MN_BT, // bt
+	MN_BTC, // btc
+	MN_BTR, // btr
+	MN_BTS, // bts
+	MN_CALL, // call
+	MN_CALLF, // callf
+	MN_CBW, // cbw
+	MN_CLAC, // clac
+	MN_CLC, // clc
+	MN_CLD, // cld
+	MN_CLFLUSH, // clflush
+	MN_CLI, // cli
+	MN_CLTS, // clts
+	MN_CMC, // cmc
+	MN_CMOVA, // cmova
+	MN_CMOVB, // cmovb
+	MN_CMOVBE, // cmovbe
+	MN_CMOVE, // cmove
+	MN_CMOVG, // cmovg
+	MN_CMOVGE, // cmovge
+	MN_CMOVL, // cmovl
+	MN_CMOVNB, // cmovnb
+	MN_CMOVNE, // cmovne
+	MN_CMOVNG, // cmovng
+	MN_CMOVNO, // cmovno
+	MN_CMOVNP, // cmovnp
+	MN_CMOVNS, // cmovns
+	MN_CMOVO, // cmovo
+	MN_CMOVP, // cmovp
+	MN_CMOVS, // cmovs
+	MN_CMP, // cmp
+	MN_CMPPD, // cmppd
+	MN_CMPPS, // cmpps
+	MN_CMPSB, // cmpsb
+	MN_CMPSD, // cmpsd
+	MN_CMPSS, // cmpss
+	MN_CMPSW, // cmpsw
+	MN_CMPXCHG, // cmpxchg
+	MN_CMPXCHG8B, // cmpxchg8b
+	MN_COMISD, // comisd
+	MN_COMISS, // comiss
+	MN_CPUID, // cpuid
+	MN_CRC32, // crc32
+	MN_CVTDQ2PD, // cvtdq2pd
+	MN_CVTDQ2PS, // cvtdq2ps
+	MN_CVTPD2DQ, // cvtpd2dq
+	MN_CVTPD2PI, // cvtpd2pi
+	MN_CVTPD2PS, // cvtpd2ps
+	MN_CVTPI2PD, // cvtpi2pd
+	MN_CVTPI2PS, // cvtpi2ps
+	MN_CVTPI2SD, // cvtpi2sd
+	MN_CVTPI2SS, // cvtpi2ss
+	MN_CVTPS2DQ, // cvtps2dq
+	MN_CVTPS2PD, // cvtps2pd
+	MN_CVTPS2PI, // cvtps2pi
+	MN_CVTSD2SI, // cvtsd2si
+	MN_CVTSD2SS, // cvtsd2ss
+	MN_CVTSS2SD, // cvtss2sd
+	MN_CVTSS2SI, // cvtss2si
+	MN_CVTTPD2DQ, // cvttpd2dq
+	MN_CVTTPD2PI, // cvttpd2pi
+	MN_CVTTPS2DQ, // cvttps2dq
+	MN_CVTTPS2PI, // cvttps2pi
+	MN_CVTTSD2SI, // cvttsd2si
+	MN_CVTTSS2SI, // cvttss2si
+	MN_CWD, // cwd
+	MN_DAA, // daa
+	MN_DAS, // das
+	MN_DEC, // dec
+	MN_DIV, // div
+	MN_DIVPD, // divpd
+	MN_DIVPS, // divps
+	MN_DIVSD, // divsd
+	MN_DIVSS, // divss
+	MN_DPPD, // dppd
+	MN_DPPS, // dpps
+	MN_EMMS, // emms
+	MN_ENTER, // enter
+	MN_EXTRACTPS, // extractps
+	MN_FADD, // fadd
+	MN_FADDP, // faddp
+	MN_FBLD, // fbld
+	MN_FBSTP, // fbstp
+	MN_FCMOVB, // fcmovb
+	MN_FCMOVBE, // fcmovbe
+	MN_FCMOVE, // fcmove
+	MN_FCMOVNB, // fcmovnb
+	MN_FCMOVNBE, // fcmovnbe
+	MN_FCMOVNE, // fcmovne
+	MN_FCMOVNU, // fcmovnu
+	MN_FCMOVU, // fcmovu
+	MN_FCOM, // fcom
+	MN_FCOMI, // fcomi
+	MN_FCOMIP, // fcomip
+	MN_FCOMP, // fcomp
+	MN_FDIV, // fdiv
+	MN_FDIVP, // fdivp
+	MN_FDIVR, // fdivr
+	MN_FDIVRP, // fdivrp
+	MN_FFREE, // ffree
+	MN_FFREEP, // ffreep
+	MN_FIADD, // fiadd
+	MN_FICOM, // ficom
+	MN_FICOMP, // ficomp
+	MN_FIDIV, // fidiv
+	MN_FIDIVR, // fidivr
+	MN_FILD, // fild
+	MN_FIMUL, // fimul
+	MN_FINIT, // finit
+	MN_FIST, // fist
+	MN_FISTP, // fistp
+	MN_FISTTP, // fisttp
+	MN_FISUB, // fisub
+	MN_FISUBR, // fisubr
+	MN_FLD, // fld
+	MN_FLDCW, // fldcw
+	MN_FLDENV, // fldenv
+	MN_FMUL, // fmul
+	MN_FMULP, // fmulp
+	MN_FNSAVE, // fnsave
+	MN_FNSTCW, // fnstcw
+	MN_FNSTENV, // fnstenv
+	MN_FNSTSW, // fnstsw
+	MN_FRSTOR, // frstor
+	MN_FST, // fst
+	MN_FSTP, // fstp
+	MN_FSUB, // fsub
+	MN_FSUBP, // fsubp
+	MN_FSUBR, // fsubr
+	MN_FSUBRP, // fsubrp
+	MN_FUCOMI, // fucomi
+	MN_FUCOMIP, // fucomip
+	MN_FUCOMP, // fucomp
+	MN_FWAIT, // fwait
+	MN_FXCH, // fxch
+	MN_FXRSTOR, // fxrstor
+	MN_FXSAVE, // fxsave
+	MN_GETSEC, // getsec
+	MN_HADDPD, // haddpd
+	MN_HADDPS, // haddps
+	MN_HINT_NOP, // hint_nop
+	MN_HLT, // hlt
+	MN_HSUBPD, // hsubpd
+	MN_HSUBPS, // hsubps
+	MN_IDIV, // idiv
+	MN_IMUL, // imul
+	MN_IN, // in
+	MN_INC, // inc
+	MN_INSB, // insb
+	MN_INSD, // insd
+	MN_INSERTPS, // insertps
+	MN_INT, // int
+	MN_INT_1, // int 1
+	MN_INT_3, // int 3
+	MN_INTO, // into
+	MN_INVD, // invd
+	MN_INVEPT, // invept
+	MN_INVPLG, // invplg
+	MN_INVVPID, // invvpid
+	MN_IRETD, // iretd
+	MN_JA_SHORT, // ja short
+	MN_JAE_SHORT, // jae short
+	MN_JB_SHORT, // jb short
+	MN_JE_SHORT, // je short
+	MN_JECXZ, // jecxz
+	MN_JG_SHORT, // jg short
+	MN_JGE_SHORT, // jge short
+	MN_JL_SHORT, // jl short
+	MN_JLE_SHORT, // jle short
+	MN_JMP, // jmp
+	MN_JMP_SHORT, // jmp short
+	MN_JMPF, // jmpf
+	MN_JNA_SHORT, // jna short
+	MN_JNE_SHORT, // jne short
+	MN_JNO_SHORT, // jno short
+	MN_JNP_SHORT, // jnp short
+	MN_JNS_SHORT, // jns short
+	MN_JO_SHORT, // jo short
+	MN_JP_SHORT, // jp short
+	MN_JS_SHORT, // js short
+	MN_LAHF, // lahf
+	MN_LAR, // lar
+	MN_LDDQU, // lddqu
+	MN_LDMXCSR, // ldmxcsr
+	MN_LDS, // lds
+	MN_LEA, // lea
+	MN_LEAVE, // leave
+	MN_LES, // les
+	MN_LFENCE, // lfence
+	MN_LFS, // lfs
+	MN_LGDT, // lgdt
+	MN_LGS, // lgs
+	MN_LIDT, // lidt
+	MN_LLDT, // lldt
+	MN_LMSW, // lmsw
+	MN_LODSB, // lodsb
+	MN_LODSW, // lodsw
+	MN_LONG_JA, // long ja
+	MN_LONG_JB, // long jb
+	MN_LONG_JE, // long je
+	MN_LONG_JG, // long jg
+	MN_LONG_JL, // long jl
+	MN_LONG_JNA, // long jna
+	MN_LONG_JNB, // long jnb
+	MN_LONG_JNE, // long jne
+	MN_LONG_JNG, // long jng
+	MN_LONG_JNL, // long jnl
+	MN_LONG_JNO, // long jno
+	MN_LONG_JNP, // long jnp
+	MN_LONG_JNS, // long jns
+	MN_LONG_JO, // long jo
+	MN_LONG_JP, // long jp
+	MN_LONG_JS, // long js
+	MN_LOOP, // loop
+	MN_LOOPE, // loope
+	MN_LOOPNE, // loopne
+	MN_LSL, // lsl
+	MN_LSS, // lss
+	MN_LTR, // ltr
+	MN_MASKMOVDQU, // maskmovdqu
+	MN_MASKMOVQ, // maskmovq
+	MN_MAXPD, // maxpd
+	MN_MAXPS, // maxps
+	MN_MAXSD, // maxsd
+	MN_MAXSS, // maxss
+	MN_MFENCE, // mfence
+	MN_MINPD, // minpd
+	MN_MINPS, // minps
+	MN_MINSD, // minsd
+	MN_MINSS, // minss
+	MN_MONITOR, // monitor
+	MN_MOV, // mov
+	MN_MOVAPD, // movapd
+	MN_MOVAPS, // movaps
+	MN_MOVBE, // movbe
+	MN_MOVD, // movd
+	MN_MOVDDUP, // movddup
+	MN_MOVDQ2Q, // movdq2q
+	MN_MOVDQA, // movdqa
+	MN_MOVDQU, // movdqu
+	MN_MOVHLPS, // movhlps
+	MN_MOVHPD, // movhpd
+	MN_MOVHPS, // movhps
+	MN_MOVLHPS, // movlhps
+	MN_MOVLPD, // movlpd
+	MN_MOVLPS, // movlps
+	MN_MOVMSKPD, // movmskpd
+	MN_MOVMSKPS, // movmskps
+	MN_MOVNTDQ, // movntdq
+	MN_MOVNTDQA, // movntdqa
+	MN_MOVNTI, // movnti
+	MN_MOVNTPD, // movntpd
+	MN_MOVNTPS, // movntps
+	MN_MOVNTQ, // movntq
+	MN_MOVQ, // movq
+	MN_MOVQ2DQ, // movq2dq
+	MN_MOVSB, // movsb
+	MN_MOVSD, // movsd
+	MN_MOVSHDUP, // movshdup
+	MN_MOVSLDUP, // movsldup
+	MN_MOVSS, // movss
+	MN_MOVSW, // movsw
+	MN_MOVSX, // movsx
+	MN_MOVSXD, // movsxd
+	MN_MOVUPD, // movupd
+	MN_MOVUPS, // movups
+	MN_MOVZX, // movzx
+	MN_MPSADBW, // mpsadbw
+	MN_MUL, // mul
+	MN_MULPD, // mulpd
+	MN_MULPS, // mulps
+	MN_MULSS, // mulss
+	MN_MWAIT, // mwait
+	MN_NEG, // neg
+	MN_NOP, // nop
+	MN_NOT, // not
+	MN_OR, // or
+	MN_ORPD, // orpd
+	MN_ORPS, // orps
+	MN_OUT, // out
+	MN_OUTSB, // outsb
+	MN_OUTSD, // outsd
+	MN_PABSB, // pabsb
+	MN_PABSD, // pabsd
+	MN_PABSW, // pabsw
+	MN_PACKSSDW, // packssdw
+	MN_PACKSSWB, // packsswb
+	MN_PACKUSDW, // packusdw
+	MN_PACKUSWB, // packuswb
+	MN_PADDB, // paddb
+	MN_PADDD, // paddd
+	MN_PADDQ, // paddq
+	MN_PADDSB, // paddsb
+	MN_PADDSW, // paddsw
+	MN_PADDUSB, // paddusb
+	MN_PADDUSW, // paddusw
+	MN_PADDW, // paddw
+	MN_PALIGNR, // palignr
+	MN_PAND, // pand
+	MN_PANDN, // pandn
+	MN_PAVGB, // pavgb
+	MN_PAVGW, // pavgw
+	MN_PBLENDVB, // pblendvb
+	MN_PBLENDW, // pblendw
+	MN_PCMPEQB, // pcmpeqb
+	MN_PCMPEQD, // pcmpeqd
+	MN_PCMPEQQ, // pcmpeqq
+	MN_PCMPEQW, // pcmpeqw
+	MN_PCMPESTRI, // pcmpestri
+	MN_PCMPESTRM, // pcmpestrm
+	MN_PCMPGTB, // pcmpgtb
+	MN_PCMPGTD, // pcmpgtd
+	MN_PCMPGTQ, // pcmpgtq
+	MN_PCMPGTW, // pcmpgtw
+	MN_PCMPISTRI, // pcmpistri
+	MN_PCMPISTRM, // pcmpistrm
+	MN_PEXTRB, // pextrb
+	MN_PEXTRD, // pextrd
+	MN_PEXTRW, // pextrw
+	MN_PHADDD, // phaddd
+	MN_PHADDSW, // phaddsw
+	MN_PHADDW, // phaddw
+	MN_PHMINPOSUW, // phminposuw
+	MN_PHSUBD, // phsubd
+	MN_PHSUBSW, // phsubsw
+	MN_PHSUBW, // phsubw
+	MN_PINSRB, // pinsrb
+	MN_PINSRD, // pinsrd
+	MN_PINSRW, // pinsrw
+	MN_PMADDUBSW, // pmaddubsw
+	MN_PMADDWD, // pmaddwd
+	MN_PMAXSB, // pmaxsb
+	MN_PMAXSD, // pmaxsd
+	MN_PMAXSW, // pmaxsw
+	MN_PMAXUB, // pmaxub
+	MN_PMAXUD, // pmaxud
+	MN_PMAXUW, // pmaxuw
+	MN_PMINSB, // pminsb
+	MN_PMINSD, // pminsd
+	MN_PMINSW, // pminsw
+	MN_PMINUB, // pminub
+	MN_PMINUD, // pminud
+	MN_PMINUW, // pminuw
+	MN_PMOVMSKB, // pmovmskb
+	MN_PMOVSXBD, // pmovsxbd
+	MN_PMOVSXBQ, // pmovsxbq
+	MN_PMOVSXBW, // pmovsxbw
+	MN_PMOVSXDQ, // pmovsxdq
+	MN_PMOVZXBD, // pmovzxbd
+	MN_PMOVZXBQ, // pmovzxbq
+	MN_PMOVZXBW, // pmovzxbw
+	MN_PMULDQ, // pmuldq
+	MN_PMULHRSW, // pmulhrsw
+	MN_PMULHUW, // pmulhuw
+	MN_PMULHW, // pmulhw
+	MN_PMULLD, // pmulld
+	MN_PMULLW, // pmullw
+	MN_PMULUDQ, // pmuludq
+	MN_POP, // pop
+	MN_POPAD, // popad
+	MN_POPCNT, // popcnt
+	MN_POPFD, // popfd
+	MN_POR, // por
+	MN_PREFETCHNTA, // prefetchnta
+	MN_PREFETCHT0, // prefetcht0
+	MN_PREFETCHT1, // prefetcht1
+	MN_PREFETCHT2, // prefetcht2
+	MN_PSADBW, // psadbw
+	MN_PSHUFB, // pshufb
+	MN_PSHUFD, // pshufd
+	MN_PSHUFHW, // pshufhw
+	MN_PSHUFLW, // pshuflw
+	MN_PSHUFW, // pshufw
+	MN_PSIGNB, // psignb
+	MN_PSIGND, // psignd
+	MN_PSIGNW, // psignw
+	MN_PSLLD, // pslld
+	MN_PSLLQ, // psllq
+	MN_PSLLW, // psllw
+	MN_PSRAD, // psrad
+	MN_PSRAW, // psraw
+	MN_PSRLD, // psrld
+	MN_PSRLQ, // psrlq
+	MN_PSRLW, // psrlw
+	MN_PSUBB, // psubb
+	MN_PSUBD, // psubd
+	MN_PSUBQ, // psubq
+	MN_PSUBSB, // psubsb
+	MN_PSUBSW, // psubsw
+	MN_PSUBUSB, // psubusb
+	MN_PSUBUSW, // psubusw
+	MN_PSUBW, // psubw
+	MN_PTEST, // ptest
+	MN_PUNPCKHBW, // punpckhbw
+	MN_PUNPCKHDQ, // punpckhdq
+	MN_PUNPCKHQDQ, // punpckhqdq
+	MN_PUNPCKHWD, // punpckhwd
+	MN_PUNPCKLBD, // punpcklbd
+	MN_PUNPCKLBQ, // punpcklbq
+	MN_PUNPCKLBW, // punpcklbw
+	MN_PUNPCKLQDQ, // punpcklqdq
+	MN_PUSH, // push
+	MN_PUSHAD, // pushad
+	MN_PUSHFD, // pushfd
+	MN_PXOR, // pxor
+	MN_RCL, // rcl
+	MN_RCPPS, // rcpps
+	MN_RCPSS, // rcpss
+	MN_RCR, // rcr
+	MN_RDMSR, // rdmsr
+	MN_RDPMC, // rdpmc
+	MN_RDTSC, // rdtsc
+	MN_RET, // ret
+	MN_RETF, // retf
+	MN_RETN, // retn
+	MN_ROL, // rol
+	MN_ROR, // ror
+	MN_ROUNDPD, // roundpd
+	MN_ROUNDPS, // roundps
+	MN_ROUNDSD, // roundsd
+	MN_ROUNDSS, // roundss
+	MN_RSM, // rsm
+	MN_RSQRTPS, // rsqrtps
+	MN_RSQRTSS, // rsqrtss
+	MN_SAHF, // sahf
+	MN_SAL, // sal
+	MN_SAR, // sar
+	MN_SBB, // sbb
+	MN_SCASB, // scasb
+	MN_SCASW, // scasw
+	MN_SETA, // seta
+	MN_SETALC, // setalc
+	MN_SETB, // setb
+	MN_SETE, // sete
+	MN_SETG, // setg
+	MN_SETL, // setl
+	MN_SETNA, // setna
+	MN_SETNB, // setnb
+	MN_SETNE, // setne
+	MN_SETNG, // setng
+	MN_SETNL, // setnl
+	MN_SETNO, // setno
+	MN_SETNP, // setnp
+	MN_SETNS, // setns
+	MN_SETO, // seto
+	MN_SETP, // setp
+	MN_SETS, // sets
+	MN_SFENCE, // sfence
+	MN_SGDT, // sgdt
+	MN_SHL, // shl
+	MN_SHLD, // shld
+	MN_SHR, // shr
+	MN_SHRD, // shrd
+	MN_SHUFPD, // shufpd
+	MN_SHUFPS, // shufps
+	MN_SIDT, // sidt
+	MN_SLDT, // sldt
+	MN_SMSW, // smsw
+	MN_SQRTPD, // sqrtpd
+	MN_SQRTPS, // sqrtps
+	MN_SQRTSD, // sqrtsd
+	MN_SQRTSS, // sqrtss
+	MN_STC, // stc
+	MN_STD, // std
+	MN_STI, // sti
+	MN_STMXCSR, // stmxcsr
+	MN_STOSB, // stosb
+	MN_STOSW, // stosw
+	MN_STR, // str
+	MN_SUB, // sub
+	MN_SUBPD, // subpd
+	MN_SUBPS, // subps
+	MN_SUBSD, // subsd
+	MN_SUBSS, // subss
+	MN_SYSCALL, // syscall
+	MN_SYSENTER, // sysenter
+	MN_SYSEXIT, // sysexit
+	MN_SYSRET, // sysret
+	MN_TEST, // test
+	MN_UCOMISD, // ucomisd
+	MN_UCOMISS, // ucomiss
+	MN_UD, // ud
+	MN_UD2, // ud2
+	MN_UNPCKHPD, // unpckhpd
+	MN_UNPCKHPS, // unpckhps
+	MN_UNPCKLPD, // unpcklpd
+	MN_UNPCKLPS, // unpcklps
+	MN_VERR, // verr
+	MN_VERW, // verw
+	MN_VMCALL, // vmcall
+	MN_VMCLEAN, // vmclean
+	MN_VMLAUNCH, // vmlaunch
+	MN_VMPTRLD, // vmptrld
+	MN_VMPTRST, // vmptrst
+	MN_VMREAD, // vmread
+	MN_VMRESUME, // vmresume
+	MN_VMWRITE, // vmwrite
+	MN_VMXOFF, // vmxoff
+	MN_VMXON, // vmxon
+	MN_WBINVD, // wbinvd
+	MN_WRMSR, // wrmsr
+	MN_XADD, // xadd
+	MN_XCHG, // xchg
+	MN_XLATB, // xlatb
+	MN_XOR, // xor
+	MN_XORPD, // xorpd
+	MN_XORPS, // xorps
+	MN_XRSTOR, // xrstor
+	MN_XSAVE, // xsave
+	MN_COUNT
+};
+
+// Every row of the table, in order (a form is the row index)
+enum disa_form : std::uint16_t
+{
+	FORM_ADD_RM8_R8, // 00
+	FORM_ADD_RM16_32_R16_32, // 01
+	FORM_ADD_R8_RM8, // 02
+	FORM_ADD_R16_32_RM16_32, // 03
+	FORM_ADD_AL_IMM8, // 04
+	FORM_ADD_EAX_IMM16_32, // 05
+	FORM_PUSH_ES, // 06
+	FORM_POP_ES, // 07
+	FORM_OR_RM8_R8, // 08
+	FORM_OR_RM16_32_R16_32, // 09
+	FORM_OR_R8_RM8, // 0A
+	FORM_OR_R16_32_RM16_32, // 0B
+	FORM_OR_AL_IMM8, // 0C
+	FORM_OR_EAX_IMM16_32, // 0D
+	FORM_PUSH_CS, // 0E
+	FORM_SLDT_RM16_32, // 0F+00+m0
+	FORM_STR_RM16, // 0F+00+m1
+	FORM_LLDT_RM16, // 0F+00+m2
+	FORM_LTR_RM16, // 0F+00+m3
+	FORM_VERR_RM16, // 0F+00+m4
+	FORM_VERW_RM16, // 0F+00+m5
+	FORM_VMCALL, // 0F+01+C1
+	FORM_VMLAUNCH, // 0F+01+C2
+	FORM_VMRESUME, // 0F+01+C3
+	FORM_VMXOFF, // 0F+01+C4
+	FORM_MONITOR, // 0F+01+C8
+	FORM_MWAIT, // 0F+01+C9
+	FORM_CLAC, // 0F+01+CA
+	FORM_SGDT_RM16_32, // 0F+01+m0
+	FORM_SIDT_RM16_32, // 0F+01+m1
+	FORM_LGDT_RM16_32, // 0F+01+m2
+	FORM_LIDT_RM16_32, // 0F+01+m3
+	FORM_SMSW_RM16_32_0F_01_M4, // 0F+01+m4
+	FORM_SMSW_RM16_32_0F_01_M5, // 0F+01+m5
+	FORM_LMSW_RM16_32, // 0F+01+m6
+	FORM_INVPLG_RM16_32, // 0F+01+m7
+	FORM_LAR_R16_32_M16, // 0F+02
+	FORM_LSL_R16_32_M16, // 0F+03
+	FORM_UD_0F_04, // 0F+04
+	FORM_SYSCALL, // 0F+05
+	FORM_CLTS_CR0, // 0F+06
+	FORM_SYSRET, // 0F+07
+	FORM_INVD, // 0F+08
+	FORM_WBINVD, // 0F+09
+	FORM_UD2, // 0F+0B
+	FORM_NOP_RM16_32_0F_0D, // 0F+0D
+	FORM_MOVUPS_XMM_XMM_M128, // 0F+10
+	FORM_MOVSS_XMM_XMM_M32, // F3+0F+10
+	FORM_MOVUPD_XMM_XMM_M128, // 66+0F+10
+	FORM_MOVSD_XMM_XMM_M64, // F2+0F+10
+	FORM_MOVUPS_XMM_M128_XMM, // 0F+11
+	FORM_MOVSS_XMM_M32_XMM, // F3+0F+11
+	FORM_MOVUPD_XMM_M128_XMM, // 66+0F+11
+	FORM_MOVSD_XMM_M64_XMM, // F2+0F+11
+	FORM_MOVHLPS_XMM_XMM, // 0F+12
+	FORM_MOVLPS_XMM_M64, // 0F+12
+	FORM_MOVLPD_XMM_M64, // F3+0F+12
+	FORM_MOVDDUP_XMM_XMM_M64, // 66+0F+12
+	FORM_MOVSLDUP_XMM_XMM_M64, // F2+0F+12
+	FORM_MOVLPS_M64_XMM, // 0F+13
+	FORM_MOVLPD_M64_XMM, // 66+0F+13
+	FORM_UNPCKLPS_XMM_XMM_M64, // 0F+14
+	FORM_UNPCKLPD_XMM_XMM_M128, // 66+0F+14
+	FORM_UNPCKHPS_XMM_XMM_M64, // 0F+15
+	FORM_UNPCKHPD_XMM_XMM_M128, // 66+0F+15
+	FORM_MOVLHPS_XMM_XMM, // 0F+16
+	FORM_MOVHPS_XMM_M64, // 0F+16
+	FORM_MOVHPD_XMM_M64, // 66+0F+16
+	FORM_MOVSHDUP_XMM_XMM_M64, // F3+0F+16
+	FORM_MOVHPS_M64_XMM, // 0F+17
+	FORM_MOVHPD_M64_XMM, // 66+0F+17
+	FORM_PREFETCHNTA_M8, // 0F+18+m0
+	FORM_PREFETCHT0_M8, // 0F+18+m1
+	FORM_PREFETCHT1_M8, // 0F+18+m2
+	FORM_PREFETCHT2_M8, // 0F+18+m3
+	FORM_HINT_NOP_RM16_32_0F_18_M4, // 0F+18+m4
+	FORM_HINT_NOP_RM16_32_0F_18_M5, // 0F+18+m5
+	FORM_HINT_NOP_RM16_32_0F_18_M6, // 0F+18+m6
+	FORM_HINT_NOP_RM16_32_0F_18_M7, // 0F+18+m7
+	FORM_HINT_NOP_RM16_32_0F_19, // 0F+19
+	FORM_HINT_NOP_RM16_32_0F_1A, // 0F+1A
+	FORM_HINT_NOP_RM16_32_0F_1B, // 0F+1B
+	FORM_HINT_NOP_RM16_32_0F_1C, // 0F+1C
+	FORM_HINT_NOP_RM16_32_0F_1D, // 0F+1D
+	FORM_HINT_NOP_RM16_32_0F_1E, // 0F+1E
+	FORM_NOP_RM16_32_0F_1F_M0, // 0F+1F+m0
+	FORM_HINT_NOP_RM16_32_0F_1F_M1, // 0F+1F+m1
+	FORM_HINT_NOP_RM16_32_0F_1F_M2, // 0F+1F+m2
+	FORM_HINT_NOP_RM16_32_0F_1F_M3, // 0F+1F+m3
+	FORM_HINT_NOP_RM16_32_0F_1F_M4, // 0F+1F+m4
+	FORM_HINT_NOP_RM16_32_0F_1F_M5, // 0F+1F+m5
+	FORM_HINT_NOP_RM16_32_0F_1F_M6, // 0F+1F+m6
+	FORM_HINT_NOP_RM16_32_0F_1F_M7, // 0F+1F+m7
+	FORM_MOV_RM32_CRN, // 0F+20
+	FORM_MOV_RM32_DRN, // 0F+21
+	FORM_MOV_CRN_RM32, // 0F+22
+	FORM_MOV_DRN_RM32, // 0F+23
+	FORM_MOVAPS_XMM_XMM_M128, // 0F+28
+	FORM_MOVAPD_XMM_XMM_M128, // 66+0F+28
+	FORM_MOVAPS_XMM_M128_XMM, // 0F+29
+	FORM_MOVAPD_XMM_M128_XMM, // 66+0F+29
+	FORM_CVTPI2PS_XMM_MM_M64, // 0F+2A
+	FORM_CVTPI2SS_XMM_RM32, // F3+0F+2A
+	FORM_CVTPI2PD_XMM_MM_M64, // 66+0F+2A
+	FORM_CVTPI2SD_XMM_RM32, // F2+0F+2A
+	FORM_MOVNTPS_M128_XMM, // 0F+2B
+	FORM_MOVNTPD_M128_XMM, // 66+0F+2B
+	FORM_CVTTPS2PI_MM_XMM_M64, // 0F+2C
+	FORM_CVTTSS2SI_R32_XMM_M32, // F3+0F+2C
+	FORM_CVTTPD2PI_MM_XMM_M128, // 66+0F+2C
+	FORM_CVTTSD2SI_R32_XMM_M64, // F2+0F+2C
+	FORM_CVTPS2PI_MM_XMM_M64, // 0F+2D
+	FORM_CVTSS2SI_R32_XMM_M32, // F3+0F+2D
+	FORM_CVTPD2PI_MM_XMM_M128, // 66+0F+2D
+	FORM_CVTSD2SI_R32_XMM_M64, // F2+0F+2D
+	FORM_UCOMISS_XMM_XMM_M32, // 0F+2E
+	FORM_UCOMISD_XMM_XMM_M64, // 66+0F+2E
+	FORM_COMISS_XMM_XMM_M32, // 0F+2F
+	FORM_COMISD_XMM_XMM_M64, // 66+0F+2F
+	FORM_WRMSR, // 0F+30
+	FORM_RDTSC, // 0F+31
+	FORM_RDMSR, // 0F+32
+	FORM_RDPMC, // 0F+33
+	FORM_SYSENTER, // 0F+34
+	FORM_SYSEXIT, // 0F+35
+	FORM_GETSEC, // 0F+37
+	FORM_PSHUFB_MM_MM_M64, // 0F+38+00
+	FORM_PSHUFB_XMM_XMM_M128, // 66+0F+38+00
+	FORM_PHADDW_MM_MM_M64, // 0F+38+01
+	FORM_PHADDW_XMM_XMM_M128, // 66+0F+38+01
+	FORM_PHADDD_MM_MM_M64, // 0F+38+02
+	FORM_PHADDD_XMM_XMM_M128, // 66+0F+38+02
+	FORM_PHADDSW_MM_MM_M64, // 0F+38+03
+	FORM_PHADDSW_XMM_XMM_M128, // 66+0F+38+03
+	FORM_PMADDUBSW_MM_MM_M64, // 0F+38+04
+	FORM_PMADDUBSW_XMM_XMM_M128, // 66+0F+38+04
+	FORM_PHSUBW_MM_MM_M64, // 0F+38+05
+	FORM_PHSUBW_XMM_XMM_M128, // 66+0F+38+05
+	FORM_PHSUBD_MM_MM_M64, // 0F+38+06
+	FORM_PHSUBD_XMM_XMM_M128, // 66+0F+38+06
+	FORM_PHSUBSW_MM_MM_M64, // 0F+38+07
+	FORM_PHSUBSW_XMM_XMM_M128, // 66+0F+38+07
+	FORM_PSIGNB_MM_MM_M64, // 0F+38+08
+	FORM_PSIGNB_XMM_XMM_M128, // 66+0F+38+08
+	FORM_PSIGNW_MM_MM_M64, // 0F+38+09
+	FORM_PSIGNW_XMM_XMM_M128, // 66+0F+38+09
+	FORM_PSIGND_MM_MM_M64, // 0F+38+0A
+	FORM_PSIGND_XMM_XMM_M128, // 66+0F+38+0A
+	FORM_PMULHRSW_MM_MM_M64, // 0F+38+0B
+	FORM_PMULHRSW_XMM_XMM_M128, // 66+0F+38+0B
+	FORM_PBLENDVB_XMM_XMM_M128_XMM0, // 66+0F+38+10
+	FORM_BLENDVPS_XMM_XMM_M128_XMM0, // 66+0F+38+14
+	FORM_BLENDVPD_XMM_XMM_M128_XMM0, // 66+0F+38+15
+	FORM_PTEST_XMM_XMM_M128, // 66+0F+38+17
+	FORM_PABSB_MM_MM_M64, // 0F+38+1C
+	FORM_PABSB_XMM_XMM_M128, // 66+0F+38+1C
+	FORM_PABSW_MM_MM_M64, // 0F+38+1D
+	FORM_PABSW_XMM_XMM_M128, // 66+0F+38+1D
+	FORM_PABSD_MM_MM_M64, // 0F+38+1E
+	FORM_PABSD_XMM_XMM_M128, // 66+0F+38+1E
+	FORM_PMOVSXBW_XMM_M64, // 66+0F+38+20
+	FORM_PMOVSXBD_XMM_M32, // 66+0F+38+21
+	FORM_PMOVSXBQ_XMM_M16, // 66+0F+38+22
+	FORM_PMOVSXBD_XMM_M64, // 66+0F+38+23
+	FORM_PMOVSXBQ_XMM_M32, // 66+0F+38+24
+	FORM_PMOVSXDQ_XMM_M64, // 66+0F+38+25
+	FORM_PMULDQ_XMM_XMM_M128, // 66+0F+38+28
+	FORM_PCMPEQQ_XMM_XMM_M128, // 66+0F+38+29
+	FORM_MOVNTDQA_XMM_M128, // 66+0F+38+2A
+	FORM_PACKUSDW_XMM_XMM_M128, // 66+0F+38+2B
+	FORM_PMOVZXBW_XMM_M64, // 66+0F+38+30
+	FORM_PMOVZXBD_XMM_M32, // 66+0F+38+31
+	FORM_PMOVZXBQ_XMM_M16, // 66+0F+38+32
+	FORM_PMOVZXBD_XMM_M64, // 66+0F+38+33
+	FORM_PMOVZXBQ_XMM_M32, // 66+0F+38+34
+	FORM_PMOVZXBQ_XMM_M64, // 66+0F+38+35
+	FORM_PCMPGTQ_XMM_XMM_M128, // 66+0F+38+37
+	FORM_PMINSB_XMM_XMM_M128, // 66+0F+38+38
+	FORM_PMINSD_XMM_XMM_M128, // 66+0F+38+39
+	FORM_PMINUW_XMM_XMM_M128, // 66+0F+38+3A
+	FORM_PMINUD_XMM_XMM_M128, // 66+0F+38+3B
+	FORM_PMAXSB_XMM_XMM_M128, // 66+0F+38+3C
+	FORM_PMAXSD_XMM_XMM_M128, // 66+0F+38+3D
+	FORM_PMAXUW_XMM_XMM_M128, // 66+0F+38+3E
+	FORM_PMAXUD_XMM_XMM_M128, // 66+0F+38+3F
+	FORM_PMULLD_XMM_XMM_M128, // 66+0F+38+40
+	FORM_PHMINPOSUW_XMM_XMM_M128, // 66+0F+38+41
+	FORM_INVEPT_R32_M128, // 66+0F+38+80
+	FORM_INVVPID_R32_M128, // 66+0F+38+81
+	FORM_MOVBE_R16_32_M16_32, // 0F+38+F0
+	FORM_CRC32_R32_RM8, // F2+0F+38+F0
+	FORM_MOVBE_M16_32_R16_32, // 0F+38+F1
+	FORM_CRC32_R32_RM16_32, // F2+0F+38+F1
+	FORM_ROUNDPS_XMM_XMM_M128_IMM8, // 66+0F+3A+08
+	FORM_ROUNDPD_XMM_XMM_M128_IMM8, // 66+0F+3A+09
+	FORM_ROUNDSS_XMM_XMM_M32_IMM8, // 66+0F+3A+0A
+	FORM_ROUNDSD_XMM_XMM_M64_IMM8, // 66+0F+3A+0B
+	FORM_BLENDPS_XMM_XMM_M128_IMM8, // 66+0F+3A+0C
+	FORM_BLENDPD_XMM_XMM_M128_IMM8, // 66+0F+3A+0D
+	FORM_PBLENDW_XMM_XMM_M128_IMM8, // 66+0F+3A+0E
+	FORM_PALIGNR_MM_MM_M64, // 0F+3A+0F
+	FORM_PALIGNR_MM_XMM_M128, // 66+0F+3A+0F
+	FORM_PEXTRB_M8_XMM_IMM8, // 66+0F+3A+14
+	FORM_PEXTRW_M16_XMM_IMM8, // 66+0F+3A+15
+	FORM_PEXTRD_M32_XMM_IMM8, // 66+0F+3A+16
+	FORM_EXTRACTPS_M64_XMM_IMM8, // 66+0F+3A+17
+	FORM_PINSRB_XMM_M8_IMM8, // 66+0F+3A+20
+	FORM_INSERTPS_XMM_M32_IMM8, // 66+0F+3A+21
+	FORM_PINSRD_XMM_M64_IMM8, // 66+0F+3A+22
+	FORM_DPPS_XMM_XMM_M128, // 66+0F+3A+40
+	FORM_DPPD_XMM_XMM_M128, // 66+0F+3A+41
+	FORM_MPSADBW_XMM_XMM_M128_IMM8, // 66+0F+3A+42
+	FORM_PCMPESTRM_XMM0_XMM_XMM_M128, // 66+0F+3A+60
+	FORM_PCMPESTRI_ECX_XMM_XMM_M128, // 66+0F+3A+61
+	FORM_PCMPISTRM_XMM0_XMM_XMM_M128_IMM8, // 66+0F+3A+62
+	FORM_PCMPISTRI_ECX_XMM_XMM_M128_IMM8, // 66+0F+3A+63
+	FORM_CMOVO_R16_32_RM16_32, // 0F+40
+	FORM_CMOVNO_R16_32_RM16_32, // 0F+41
+	FORM_CMOVB_R16_32_RM16_32, // 0F+42
+	FORM_CMOVNB_R16_32_RM16_32, // 0F+43
+	FORM_CMOVE_R16_32_RM16_32, // 0F+44
+	FORM_CMOVNE_R16_32_RM16_32, // 0F+45
+	FORM_CMOVBE_R16_32_RM16_32, // 0F+46
+	FORM_CMOVA_R16_32_RM16_32, // 0F+47
+	FORM_CMOVS_R16_32_RM16_32, // 0F+48
+	FORM_CMOVNS_R16_32_RM16_32, // 0F+49
+	FORM_CMOVP_R16_32_RM16_32, // 0F+4A
+	FORM_CMOVNP_R16_32_RM16_32, // 0F+4B
+	FORM_CMOVL_R16_32_RM16_32, // 0F+4C
+	FORM_CMOVGE_R16_32_RM16_32, // 0F+4D
+	FORM_CMOVNG_R16_32_RM16_32, // 0F+4E
+	FORM_CMOVG_R16_32_RM16_32, // 0F+4F
+	FORM_MOVMSKPS_R32_XMM, // 0F+50
+	FORM_MOVMSKPD_R32_XMM_66_0F_50_1, // 66+0F+50
+	FORM_MOVMSKPD_R32_XMM_66_0F_50_2, // 66+0F+50
+	FORM_SQRTPS_XMM_XMM_M128, // 0F+51
+	FORM_SQRTSS_XMM_XMM_M32, // F3+0F+51
+	FORM_SQRTPD_XMM_XMM_M128, // 66+0F+51
+	FORM_SQRTSD_XMM_XMM_M64, // F2+0F+51
+	FORM_RSQRTPS_XMM_XMM_M128, // 0F+52
+	FORM_RSQRTSS_XMM_XMM_M32, // F3+0F+52
+	FORM_RCPPS_XMM_XMM_M128, // 0F+53
+	FORM_RCPSS_XMM_XMM_M32, // F3+0F+53
+	FORM_ANDPS_XMM_XMM_M128, // 0F+54
+	FORM_ANDPD_XMM_XMM_M128, // 66+0F+54
+	FORM_ANDNPS_XMM_XMM_M128, // 0F+55
+	FORM_ANDNPD_XMM_XMM_M128, // 66+0F+55
+	FORM_ORPS_XMM_XMM_M128, // 0F+56
+	FORM_ORPD_XMM_XMM_M128, // 66+0F+56
+	FORM_XORPS_XMM_XMM_M128, // 0F+57
+	FORM_XORPD_XMM_XMM_M128, // 66+0F+57
+	FORM_ADDPS_XMM_XMM_M128, // 0F+58
+	FORM_ADDSS_XMM_XMM_M32, // F3+0F+58
+	FORM_ADDPD_XMM_XMM_M128, // 66+0F+58
+	FORM_ADDSD_XMM_XMM_M64_F2_0F_58, // F2+0F+58
+	FORM_MULPS_XMM_XMM_M128, // 0F+59
+	FORM_MULSS_XMM_XMM_M32, // F3+0F+59
+	FORM_MULPD_XMM_XMM_M128, // 66+0F+59
+	FORM_ADDSD_XMM_XMM_M64_F2_0F_59, // F2+0F+59
+	FORM_CVTPS2PD_XMM_XMM_M128, // 0F+5A
+	FORM_CVTPD2PS_XMM_XMM_M128, // F3+0F+5A
+	FORM_CVTSS2SD_XMM_XMM_M32, // 66+0F+5A
+	FORM_CVTSD2SS_XMM_XMM_M64, // F2+0F+5A
+	FORM_CVTDQ2PS_XMM_XMM_M128, // 0F+5B
+	FORM_CVTPS2DQ_XMM_XMM_M128, // 66+0F+5B
+	FORM_CVTTPS2DQ_XMM_XMM_M128, // F3+0F+5B
+	FORM_SUBPS_XMM_XMM_M128, // 0F+5C
+	FORM_SUBSS_XMM_XMM_M32, // F3+0F+5C
+	FORM_SUBPD_XMM_XMM_M128, // 66+0F+5C
+	FORM_SUBSD_XMM_XMM_M64, // F2+0F+5C
+	FORM_MINPS_XMM_XMM_M128, // 0F+5D
+	FORM_MINSS_XMM_XMM_M32, // F3+0F+5D
+	FORM_MINPD_XMM_XMM_M128, // 66+0F+5D
+	FORM_MINSD_XMM_XMM_M64, // F2+0F+5D
+	FORM_DIVPS_XMM_XMM_M128, // 0F+5E
+	FORM_DIVSS_XMM_XMM_M32, // F3+0F+5E
+	FORM_DIVPD_XMM_XMM_M128, // 66+0F+5E
+	FORM_DIVSD_XMM_XMM_M64, // F2+0F+5E
+	FORM_MAXPS_XMM_XMM_M128, // 0F+5F
+	FORM_MAXSS_XMM_XMM_M32, // F3+0F+5F
+	FORM_MAXPD_XMM_XMM_M128, // 66+0F+5F
+	FORM_MAXSD_XMM_XMM_M64, // F2+0F+5F
+	FORM_PUNPCKLBW_MM_MM_M64, // 0F+60
+	FORM_PUNPCKLBW_XMM_XMM_M128, // 66+0F+60
+	FORM_PUNPCKLBD_MM_MM_M64, // 0F+61
+	FORM_PUNPCKLBD_XMM_XMM_M128, // 66+0F+61
+	FORM_PUNPCKLBQ_MM_MM_M64, // 0F+62
+	FORM_PUNPCKLBQ_XMM_XMM_M128, // 66+0F+62
+	FORM_PACKSSWB_MM_MM_M64, // 0F+63
+	FORM_PACKSSWB_XMM_XMM_M128, // 66+0F+63
+	FORM_PCMPGTB_MM_MM_M64, // 0F+64
+	FORM_PCMPGTB_XMM_XMM_M128, // 66+0F+64
+	FORM_PCMPGTW_MM_MM_M64, // 0F+65
+	FORM_PCMPGTW_XMM_XMM_M128, // 66+0F+65
+	FORM_PCMPGTD_MM_MM_M64, // 0F+66
+	FORM_PCMPGTD_XMM_XMM_M128, // 66+0F+66
+	FORM_PACKUSWB_MM_MM_M64, // 0F+67
+	FORM_PACKUSWB_XMM_XMM_M128, // 66+0F+67
+	FORM_PUNPCKHBW_MM_MM_M64, // 0F+68
+	FORM_PUNPCKHBW_XMM_XMM_M128, // 66+0F+68
+	FORM_PUNPCKHWD_MM_MM_M64, // 0F+69
+	FORM_PUNPCKHWD_XMM_XMM_M128, // 66+0F+69
+	FORM_PUNPCKHDQ_MM_MM_M64, // 0F+6A
+	FORM_PUNPCKHDQ_XMM_XMM_M128, // 66+0F+6A
+	FORM_PACKSSDW_MM_MM_M64, // 0F+6B
+	FORM_PACKSSDW_XMM_XMM_M128, // 66+0F+6B
+	FORM_PUNPCKLQDQ_XMM_XMM_M128, // 66+0F+6C
+	FORM_PUNPCKHQDQ_XMM_XMM_M128, // 66+0F+6D
+	FORM_MOVD_XMM_RM32_0F_6E, // 0F+6E
+	FORM_MOVD_XMM_RM32_66_0F_6E, // 66+0F+6E
+	FORM_MOVQ_XMM_MM_M64, // 0F+6F
+	FORM_MOVDQA_XMM_XMM_M128, // 66+0F+6F
+	FORM_MOVDQU_XMM_XMM_M128, // F3+0F+6F
+	FORM_PSHUFW_MM_M64_IMM8, // 0F+70
+	FORM_PSHUFLW_XMM_M128_IMM8, // F3+0F+70
+	FORM_PSHUFHW_XMM_M128_IMM8, // 66+0F+70
+	FORM_PSHUFD_XMM_M128_IMM8, // F2+0F+70
+	FORM_PSRLW_MM_IMM8, // 0F+71+m2
+	FORM_PSRLW_XMM_IMM8, // 66+0F+71+m2
+	FORM_PSRAW_MM_IMM8, // 0F+71+m4
+	FORM_PSRAW_XMM_IMM8, // 66+0F+71+m4
+	FORM_PSLLW_MM_IMM8, // 0F+71+m6
+	FORM_PSLLW_XMM_IMM8, // 66+0F+71+m6
+	FORM_PSRLD_MM_IMM8_0F_72_M2, // 0F+72+m2
+	FORM_PSRLD_XMM_IMM8_66_0F_72_M2, // 66+0F+72+m2
+	FORM_PSRAD_MM_IMM8_0F_72_M4, // 0F+72+m4
+	FORM_PSRAD_XMM_IMM8_66_0F_72_M4, // 66+0F+72+m4
+	FORM_PSLLD_MM_IMM8_0F_72_M6, // 0F+72+m6
+	FORM_PSLLD_XMM_IMM8_66_0F_72_M6, // 66+0F+72+m6
+	FORM_PSRLD_MM_IMM8_0F_73_M2, // 0F+73+m2
+	FORM_PSRLD_XMM_IMM8_66_0F_73_M2, // 66+0F+73+m2
+	FORM_PSRAD_MM_IMM8_0F_73_M3, // 0F+73+m3
+	FORM_PSRAD_XMM_IMM8_66_0F_73_M6, // 66+0F+73+m6
+	FORM_PSLLD_MM_IMM8_0F_73_M6, // 0F+73+m6
+	FORM_PSLLD_XMM_IMM8_66_0F_73_M7, // 66+0F+73+m7
+	FORM_PCMPEQB_MM_MM_M64, // 0F+74
+	FORM_PCMPEQB_XMM_XMM_M128, // 66+0F+74
+	FORM_PCMPEQW_MM_MM_M64, // 0F+75
+	FORM_PCMPEQW_XMM_XMM_M128, // 66+0F+75
+	FORM_PCMPEQD_MM_MM_M64, // 0F+76
+	FORM_PCMPEQD_XMM_XMM_M128, // 66+0F+76
+	FORM_EMMS, // 0F+77
+	FORM_VMREAD, // 0F+78
+	FORM_VMWRITE, // 0F+79
+	FORM_HADDPD_XMM_XMM_M128, // 66+0F+7C
+	FORM_HADDPS_XMM_XMM_M128, // F2+0F+7C
+	FORM_HSUBPD_XMM_XMM_M128, // 66+0F+7D
+	FORM_HSUBPS_XMM_XMM_M128, // F2+0F+7D
+	FORM_MOVD_RM32_MM, // 0F+7E
+	FORM_MOVD_RM32_XMM, // 66+0F+7E
+	FORM_MOVQ_XMM_XMM_M64, // F3+0F+7E
+	FORM_MOVQ_XMM_M64_MM, // 0F+7F
+	FORM_MOVDQA_XMM_M128_XMM, // 66+0F+7F
+	FORM_MOVDQU_XMM_M128_XMM, // F3+0F+7F
+	FORM_LONG_JO_REL16_32, // 0F+80
+	FORM_LONG_JNO_REL16_32, // 0F+81
+	FORM_LONG_JB_REL16_32, // 0F+82
+	FORM_LONG_JNB_REL16_32, // 0F+83
+	FORM_LONG_JE_REL16_32, // 0F+84
+	FORM_LONG_JNE_REL16_32, // 0F+85
+	FORM_LONG_JNA_REL16_32, // 0F+86
+	FORM_LONG_JA_REL16_32, // 0F+87
+	FORM_LONG_JS_REL16_32, // 0F+88
+	FORM_LONG_JNS_REL16_32, // 0F+89
+	FORM_LONG_JP_REL16_32, // 0F+8A
+	FORM_LONG_JNP_REL16_32, // 0F+8B
+	FORM_LONG_JL_REL16_32, // 0F+8C
+	FORM_LONG_JNL_REL16_32, // 0F+8D
+	FORM_LONG_JNG_REL16_32, // 0F+8E
+	FORM_LONG_JG_REL16_32, // 0F+8F
+	FORM_SETO_RM8, // 0F+90
+	FORM_SETNO_RM8, // 0F+91
+	FORM_SETB_RM8, // 0F+92
+	FORM_SETNB_RM8, // 0F+93
+	FORM_SETE_RM8, // 0F+94
+	FORM_SETNE_RM8, // 0F+95
+	FORM_SETNA_RM8, // 0F+96
+	FORM_SETA_RM8, // 0F+97
+	FORM_SETS_RM8, // 0F+98
+	FORM_SETNS_RM8, // 0F+99
+	FORM_SETP_RM8, // 0F+9A
+	FORM_SETNP_RM8, // 0F+9B
+	FORM_SETL_RM8, // 0F+9C
+	FORM_SETNL_RM8, // 0F+9D
+	FORM_SETNG_RM8, // 0F+9E
+	FORM_SETG_RM8, // 0F+9F
+	FORM_PUSH_FS, // 0F+A0
+	FORM_POP_FS, // 0F+A1
+	FORM_CPUID_IA32_BIOS, // 0F+A2
+	FORM_BT_RM16_32_R16_32, // 0F+A3
+	FORM_SHLD_RM16_32_R16_32_IMM8, // 0F+A4
+	FORM_SHLD_RM16_32_R16_32_CL, // 0F+A5
+	FORM_PUSH_GS, // 0F+A8
+	FORM_POP_GS, // 0F+A9
+	FORM_RSM, // 0F+AA
+	FORM_BTS_RM16_32_R16_32, // 0F+AB
+	FORM_SHRD_RM16_32_R16_32_IMM8, // 0F+AC
+	FORM_SHRD_RM16_32_R16_32_CL, // 0F+AD
+	FORM_FXSAVE_M512_ST_ST1, // 0F+AE+m0
+	FORM_FXRSTOR_ST_ST1_ST2, // 0F+AE+m1
+	FORM_LDMXCSR_M32, // 0F+AE+m2
+	FORM_STMXCSR_M32, // 0F+AE+m3
+	FORM_XSAVE_M_EDX_EAX, // 0F+AE+m4
+	FORM_LFENCE, // 0F+AE+m5
+	FORM_XRSTOR_ST_ST1_ST2, // 0F+AE+m5
+	FORM_MFENCE, // 0F+AE+m6
+	FORM_SFENCE, // 0F+AE+m7
+	FORM_CLFLUSH_M8, // 0F+AE+m7
+	FORM_IMUL_R16_32_RM16_32, // 0F+AF
+	FORM_CMPXCHG_RM8_AL_R8, // 0F+B0
+	FORM_CMPXCHG_RM16_32_EAX_R16_32, // 0F+B1
+	FORM_LSS_SS_R16_32_M16_32_AND_16_32, // 0F+B2
+	FORM_BTR_RM16_32_R16_32, // 0F+B3
+	FORM_LFS_FS_RM16_32_M16_32_AND_16_32, // 0F+B4
+	FORM_LGS_GS_RM16_32_M16_32_AND_16_32, // 0F+B5
+	FORM_MOVZX_R16_32_RM8, // 0F+B6
+	FORM_MOVZX_R16_32_RM16, // 0F+B7
+	FORM_POPCNT_R16_32_RM16_32, // F3+0F+B8
+	FORM_UD_0F_B9, // 0F+B9
+	FORM_BT_RM16_32_IMM8, // 0F+BA+m4
+	FORM_BTS_RM16_32_IMM8, // 0F+BA+m5
+	FORM_BTR_RM16_32_IMM8, // 0F+BA+m6
+	FORM_BTC_RM16_32_IMM8, // 0F+BA+m7
+	FORM_BTC_RM16_32_R16_32, // 0F+BB
+	FORM_BSF_R16_32_RM16_32, // 0F+BC
+	FORM_BSR_R16_32_RM16_32, // 0F+BD
+	FORM_MOVSX_R16_32_RM8, // 0F+BE
+	FORM_MOVSX_R16_32_RM16, // 0F+BF
+	FORM_XADD_RM8_R8, // 0F+C0
+	FORM_XADD_RM16_32_R16_32, // 0F+C1
+	FORM_CMPPS_XMM_XMM_M128_IMM8, // 0F+C2
+	FORM_CMPSS_XMM_XMM_M32_IMM8, // F3+0F+C2
+	FORM_CMPPD_XMM_XMM_M128_IMM8, // 66+0F+C2
+	FORM_CMPSD_XMM_XMM_M64_IMM8, // F2+0F+C2
+	FORM_MOVNTI_M32_R32, // 0F+C3
+	FORM_PINSRW_MM_M16_IMM8, // 0F+C4
+	FORM_PINSRW_XMM_M16_IMM8, // 66+0F+C4
+	FORM_PEXTRW_R32_MM_IMM8, // 0F+C5
+	FORM_PEXTRW_R32_XMM_IMM8, // 66+0F+C5
+	FORM_SHUFPS_XMM_XMM_M128_IMM8, // 0F+C6
+	FORM_SHUFPD_XMM_XMM_M128_IMM8, // 66+0F+C6
+	FORM_CMPXCHG8B_M64_EAX_EDX, // 0F+C7+m1
+	FORM_VMPTRLD_M64, // 0F+C7+m6
+	FORM_VMCLEAN_M64, // 66+0F+C7+m6
+	FORM_VMXON_M64, // F3+0F+C7+m6
+	FORM_VMPTRST_M64, // 0F+C7+m7
+	FORM_BSWAP_R16_32, // 0F+C8+r
+	FORM_ADDSUBPD_XMM_XMM_M128_66_0F_D0, // 66+0F+D0
+	FORM_ADDSUBPD_XMM_XMM_M128_F2_0F_D0, // F2+0F+D0
+	FORM_PSRLW_MM_MM_M64, // 0F+D1
+	FORM_PSRLW_XMM_XMM_M128, // 66+0F+D1
+	FORM_PSRLD_MM_MM_M64, // 0F+D2
+	FORM_PSRLD_XMM_XMM_M128, // 66+0F+D2
+	FORM_PSRLQ_MM_MM_M64, // 0F+D3
+	FORM_PSRLQ_XMM_XMM_M128, // 66+0F+D3
+	FORM_PADDQ_MM_MM_M64, // 0F+D4
+	FORM_PADDQ_XMM_XMM_M128, // 66+0F+D4
+	FORM_PMULLW_MM_MM_M64, // 0F+D5
+	FORM_PMULLW_XMM_XMM_M128, // 66+0F+D5
+	FORM_MOVQ_XMM_M64_XMM, // 66+0F+D6
+	FORM_MOVQ2DQ_XMM_MM, // F3+0F+D6
+	FORM_MOVDQ2Q_MM_XMM, // F2+0F+D6
+	FORM_PMOVMSKB_R32_MM, // 0F+D7
+	FORM_PMOVMSKB_R32_XMM, // 66+0F+D7
+	FORM_PSUBUSB_MM_MM_M64, // 0F+D8
+	FORM_PSUBUSB_XMM_XMM_M128, // 66+0F+D8
+	FORM_PSUBUSW_MM_MM_M64, // 0F+D9
+	FORM_PSUBUSW_XMM_XMM_M128, // 66+0F+D9
+	FORM_PMINUB_MM_MM_M64, // 0F+DA
+	FORM_PMINUB_XMM_XMM_M128, // 66+0F+DA
+	FORM_PAND_MM_MM_M64, // 0F+DB
+	FORM_PAND_XMM_XMM_M128, // 66+0F+DB
+	FORM_PADDUSB_MM_MM_M64, // 0F+DC
+	FORM_PADDUSB_XMM_XMM_M128, // 66+0F+DC
+	FORM_PADDUSW_MM_MM_M64, // 0F+DD
+	FORM_PADDUSW_XMM_XMM_M128, // 66+0F+DD
+	FORM_PMAXUB_MM_MM_M64, // 0F+DE
+	FORM_PMAXUB_XMM_XMM_M128, // 66+0F+DE
+	FORM_PANDN_MM_MM_M64, // 0F+DF
+	FORM_PANDN_XMM_XMM_M128, // 66+0F+DF
+	FORM_PAVGB_MM_MM_M64, // 0F+E0
+	FORM_PAVGB_XMM_XMM_M128, // 66+0F+E0
+	FORM_PSRAW_MM_MM_M64, // 0F+E1
+	FORM_PSRAW_XMM_XMM_M128, // 66+0F+E1
+	FORM_PSRAD_MM_MM_M64, // 0F+E2
+	FORM_PSRAD_XMM_XMM_M128, // 66+0F+E2
+	FORM_PAVGW_MM_MM_M64, // 0F+E3
+	FORM_PAVGW_XMM_XMM_M128, // 66+0F+E3
+	FORM_PMULHUW_MM_MM_M64, // 0F+E4
+	FORM_PMULHUW_XMM_XMM_M128, // 66+0F+E4
+	FORM_PMULHW_MM_MM_M64, // 0F+E5
+	FORM_PMULHW_XMM_XMM_M128, // 66+0F+E5
+	FORM_CVTPD2DQ_XMM_XMM_M128, // F2+0F+E6
+	FORM_CVTTPD2DQ_XMM_XMM_M128, // 66+0F+E6
+	FORM_CVTDQ2PD_XMM_XMM_M128, // F3+0F+E6
+	FORM_MOVNTQ_M64_MM, // 0F+E7
+	FORM_MOVNTDQ_M128_XMM, // 66+0F+E7
+	FORM_PSUBSB_MM_MM_M64, // 0F+E8
+	FORM_PSUBSB_XMM_XMM_M128, // 66+0F+E8
+	FORM_PSUBSW_MM_MM_M64, // 0F+E9
+	FORM_PSUBSW_XMM_XMM_M128, // 66+0F+E9
+	FORM_PMINSW_MM_MM_M64, // 0F+EA
+	FORM_PMINSW_XMM_XMM_M128, // 66+0F+EA
+	FORM_POR_MM_MM_M64, // 0F+EB
+	FORM_POR_XMM_XMM_M128, // 66+0F+EB
+	FORM_PADDSB_MM_MM_M64, // 0F+EC
+	FORM_PADDSB_XMM_XMM_M128, // 66+0F+EC
+	FORM_PADDSW_MM_MM_M64, // 0F+ED
+	FORM_PADDSW_XMM_XMM_M128, // 66+0F+ED
+	FORM_PMAXSW_MM_MM_M64, // 0F+EE
+	FORM_PMAXSW_XMM_XMM_M128, // 66+0F+EE
+	FORM_PXOR_MM_MM_M64, // 0F+EF
+	FORM_PXOR_XMM_XMM_M128, // 66+0F+EF
+	FORM_LDDQU_XMM_M128, // F2+0F+F0
+	FORM_PSLLW_MM_MM_M64, // 0F+F1
+	FORM_PSLLW_XMM_XMM_M128, // 66+0F+F1
+	FORM_PSLLD_MM_MM_M64, // 0F+F2
+	FORM_PSLLD_XMM_XMM_M128, // 66+0F+F2
+	FORM_PSLLQ_MM_MM_M64, // 0F+F3
+	FORM_PSLLQ_XMM_XMM_M128, // 66+0F+F3
+	FORM_PMULUDQ_MM_MM_M64, // 0F+F4
+	FORM_PMULUDQ_XMM_XMM_M128, // 66+0F+F4
+	FORM_PMADDWD_MM_MM_M64, // 0F+F5
+	FORM_PMADDWD_XMM_XMM_M128, // 66+0F+F5
+	FORM_PSADBW_MM_MM_M64, // 0F+F6
+	FORM_PSADBW_XMM_XMM_M128, // 66+0F+F6
+	FORM_MASKMOVQ_M64_MM_MM, // 0F+F7
+	FORM_MASKMOVDQU_M128_XMM_XMM, // 66+0F+F7
+	FORM_PSUBB_MM_MM_M64, // 0F+F8
+	FORM_PSUBB_XMM_XMM_M128, // 66+0F+F8
+	FORM_PSUBW_MM_MM_M64, // 0F+F9
+	FORM_PSUBW_XMM_XMM_M128, // 66+0F+F9
+	FORM_PSUBD_MM_MM_M64, // 0F+FA
+	FORM_PSUBD_XMM_XMM_M128, // 66+0F+FA
+	FORM_PSUBQ_MM_MM_M64, // 0F+FB
+	FORM_PSUBQ_XMM_XMM_M128, // 66+0F+FB
+	FORM_PADDB_MM_MM_M64, // 0F+FC
+	FORM_PADDB_XMM_XMM_M128, // 66+0F+FC
+	FORM_PADDW_MM_MM_M64, // 0F+FD
+	FORM_PADDW_XMM_XMM_M128, // 66+0F+FD
+	FORM_PADDD_MM_MM_M64, // 0F+FE
+	FORM_PADDD_XMM_XMM_M128, // 66+0F+FE
+	FORM_ADC_RM8_R8, // 10
+	FORM_ADC_RM16_32_R16_32, // 11
+	FORM_ADC_R8_RM8, // 12
+	FORM_ADC_R16_32_RM16_32, // 13
+	FORM_ADC_AL_IMM8, // 14
+	FORM_ADC_EAX_IMM16_32, // 15
+	FORM_PUSH_SS, // 16
+	FORM_POP_SS, // 17
+	FORM_SBB_RM8_R8, // 18
+	FORM_SBB_RM16_32_R16_32, // 19
+	FORM_SBB_R8_RM8, // 1A
+	FORM_SBB_R16_32_RM16_32, // 1B
+	FORM_SBB_AL_IMM8, // 1C
+	FORM_SBB_EAX_IMM16_32, // 1D
+	FORM_PUSH_DS, // 1E
+	FORM_POP_DS, // 1F
+	FORM_AND_RM8_R8, // 20
+	FORM_AND_RM16_32_R16_32, // 21
+	FORM_AND_R8_RM8, // 22
+	FORM_AND_R16_32_RM16_32, // 23
+	FORM_AND_AL_IMM8, // 24
+	FORM_AND_EAX_IMM16_32, // 25
+	FORM_DAA_AL, // 27
+	FORM_SUB_RM8_R8, // 28
+	FORM_SUB_RM16_32_R16_32, // 29
+	FORM_SUB_R8_RM8, // 2A
+	FORM_SUB_R16_32_RM16_32, // 2B
+	FORM_SUB_AL_IMM8, // 2C
+	FORM_SUB_EAX_IMM16_32, // 2D
+	FORM_DAS_AL, // 2F
+	FORM_XOR_RM8_R8, // 30
+	FORM_XOR_RM16_32_R16_32, // 31
+	FORM_XOR_R8_RM8, // 32
+	FORM_XOR_R16_32_RM16_32, // 33
+	FORM_XOR_AL_IMM8, // 34
+	FORM_XOR_EAX_IMM16_32, // 35
+	FORM_AAA_AL_AH, // 37
+	FORM_CMP_RM8_R8, // 38
+	FORM_CMP_RM16_32_R16_32, // 39
+	FORM_CMP_R8_RM8, // 3A
+	FORM_CMP_R16_32_RM16_32, // 3B
+	FORM_CMP_AL_IMM8, // 3C
+	FORM_CMP_EAX_IMM16_32, // 3D
+	FORM_AAS_AL_AH, // 3F
+	FORM_INC_R16_32, // 40+r
+	FORM_DEC_R16_32, // 48+r
+	FORM_PUSH_R16_32, // 50+r
+	FORM_POP_R16_32, // 58+r
+	FORM_PUSHAD, // 60
+	FORM_POPAD, // 61
+	FORM_BOUND_R16_32_M16_32_AND_16_32, // 62
+	FORM_ARPL_RM16_R16_63_1, // 63
+	FORM_ARPL_RM16_R16_63_2, // 63
+	FORM_PUSH_IMM16_32, // 68
+	FORM_IMUL_R16_32_RM16_32_IMM16_32, // 69
+	FORM_PUSH_IMM8, // 6A
+	FORM_IMUL_R16_32_RM16_32_IMM8, // 6B
+	FORM_INSB, // 6C
+	FORM_INSD, // 6D
+	FORM_OUTSB, // 6E
+	FORM_OUTSD, // 6F
+	FORM_JO_SHORT_REL8, // 70
+	FORM_JNO_SHORT_REL8, // 71
+	FORM_JB_SHORT_REL8, // 72
+	FORM_JAE_SHORT_REL8, // 73
+	FORM_JE_SHORT_REL8, // 74
+	FORM_JNE_SHORT_REL8, // 75
+	FORM_JNA_SHORT_REL8, // 76
+	FORM_JA_SHORT_REL8, // 77
+	FORM_JS_SHORT_REL8, // 78
+	FORM_JNS_SHORT_REL8, // 79
+	FORM_JP_SHORT_REL8, // 7A
+	FORM_JNP_SHORT_REL8, // 7B
+	FORM_JL_SHORT_REL8, // 7C
+	FORM_JGE_SHORT_REL8, // 7D
+	FORM_JLE_SHORT_REL8, // 7E
+	FORM_JG_SHORT_REL8, // 7F
+	FORM_ADD_RM8_IMM8_80_M0, // 80+m0
+	FORM_OR_RM8_IMM8_80_M1, // 80+m1
+	FORM_ADC_RM8_IMM8_80_M2, // 80+m2
+	FORM_SBB_RM8_IMM8_80_M3, // 80+m3
+	FORM_AND_RM8_IMM8_80_M4, // 80+m4
+	FORM_SUB_RM8_IMM8_80_M5, // 80+m5
+	FORM_XOR_RM8_IMM8_80_M6, // 80+m6
+	FORM_CMP_RM8_IMM8_80_M7, // 80+m7
+	FORM_ADD_RM16_32_IMM16_32, // 81+m0
+	FORM_OR_RM16_32_IMM16_32, // 81+m1
+	FORM_ADC_RM16_32_IMM16_32, // 81+m2
+	FORM_SBB_RM16_32_IMM16_32, // 81+m3
+	FORM_AND_RM16_32_IMM16_32, // 81+m4
+	FORM_SUB_RM16_32_IMM16_32, // 81+m5
+	FORM_XOR_RM16_32_IMM16_32, // 81+m6
+	FORM_CMP_RM16_32_IMM16_32, // 81+m7
+	FORM_ADD_RM8_IMM8_82_M0, // 82+m0
+	FORM_OR_RM8_IMM8_82_M1, // 82+m1
+	FORM_ADC_RM8_IMM8_82_M2, // 82+m2
+	FORM_SBB_RM8_IMM8_82_M3, // 82+m3
+	FORM_AND_RM8_IMM8_82_M4, // 82+m4
+	FORM_SUB_RM8_IMM8_82_M5, // 82+m5
+	FORM_XOR_RM8_IMM8_82_M6, // 82+m6
+	FORM_CMP_RM8_IMM8_82_M7, // 82+m7
+	FORM_ADD_RM16_32_IMM8, // 83+m0
+	FORM_OR_RM16_32_IMM8, // 83+m1
+	FORM_ADC_RM16_32_IMM8, // 83+m2
+	FORM_SBB_RM16_32_IMM8, // 83+m3
+	FORM_AND_RM16_32_IMM8, // 83+m4
+	FORM_SUB_RM16_32_IMM8, // 83+m5
+	FORM_XOR_RM16_32_IMM8, // 83+m6
+	FORM_CMP_RM16_32_IMM8, // 83+m7
+	FORM_TEST_RM8_R8, // 84
+	FORM_TEST_RM16_32_R16_32, // 85
+	FORM_XCHG_RM8_R8, // 86
+	FORM_XCHG_RM16_32_R16_32, // 87
+	FORM_MOV_RM8_R8, // 88
+	FORM_MOV_RM16_32_R16_32, // 89
+	FORM_MOV_R8_RM8, // 8A
+	FORM_MOV_R16_32_RM16_32, // 8B
+	FORM_MOV_M16_SREG, // 8C
+	FORM_LEA_R16_32_M32, // 8D
+	FORM_MOV_SREG_RM16, // 8E
+	FORM_POP_RM16_32, // 8F
+	FORM_NOP, // 90
+	FORM_XCHG_EAX_R16_32, // 90+r
+	FORM_CBW_AX_AL, // 98
+	FORM_CWD_AX_AL, // 99
+	FORM_CALLF_PTR16_32, // 9A
+	FORM_FWAIT, // 9B
+	FORM_PUSHFD, // 9C
+	FORM_POPFD, // 9D
+	FORM_SAHF_AH, // 9E
+	FORM_LAHF_AH, // 9F
+	FORM_MOV_AL_MOFFS8, // A0
+	FORM_MOV_EAX_MOFFS16_32, // A1
+	FORM_MOV_MOFFS8_AL, // A2
+	FORM_MOV_MOFFS16_32_EAX, // A3
+	FORM_MOVSB, // A4
+	FORM_MOVSW, // A5
+	FORM_CMPSB, // A6
+	FORM_CMPSW, // A7
+	FORM_TEST_AL_IMM8, // A8
+	FORM_TEST_EAX_IMM16_32, // A9
+	FORM_STOSB, // AA
+	FORM_STOSW, // AB
+	FORM_LODSB, // AC
+	FORM_LODSW, // AD
+	FORM_SCASB, // AE
+	FORM_SCASW, // AF
+	FORM_MOV_R8_IMM8, // B0+r
+	FORM_MOV_R16_32_IMM16_32, // B8+r
+	FORM_ROL_RM8_IMM8, // C0+m0
+	FORM_ROR_RM8_IMM8, // C0+m1
+	FORM_RCL_RM8_IMM8, // C0+m2
+	FORM_RCR_RM8_IMM8, // C0+m3
+	FORM_SHL_RM8_IMM8, // C0+m4
+	FORM_SHR_RM8_IMM8, // C0+m5
+	FORM_SAL_RM8_IMM8, // C0+m6
+	FORM_SAR_RM8_IMM8, // C0+m7
+	FORM_ROL_RM16_32_IMM8, // C1+m0
+	FORM_ROR_RM16_32_IMM8, // C1+m1
+	FORM_RCL_RM16_32_IMM8, // C1+m2
+	FORM_RCR_RM16_32_IMM8, // C1+m3
+	FORM_SHL_RM16_32_IMM8, // C1+m4
+	FORM_SHR_RM16_32_IMM8, // C1+m5
+	FORM_SAL_RM16_32_IMM8, // C1+m6
+	FORM_SAR_RM16_32_IMM8, // C1+m7
+	FORM_RET_IMM16, // C2
+	FORM_RETN, // C3
+	FORM_LES_ES_R16_32_M16_32_AND_16_32, // C4
+	FORM_LDS_DS_R16_32_M16_32_AND_16_32, // C5
+	FORM_MOV_RM8_IMM8, // C6
+	FORM_MOV_RM16_32_IMM16_32, // C7
+	FORM_MOV_RM16_32_IMM16, // 66+C7
+	FORM_ENTER_EBP_IMM16_IMM8, // C8
+	FORM_LEAVE_EBP, // C9
+	FORM_RETF_IMM16, // CA
+	FORM_RETF, // CB
+	FORM_INT_3, // CC
+	FORM_INT_IMM8, // CD
+	FORM_INTO, // CE
+	FORM_IRETD, // CF
+	FORM_ROL_RM8_ONE, // D0+m0
+	FORM_ROR_RM8_ONE, // D0+m1
+	FORM_RCL_RM8_ONE, // D0+m2
+	FORM_RCR_RM8_ONE, // D0+m3
+	FORM_SHL_RM8_ONE_D0_M4, // D0+m4
+	FORM_SHR_RM8_ONE_D0_M5, // D0+m5
+	FORM_SHL_RM8_ONE_D0_M6, // D0+m6
+	FORM_SHR_RM8_ONE_D0_M7, // D0+m7
+	FORM_ROL_RM16_32_ONE, // D1+m0
+	FORM_ROR_RM16_32_ONE, // D1+m1
+	FORM_RCL_RM16_32_ONE, // D1+m2
+	FORM_RCR_RM16_32_ONE, // D1+m3
+	FORM_SHL_RM16_32_ONE_D1_M4, // D1+m4
+	FORM_SHR_RM16_32_ONE_D1_M5, // D1+m5
+	FORM_SHL_RM16_32_ONE_D1_M6, // D1+m6
+	FORM_SHR_RM16_32_ONE_D1_M7, // D1+m7
+	FORM_ROL_RM8_CL, // D2+m0
+	FORM_ROR_RM8_CL, // D2+m1
+	FORM_RCL_RM8_CL, // D2+m2
+	FORM_RCR_RM8_CL, // D2+m3
+	FORM_SHL_RM8_CL_D2_M4, // D2+m4
+	FORM_SHR_RM8_CL_D2_M5, // D2+m5
+	FORM_SHL_RM8_CL_D2_M6, // D2+m6
+	FORM_SHR_RM8_CL_D2_M7, // D2+m7
+	FORM_ROL_RM16_32_CL, // D3+m0
+	FORM_ROR_RM16_32_CL, // D3+m1
+	FORM_RCL_RM16_32_CL, // D3+m2
+	FORM_RCR_RM16_32_CL, // D3+m3
+	FORM_SHL_RM16_32_CL_D3_M4, // D3+m4
+	FORM_SHR_RM16_32_CL_D3_M5, // D3+m5
+	FORM_SHL_RM16_32_CL_D3_M6, // D3+m6
+	FORM_SHR_RM16_32_CL_D3_M7, // D3+m7
+	FORM_AAM_AL_AH_IMM8, // D4
+	FORM_AAD_AL_AH_IMM8, // D5
+	FORM_SETALC_AL, // D6
+	FORM_XLATB_AL, // D7
+	FORM_FADD_ST_STI, // D8+m8
+	FORM_FMUL_ST_STI, // D8+m9
+	FORM_FCOM_ST_STI, // D8+mA
+	FORM_FCOMP_ST_STI, // D8+mB
+	FORM_FSUB_ST_STI, // D8+mC
+	FORM_FSUBR_ST_STI, // D8+mD
+	FORM_FDIV_ST_STI, // D8+mE
+	FORM_FDIVR_ST_STI, // D8+mF
+	FORM_FADD_STI_D8_M0, // D8+m0
+	FORM_FMUL_STI_D8_M1, // D8+m1
+	FORM_FCOM_STI_D8_M2, // D8+m2
+	FORM_FCOMP_STI_D8_M3, // D8+m3
+	FORM_FSUB_STI_D8_M4, // D8+m4
+	FORM_FSUBR_STI_D8_M5, // D8+m5
+	FORM_FDIV_STI_D8_M6, // D8+m6
+	FORM_FDIVR_STI_D8_M7, // D8+m7
+	FORM_FLD_STI_D9_M0, // D9+m0
+	FORM_FXCH_STI, // D9+m1
+	FORM_FST_STI_D9_M2, // D9+m2
+	FORM_FSTP_STI_D9_M3, // D9+m3
+	FORM_FLDENV_STI, // D9+m4
+	FORM_FLDCW_STI, // D9+m5
+	FORM_FNSTENV_STI, // D9+m6
+	FORM_FNSTCW_STI, // D9+m7
+	FORM_FCMOVB_ST_STI, // DA+m8
+	FORM_FCMOVE_ST_STI, // DA+m9
+	FORM_FCMOVBE_ST_STI, // DA+mA
+	FORM_FCMOVU_ST_STI, // DA+mB
+	FORM_FISUB_ST_STI, // DA+mC
+	FORM_FISUBR_ST_STI, // DA+mD
+	FORM_FIDIV_ST_STI, // DA+mE
+	FORM_FIDIVR_ST_STI, // DA+mF
+	FORM_FIADD_STI_DA_M0, // DA+m0
+	FORM_FIMUL_STI_DA_M1, // DA+m1
+	FORM_FICOM_STI_DA_M2, // DA+m2
+	FORM_FICOMP_STI_DA_M3, // DA+m3
+	FORM_FISUB_STI_DA_M4, // DA+m4
+	FORM_FISUBR_STI_DA_M5, // DA+m5
+	FORM_FIDIV_STI_DA_M6, // DA+m6
+	FORM_FIDIVR_STI, // DA+m7
+	FORM_FCMOVNB_ST_STI, // DB+m8
+	FORM_FCMOVNE_ST_STI, // DB+m9
+	FORM_FCMOVNBE_ST_STI, // DB+mA
+	FORM_FCMOVNU_ST_STI, // DB+mB
+	FORM_FILD_STI_DB_M0, // DB+m0
+	FORM_FISTTP_STI_DB_M1, // DB+m1
+	FORM_FIST_STI_DB_M2, // DB+m2
+	FORM_FISTP_STI_DB_M3, // DB+m3
+	FORM_FINIT_STI, // DB+m4
+	FORM_FUCOMI_STI, // DB+m5
+	FORM_FCOMI_STI, // DB+m6
+	FORM_FSTP_STI_DB_M7, // DB+m7
+	FORM_FADD_STI_ST, // DC+m8
+	FORM_FMUL_STI_ST, // DC+m9
+	FORM_FCOM_STI_ST, // DC+mA
+	FORM_FCOMP_STI_ST, // DC+mB
+	FORM_FSUB_STI_ST, // DC+mC
+	FORM_FSUBR_STI_ST, // DC+mD
+	FORM_FDIV_STI_ST, // DC+mE
+	FORM_FDIVR_STI_ST, // DC+mF
+	FORM_FADD_STI_DC_M0, // DC+m0
+	FORM_FMUL_STI_DC_M1, // DC+m1
+	FORM_FCOM_STI_DC_M2, // DC+m2
+	FORM_FCOMP_STI_DC_M3, // DC+m3
+	FORM_FSUB_STI_DC_M4, // DC+m4
+	FORM_FSUBR_STI_DC_M5, // DC+m5
+	FORM_FDIV_STI_DC_M6, // DC+m6
+	FORM_FDIVR_STI_DC_M7, // DC+m7
+	FORM_FFREE_STI, // DD+m8
+	FORM_FLD_STI_DD_M0, // DD+m0
+	FORM_FISTTP_STI_DD_M1, // DD+m1
+	FORM_FST_STI_DD_M2, // DD+m2
+	FORM_FSTP_STI_DD_M3, // DD+m3
+	FORM_FRSTOR_STI, // DD+m4
+	FORM_FUCOMP_STI, // DD+m5
+	FORM_FNSAVE_STI, // DD+m6
+	FORM_FNSTSW_STI_DD_M7, // DD+m7
+	FORM_FADDP_ST_STI, // DE+m8
+	FORM_FMULP_ST_STI, // DE+m9
+	FORM_FICOM_ST_STI, // DE+mA
+	FORM_FICOMP_ST_STI, // DE+mB
+	FORM_FSUBRP_ST_STI, // DE+mC
+	FORM_FSUBP_ST_STI, // DE+mD
+	FORM_FDIVRP_ST_STI, // DE+mE
+	FORM_FDIVP_ST_STI, // DE+mF
+	FORM_FIADD_STI_DE_M0, // DE+m0
+	FORM_FIMUL_STI_DE_M1, // DE+m1
+	FORM_FICOM_STI_DE_M2, // DE+m2
+	FORM_FICOMP_STI_DE_M3, // DE+m3
+	FORM_FISUB_STI_DE_M4, // DE+m4
+	FORM_FISUBR_STI_DE_M5, // DE+m5
+	FORM_FIDIV_STI_DE_M6, // DE+m6
+	FORM_FDIVR_STI_DE_M7, // DE+m7
+	FORM_FFREEP_STI, // DF+m8
+	FORM_FISTTP_R32, // DF+m9
+	FORM_FIST_STI_DF_MA, // DF+mA
+	FORM_FISTP_STI_DF_MB, // DF+mB
+	FORM_FNSTSW_STI_DF_MC, // DF+mC
+	FORM_FUCOMIP_ST_STI, // DF+mD
+	FORM_FCOMIP_ST_STI, // DF+mE
+	FORM_FISTP_R64, // DF+mF
+	FORM_FILD_STI_DF_M0, // DF+m0
+	FORM_FISTTP_STI_DF_M1, // DF+m1
+	FORM_FIST_STI_DF_M2, // DF+m2
+	FORM_FISTP_STI_DF_M3, // DF+m3
+	FORM_FBLD_STI, // DF+m4
+	FORM_FILD_STI_DF_M5, // DF+m5
+	FORM_FBSTP_STI, // DF+m6
+	FORM_FISTP_STI_DF_M7, // DF+m7
+	FORM_LOOPNE_ECX_REL8, // E0
+	FORM_LOOPE_ECX_REL8, // E1
+	FORM_LOOP_ECX_REL8, // E2
+	FORM_JECXZ_REL8, // E3
+	FORM_IN_AL_IMM8, // E4
+	FORM_IN_EAX_IMM8, // E5
+	FORM_OUT_IMM8_AL, // E6
+	FORM_OUT_IMM8_EAX, // E7
+	FORM_CALL_REL16_32, // E8
+	FORM_JMP_REL16_32, // E9
+	FORM_JMPF_PTR16_32, // EA
+	FORM_JMP_SHORT_REL8, // EB
+	FORM_IN_AL_DX, // EC
+	FORM_IN_EAX_DX, // ED
+	FORM_OUT_DX_AL, // EE
+	FORM_OUT_DX_EAX, // EF
+	FORM_INT_1, // F1
+	FORM_HLT, // F4
+	FORM_CMC, // F5
+	FORM_TEST_RM8_IMM8_F6_M0, // F6+m0
+	FORM_TEST_RM8_IMM8_F6_M1, // F6+m1
+	FORM_NOT_RM8, // F6+m2
+	FORM_NEG_RM8, // F6+m3
+	FORM_MUL_AX_AL_RM8, // F6+m4
+	FORM_IMUL_AX_AL_RM8, // F6+m5
+	FORM_DIV_AX_AL_AX_RM8, // F6+m6
+	FORM_IDIV_AX_AL_AX_RM8, // F6+m7
+	FORM_TEST_RM16_32_IMM16_32_F7_M0, // F7+m0
+	FORM_TEST_RM16_32_IMM16_32_F7_M1, // F7+m1
+	FORM_NOT_RM16_32, // F7+m2
+	FORM_NEG_RM16_32, // F7+m3
+	FORM_MUL_EDX_EAX_RM16_32, // F7+m4
+	FORM_IMUL_EDX_EAX_RM16_32, // F7+m5
+	FORM_DIV_EDX_EAX_RM16_32, // F7+m6
+	FORM_IDIV_EDX_EAX_RM16_32, // F7+m7
+	FORM_CLC, // F8
+	FORM_STC, // F9
+	FORM_CLI, // FA
+	FORM_STI, // FB
+	FORM_CLD, // FC
+	FORM_STD, // FD
+	FORM_INC_RM8_FE_M0, // FE+m0
+	FORM_DEC_RM8_FE_M1, // FE+m1
+	FORM_INC_RM8_FE_ME, // FE+mE
+	FORM_DEC_RM8_FE_MF, // FE+mF
+	FORM_INC_RM16_32, // FF+m0
+	FORM_DEC_RM16_32, // FF+m1
+	FORM_CALL_RM16_32, // FF+m2
+	FORM_CALLF_M16_32_AND_16_32, // FF+m3
+	FORM_JMP_RM16_32, // FF+m4
+	FORM_JMPF_M16_32_AND_16_32, // FF+m5
+	FORM_PUSH_RM16_32_FF_M6, // FF+m6
+	FORM_PUSH_RM16_32_FF_M7, // FF+m7
+	FORM_MOVSXD_R16_32_RM32, // 63
+	FORM_COUNT,
+	FORM_NONE = 0xFFFF // same as DISA_NO_ROW
+};
+
+constexpr const char* disa_mnemonic_names[MN_COUNT] =
+{
+	"???",
+	"aaa",
+	"aad",
+	"aam",
+	"aas",
+	"adc",
+	"add",
+	"addpd",
+	"addps",
+	"addsd",
+	"addss",
+	"addsubpd",
+	"and",
+	"andnpd",
+	"andnps",
+	"andpd",
+	"andps",
+	"arpl",
+	"blendpd",
+	"blendps",
+	"blendvpd",
+	"blendvps",
+	"bound",
+	"bsf",
+	"bsr",
+	"bswap",
+	"bt",
+	"btc",
+	"btr",
+	"bts",
+	"call",
+	"callf",
+	"cbw",
+	"clac",
+	"clc",
+	"cld",
+	"clflush",
+	"cli",
+	"clts",
+	"cmc",
+	"cmova",
+	"cmovb",
+	"cmovbe",
+	"cmove",
+	"cmovg",
+	"cmovge",
+	"cmovl",
+	"cmovnb",
+	"cmovne",
+	"cmovng",
+	"cmovno",
+	"cmovnp",
+	"cmovns",
+	"cmovo",
+	"cmovp",
+	"cmovs",
+	"cmp",
+	"cmppd",
+	"cmpps",
+	"cmpsb",
+	"cmpsd",
+	"cmpss",
+	"cmpsw",
+	"cmpxchg",
+	"cmpxchg8b",
+	"comisd",
+	"comiss",
+	"cpuid",
+	"crc32",
+	"cvtdq2pd",
+	"cvtdq2ps",
+	"cvtpd2dq",
+	"cvtpd2pi",
+	"cvtpd2ps",
+	"cvtpi2pd",
+	"cvtpi2ps",
+	"cvtpi2sd",
+	"cvtpi2ss",
+	"cvtps2dq",
+	"cvtps2pd",
+	"cvtps2pi",
+	"cvtsd2si",
+	"cvtsd2ss",
+	"cvtss2sd",
+	"cvtss2si",
+	"cvttpd2dq",
+	"cvttpd2pi",
+	"cvttps2dq",
+	"cvttps2pi",
+	"cvttsd2si",
+	"cvttss2si",
+	"cwd",
+	"daa",
+	"das",
+	"dec",
+	"div",
+	"divpd",
+	"divps",
+	"divsd",
+	"divss",
+	"dppd",
+	"dpps",
+	"emms",
+	"enter",
+	"extractps",
+	"fadd",
+	"faddp",
+	"fbld",
+	"fbstp",
+	"fcmovb",
+	"fcmovbe",
+	"fcmove",
+	"fcmovnb",
+	"fcmovnbe",
+	"fcmovne",
+	"fcmovnu",
+	"fcmovu",
+	"fcom",
+	"fcomi",
+	"fcomip",
+	"fcomp",
+	"fdiv",
+	"fdivp",
+	"fdivr",
+	"fdivrp",
+	"ffree",
+	"ffreep",
+	"fiadd",
+	"ficom",
+	"ficomp",
+	"fidiv",
+	"fidivr",
+	"fild",
+	"fimul",
+	"finit",
+	"fist",
+	"fistp",
+	"fisttp",
+	"fisub",
+	"fisubr",
+	"fld",
+	"fldcw",
+	"fldenv",
+	"fmul",
+	"fmulp",
+	"fnsave",
+	"fnstcw",
+	"fnstenv",
+	"fnstsw",
+	"frstor",
+	"fst",
+	"fstp",
+	"fsub",
+	"fsubp",
+	"fsubr",
+	"fsubrp",
+	"fucomi",
+	"fucomip",
+	"fucomp",
+	"fwait",
+	"fxch",
+	"fxrstor",
+	"fxsave",
+	"getsec",
+	"haddpd",
+	"haddps",
+	"hint_nop",
+	"hlt",
+	"hsubpd",
+	"hsubps",
+	"idiv",
+	"imul",
+	"in",
+	"inc",
+	"insb",
+	"insd",
+	"insertps",
+	"int",
+	"int 1",
+	"int 3",
+	"into",
+	"invd",
+	"invept",
+	"invplg",
+	"invvpid",
+	"iretd",
+	"ja short",
+	"jae short",
+	"jb short",
+	"je short",
+	"jecxz",
+	"jg short",
+	"jge short",
+	"jl short",
+	"jle short",
+	"jmp",
+	"jmp short",
+	"jmpf",
+	"jna short",
+	"jne short",
+	"jno short",
+	"jnp short",
+	"jns short",
+	"jo short",
+	"jp short",
+	"js short",
+	"lahf",
+	"lar",
+	"lddqu",
+	"ldmxcsr",
+	"lds",
+	"lea",
+	"leave",
+	"les",
+	"lfence",
+	"lfs",
+	"lgdt",
+	"lgs",
+	"lidt",
+	"lldt",
+	"lmsw",
+	"lodsb",
+	"lodsw",
+	"long ja",
+	"long jb",
+	"long je",
+	"long jg",
+	"long jl",
+	"long jna",
+	"long jnb",
+	"long jne",
+	"long jng",
+	"long jnl",
+	"long jno",
+	"long jnp",
+	"long jns",
+	"long jo",
+	"long jp",
+	"long js",
+	"loop",
+	"loope",
+	"loopne",
+	"lsl",
+	"lss",
+	"ltr",
+	"maskmovdqu",
+	"maskmovq",
+	"maxpd",
+	"maxps",
+	"maxsd",
+	"maxss",
+	"mfence",
+	"minpd",
+	"minps",
+	"minsd",
+	"minss",
+	"monitor",
+	"mov",
+	"movapd",
+	"movaps",
+	"movbe",
+	"movd",
+	"movddup",
+	"movdq2q",
+	"movdqa",
+	"movdqu",
+	"movhlps",
+	"movhpd",
+	"movhps",
+	"movlhps",
+	"movlpd",
+	"movlps",
+	"movmskpd",
+	"movmskps",
+	"movntdq",
+	"movntdqa",
+	"movnti",
+	"movntpd",
+	"movntps",
+	"movntq",
+	"movq",
+	"movq2dq",
+	"movsb",
+	"movsd",
+	"movshdup",
+	"movsldup",
+	"movss",
+	"movsw",
+	"movsx",
+	"movsxd",
+	"movupd",
+	"movups",
+	"movzx",
+	"mpsadbw",
+	"mul",
+	"mulpd",
+	"mulps",
+	"mulss",
+	"mwait",
+	"neg",
+	"nop",
+	"not",
+	"or",
+	"orpd",
+	"orps",
+	"out",
+	"outsb",
+	"outsd",
+	"pabsb",
+	"pabsd",
+	"pabsw",
+	"packssdw",
+	"packsswb",
+	"packusdw",
+	"packuswb",
+	"paddb",
+	"paddd",
+	"paddq",
+	"paddsb",
+	"paddsw",
+	"paddusb",
+	"paddusw",
+	"paddw",
+	"palignr",
+	"pand",
+	"pandn",
+	"pavgb",
+	"pavgw",
+	"pblendvb",
+	"pblendw",
+	"pcmpeqb",
+	"pcmpeqd",
+	"pcmpeqq",
+	"pcmpeqw",
+	"pcmpestri",
+	"pcmpestrm",
+	"pcmpgtb",
+	"pcmpgtd",
+	"pcmpgtq",
+	"pcmpgtw",
+	"pcmpistri",
+	"pcmpistrm",
+	"pextrb",
+	"pextrd",
+	"pextrw",
+	"phaddd",
+	"phaddsw",
+	"phaddw",
+	"phminposuw",
+	"phsubd",
+	"phsubsw",
+	"phsubw",
+	"pinsrb",
+	"pinsrd",
+	"pinsrw",
+	"pmaddubsw",
+	"pmaddwd",
+	"pmaxsb",
+	"pmaxsd",
+	"pmaxsw",
+	"pmaxub",
+	"pmaxud",
+	"pmaxuw",
+	"pminsb",
+	"pminsd",
+	"pminsw",
+	"pminub",
+	"pminud",
+	"pminuw",
+	"pmovmskb",
+	"pmovsxbd",
+	"pmovsxbq",
+	"pmovsxbw",
+	"pmovsxdq",
+	"pmovzxbd",
+	"pmovzxbq",
+	"pmovzxbw",
+	"pmuldq",
+	"pmulhrsw",
+	"pmulhuw",
+	"pmulhw",
+	"pmulld",
+	"pmullw",
+	"pmuludq",
+	"pop",
+	"popad",
+	"popcnt",
+	"popfd",
+	"por",
+	"prefetchnta",
+	"prefetcht0",
+	"prefetcht1",
+	"prefetcht2",
+	"psadbw",
+	"pshufb",
+	"pshufd",
+	"pshufhw",
+	"pshuflw",
+	"pshufw",
+	"psignb",
+	"psignd",
+	"psignw",
+	"pslld",
+	"psllq",
+	"psllw",
+	"psrad",
+	"psraw",
+	"psrld",
+	"psrlq",
+	"psrlw",
+	"psubb",
+	"psubd",
+	"psubq",
+	"psubsb",
+	"psubsw",
+	"psubusb",
+	"psubusw",
+	"psubw",
+	"ptest",
+	"punpckhbw",
+	"punpckhdq",
+	"punpckhqdq",
+	"punpckhwd",
+	"punpcklbd",
+	"punpcklbq",
+	"punpcklbw",
+	"punpcklqdq",
+	"push",
+	"pushad",
+	"pushfd",
+	"pxor",
+	"rcl",
+	"rcpps",
+	"rcpss",
+	"rcr",
+	"rdmsr",
+	"rdpmc",
+	"rdtsc",
+	"ret",
+	"retf",
+	"retn",
+	"rol",
+	"ror",
+	"roundpd",
+	"roundps",
+	"roundsd",
+	"roundss",
+	"rsm",
+	"rsqrtps",
+	"rsqrtss",
+	"sahf",
+	"sal",
+	"sar",
+	"sbb",
+	"scasb",
+	"scasw",
+	"seta",
+	"setalc",
+	"setb",
+	"sete",
+	"setg",
+	"setl",
+	"setna",
+	"setnb",
+	"setne",
+	"setng",
+	"setnl",
+	"setno",
+	"setnp",
+	"setns",
+	"seto",
+	"setp",
+	"sets",
+	"sfence",
+	"sgdt",
+	"shl",
+	"shld",
+	"shr",
+	"shrd",
+	"shufpd",
+	"shufps",
+	"sidt",
+	"sldt",
+	"smsw",
+	"sqrtpd",
+	"sqrtps",
+	"sqrtsd",
+	"sqrtss",
+	"stc",
+	"std",
+	"sti",
+	"stmxcsr",
+	"stosb",
+	"stosw",
+	"str",
+	"sub",
+	"subpd",
+	"subps",
+	"subsd",
+	"subss",
+	"syscall",
+	"sysenter",
+	"sysexit",
+	"sysret",
+	"test",
+	"ucomisd",
+	"ucomiss",
+	"ud",
+	"ud2",
+	"unpckhpd",
+	"unpckhps",
+	"unpcklpd",
+	"unpcklps",
+	"verr",
+	"verw",
+	"vmcall",
+	"vmclean",
+	"vmlaunch",
+	"vmptrld",
+	"vmptrst",
+	"vmread",
+	"vmresume",
+	"vmwrite",
+	"vmxoff",
+	"vmxon",
+	"wbinvd",
+	"wrmsr",
+	"xadd",
+	"xchg",
+	"xlatb",
+	"xor",
+	"xorpd",
+	"xorps",
+	"xrstor",
+	"xsave",
+};
+
+constexpr const char* disa_form_names[FORM_COUNT] =
+{
+	"add r/m8, r8",
+	"add r/m16/32, r16/32",
+	"add r8, r/m8",
+	"add r16/32, r/m16/32",
+	"add AL, imm8",
+	"add EAX, imm16/32",
+	"push ES",
+	"pop ES",
+	"or r/m8, r8",
+	"or r/m16/32, r16/32",
+	"or r8, r/m8",
+	"or r16/32, r/m16/32",
+	"or AL, imm8",
+	"or EAX, imm16/32",
+	"push CS",
+	"sldt r/m16/32",
+	"str r/m16",
+	"lldt r/m16",
+	"ltr r/m16",
+	"verr r/m16",
+	"verw r/m16",
+	"vmcall",
+	"vmlaunch",
+	"vmresume",
+	"vmxoff",
+	"monitor",
+	"mwait",
+	"clac",
+	"sgdt r/m16/32",
+	"sidt r/m16/32",
+	"lgdt r/m16/32",
+	"lidt r/m16/32",
+	"smsw r/m16/32",
+	"smsw r/m16/32",
+	"lmsw r/m16/32",
+	"invplg r/m16/32",
+	"lar r16/32, m16",
+	"lsl r16/32, m16",
+	"ud",
+	"syscall",
+	"clts CR0",
+	"sysret",
+	"invd",
+	"wbinvd",
+	"ud2",
+	"nop r/m16/32",
+	"movups xmm, xmm/m128",
+	"movss xmm, xmm/m32",
+	"movupd xmm, xmm/m128",
+	"movsd xmm, xmm/m64",
+	"movups xmm/m128, xmm",
+	"movss xmm/m32, xmm",
+	"movupd xmm/m128, xmm",
+	"movsd xmm/m64, xmm",
+	"movhlps xmm, xmm",
+	"movlps xmm, m64",
+	"movlpd xmm, m64",
+	"movddup xmm, xmm/m64",
+	"movsldup xmm, xmm/m64",
+	"movlps m64, xmm",
+	"movlpd m64, xmm",
+	"unpcklps xmm, xmm/m64",
+	"unpcklpd xmm, xmm/m128",
+	"unpckhps xmm, xmm/m64",
+	"unpckhpd xmm, xmm/m128",
+	"movlhps xmm, xmm",
+	"movhps xmm, m64",
+	"movhpd xmm, m64",
+	"movshdup xmm, xmm/m64",
+	"movhps m64, xmm",
+	"movhpd m64, xmm",
+	"prefetchnta m8",
+	"prefetcht0 m8",
+	"prefetcht1 m8",
+	"prefetcht2 m8",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"hint_nop r/m16/32",
+	"mov r/m32, CRn",
+	"mov r/m32, DRn",
+	"mov CRn, r/m32",
+	"mov DRn, r/m32",
+	"movaps xmm, xmm/m128",
+	"movapd xmm, xmm/m128",
+	"movaps xmm/m128, xmm",
+	"movapd xmm/m128, xmm",
+	"cvtpi2ps xmm, mm/m64",
+	"cvtpi2ss xmm, r/m32",
+	"cvtpi2pd xmm, mm/m64",
+	"cvtpi2sd xmm, r/m32",
+	"movntps m128, xmm",
+	"movntpd m128, xmm",
+	"cvttps2pi mm, xmm/m64",
+	"cvttss2si r32, xmm/m32",
+	"cvttpd2pi mm, xmm/m128",
+	"cvttsd2si r32, xmm/m64",
+	"cvtps2pi mm, xmm/m64",
+	"cvtss2si r32, xmm/m32",
+	"cvtpd2pi mm, xmm/m128",
+	"cvtsd2si r32, xmm/m64",
+	"ucomiss xmm, xmm/m32",
+	"ucomisd xmm, xmm/m64",
+	"comiss xmm, xmm/m32",
+	"comisd xmm, xmm/m64",
+	"wrmsr",
+	"rdtsc",
+	"rdmsr",
+	"rdpmc",
+	"sysenter",
+	"sysexit",
+	"getsec",
+	"pshufb mm, mm/m64",
+	"pshufb xmm, xmm/m128",
+	"phaddw mm, mm/m64",
+	"phaddw xmm, xmm/m128",
+	"phaddd mm, mm/m64",
+	"phaddd xmm, xmm/m128",
+	"phaddsw mm, mm/m64",
+	"phaddsw xmm, xmm/m128",
+	"pmaddubsw mm, mm/m64",
+	"pmaddubsw xmm, xmm/m128",
+	"phsubw mm, mm/m64",
+	"phsubw xmm, xmm/m128",
+	"phsubd mm, mm/m64",
+	"phsubd xmm, xmm/m128",
+	"phsubsw mm, mm/m64",
+	"phsubsw xmm, xmm/m128",
+	"psignb mm, mm/m64",
+	"psignb xmm, xmm/m128",
+	"psignw mm, mm/m64",
+	"psignw xmm, xmm/m128",
+	"psignd mm, mm/m64",
+	"psignd xmm, xmm/m128",
+	"pmulhrsw mm, mm/m64",
+	"pmulhrsw xmm, xmm/m128",
+	"pblendvb xmm, xmm/m128, xmm0",
+	"blendvps xmm, xmm/m128, xmm0",
+	"blendvpd xmm, xmm/m128, xmm0",
+	"ptest xmm, xmm/m128",
+	"pabsb mm, mm/m64",
+	"pabsb xmm, xmm/m128",
+	"pabsw mm, mm/m64",
+	"pabsw xmm, xmm/m128",
+	"pabsd mm, mm/m64",
+	"pabsd xmm, xmm/m128",
+	"pmovsxbw xmm, m64",
+	"pmovsxbd xmm, m32",
+	"pmovsxbq xmm, m16",
+	"pmovsxbd xmm, m64",
+	"pmovsxbq xmm, m32",
+	"pmovsxdq xmm, m64",
+	"pmuldq xmm, xmm/m128",
+	"pcmpeqq xmm, xmm/m128",
+	"movntdqa xmm, m128",
+	"packusdw xmm, xmm/m128",
+	"pmovzxbw xmm, m64",
+	"pmovzxbd xmm, m32",
+	"pmovzxbq xmm, m16",
+	"pmovzxbd xmm, m64",
+	"pmovzxbq xmm, m32",
+	"pmovzxbq xmm, m64",
+	"pcmpgtq xmm, xmm/m128",
+	"pminsb xmm, xmm/m128",
+	"pminsd xmm, xmm/m128",
+	"pminuw xmm, xmm/m128",
+	"pminud xmm, xmm/m128",
+	"pmaxsb xmm, xmm/m128",
+	"pmaxsd xmm, xmm/m128",
+	"pmaxuw xmm, xmm/m128",
+	"pmaxud xmm, xmm/m128",
+	"pmulld xmm, xmm/m128",
+	"phminposuw xmm, xmm/m128",
+	"invept r32, m128",
+	"invvpid r32, m128",
+	"movbe r16/32, m16/32",
+	"crc32 r32, r/m8",
+	"movbe m16/32, r16/32",
+	"crc32 r32, r/m16/32",
+	"roundps xmm, xmm/m128, imm8",
+	"roundpd xmm, xmm/m128, imm8",
+	"roundss xmm, xmm/m32, imm8",
+	"roundsd xmm, xmm/m64, imm8",
+	"blendps xmm, xmm/m128, imm8",
+	"blendpd xmm, xmm/m128, imm8",
+	"pblendw xmm, xmm/m128, imm8",
+	"palignr mm, mm/m64",
+	"palignr mm, xmm/m128",
+	"pextrb m8, xmm, imm8",
+	"pextrw m16, xmm, imm8",
+	"pextrd m32, xmm, imm8",
+	"extractps m64, xmm, imm8",
+	"pinsrb xmm, m8, imm8",
+	"insertps xmm, m32, imm8",
+	"pinsrd xmm, m64, imm8",
+	"dpps xmm, xmm/m128",
+	"dppd xmm, xmm/m128",
+	"mpsadbw xmm, xmm/m128, imm8",
+	"pcmpestrm xmm0, xmm, xmm/m128",
+	"pcmpestri ECX, xmm, xmm/m128",
+	"pcmpistrm xmm0, xmm, xmm/m128, imm8",
+	"pcmpistri ECX, xmm, xmm/m128, imm8",
+	"cmovo r16/32, r/m16/32",
+	"cmovno r16/32, r/m16/32",
+	"cmovb r16/32, r/m16/32",
+	"cmovnb r16/32, r/m16/32",
+	"cmove r16/32, r/m16/32",
+	"cmovne r16/32, r/m16/32",
+	"cmovbe r16/32, r/m16/32",
+	"cmova r16/32, r/m16/32",
+	"cmovs r16/32, r/m16/32",
+	"cmovns r16/32, r/m16/32",
+	"cmovp r16/32, r/m16/32",
+	"cmovnp r16/32, r/m16/32",
+	"cmovl r16/32, r/m16/32",
+	"cmovge r16/32, r/m16/32",
+	"cmovng r16/32, r/m16/32",
+	"cmovg r16/32, r/m16/32",
+	"movmskps r32, xmm",
+	"movmskpd r32, xmm",
+	"movmskpd r32, xmm",
+	"sqrtps xmm, xmm/m128",
+	"sqrtss xmm, xmm/m32",
+	"sqrtpd xmm, xmm/m128",
+	"sqrtsd xmm, xmm/m64",
+	"rsqrtps xmm, xmm/m128",
+	"rsqrtss xmm, xmm/m32",
+	"rcpps xmm, xmm/m128",
+	"rcpss xmm, xmm/m32",
+	"andps xmm, xmm/m128",
+	"andpd xmm, xmm/m128",
+	"andnps xmm, xmm/m128",
+	"andnpd xmm, xmm/m128",
+	"orps xmm, xmm/m128",
+	"orpd xmm, xmm/m128",
+	"xorps xmm, xmm/m128",
+	"xorpd xmm, xmm/m128",
+	"addps xmm, xmm/m128",
+	"addss xmm, xmm/m32",
+	"addpd xmm, xmm/m128",
+	"addsd xmm, xmm/m64",
+	"mulps xmm, xmm/m128",
+	"mulss xmm, xmm/m32",
+	"mulpd xmm, xmm/m128",
+	"addsd xmm, xmm/m64",
+	"cvtps2pd xmm, xmm/m128",
+	"cvtpd2ps xmm, xmm/m128",
+	"cvtss2sd xmm, xmm/m32",
+	"cvtsd2ss xmm, xmm/m64",
+	"cvtdq2ps xmm, xmm/m128",
+	"cvtps2dq xmm, xmm/m128",
+	"cvttps2dq xmm, xmm/m128",
+	"subps xmm, xmm/m128",
+	"subss xmm, xmm/m32",
+	"subpd xmm, xmm/m128",
+	"subsd xmm, xmm/m64",
+	"minps xmm, xmm/m128",
+	"minss xmm, xmm/m32",
+	"minpd xmm, xmm/m128",
+	"minsd xmm, xmm/m64",
+	"divps xmm, xmm/m128",
+	"divss xmm, xmm/m32",
+	"divpd xmm, xmm/m128",
+	"divsd xmm, xmm/m64",
+	"maxps xmm, xmm/m128",
+	"maxss xmm, xmm/m32",
+	"maxpd xmm, xmm/m128",
+	"maxsd xmm, xmm/m64",
+	"punpcklbw mm, mm/m64",
+	"punpcklbw xmm, xmm/m128",
+	"punpcklbd mm, mm/m64",
+	"punpcklbd xmm, xmm/m128",
+	"punpcklbq mm, mm/m64",
+	"punpcklbq xmm, xmm/m128",
+	"packsswb mm, mm/m64",
+	"packsswb xmm, xmm/m128",
+	"pcmpgtb mm, mm/m64",
+	"pcmpgtb xmm, xmm/m128",
+	"pcmpgtw mm, mm/m64",
+	"pcmpgtw xmm, xmm/m128",
+	"pcmpgtd mm, mm/m64",
+	"pcmpgtd xmm, xmm/m128",
+	"packuswb mm, mm/m64",
+	"packuswb xmm, xmm/m128",
+	"punpckhbw mm, mm/m64",
+	"punpckhbw xmm, xmm/m128",
+	"punpckhwd mm, mm/m64",
+	"punpckhwd xmm, xmm/m128",
+	"punpckhdq mm, mm/m64",
+	"punpckhdq xmm, xmm/m128",
+	"packssdw mm, mm/m64",
+	"packssdw xmm, xmm/m128",
+	"punpcklqdq xmm, xmm/m128",
+	"punpckhqdq xmm, xmm/m128",
+	"movd xmm, r/m32",
+	"movd xmm, r/m32",
+	"movq xmm, mm/m64",
+	"movdqa xmm, xmm/m128",
+	"movdqu xmm, xmm/m128",
+	"pshufw mm/m64, imm8",
+	"pshuflw xmm/m128, imm8",
+	"pshufhw xmm/m128, imm8",
+	"pshufd xmm/m128, imm8",
+	"psrlw mm, imm8",
+	"psrlw xmm, imm8",
+	"psraw mm, imm8",
+	"psraw xmm, imm8",
+	"psllw mm, imm8",
+	"psllw xmm, imm8",
+	"psrld mm, imm8",
+	"psrld xmm, imm8",
+	"psrad mm, imm8",
+	"psrad xmm, imm8",
+	"pslld mm, imm8",
+	"pslld xmm, imm8",
+	"psrld mm, imm8",
+	"psrld xmm, imm8",
+	"psrad mm, imm8",
+	"psrad xmm, imm8",
+	"pslld mm, imm8",
+	"pslld xmm, imm8",
+	"pcmpeqb mm, mm/m64",
+	"pcmpeqb xmm, xmm/m128",
+	"pcmpeqw mm, mm/m64",
+	"pcmpeqw xmm, xmm/m128",
+	"pcmpeqd mm, mm/m64",
+	"pcmpeqd xmm, xmm/m128",
+	"emms",
+	"vmread",
+	"vmwrite",
+	"haddpd xmm, xmm/m128",
+	"haddps xmm, xmm/m128",
+	"hsubpd xmm, xmm/m128",
+	"hsubps xmm, xmm/m128",
+	"movd r/m32, mm",
+	"movd r/m32, xmm",
+	"movq xmm, xmm/m64",
+	"movq xmm/m64, mm",
+	"movdqa xmm/m128, xmm",
+	"movdqu xmm/m128, xmm",
+	"long jo rel16/32",
+	"long jno rel16/32",
+	"long jb rel16/32",
+	"long jnb rel16/32",
+	"long je rel16/32",
+	"long jne rel16/32",
+	"long jna rel16/32",
+	"long ja rel16/32",
+	"long js rel16/32",
+	"long jns rel16/32",
+	"long jp rel16/32",
+	"long jnp rel16/32",
+	"long jl rel16/32",
+	"long jnl rel16/32",
+	"long jng rel16/32",
+	"long jg rel16/32",
+	"seto r/m8",
+	"setno r/m8",
+	"setb r/m8",
+	"setnb r/m8",
+	"sete r/m8",
+	"setne r/m8",
+	"setna r/m8",
+	"seta r/m8",
+	"sets r/m8",
+	"setns r/m8",
+	"setp r/m8",
+	"setnp r/m8",
+	"setl r/m8",
+	"setnl r/m8",
+	"setng r/m8",
+	"setg r/m8",
+	"push FS",
+	"pop FS",
+	"cpuid IA32_BIOS",
+	"bt r/m16/32, r16/32",
+	"shld r/m16/32, r16/32, imm8",
+	"shld r/m16/32, r16/32, CL",
+	"push GS",
+	"pop GS",
+	"rsm",
+	"bts r/m16/32, r16/32",
+	"shrd r/m16/32, r16/32, imm8",
+	"shrd r/m16/32, r16/32, CL",
+	"fxsave m512, ST, ST1",
+	"fxrstor ST, ST1, ST2",
+	"ldmxcsr m32",
+	"stmxcsr m32",
+	"xsave m, EDX, EAX",
+	"lfence",
+	"xrstor ST, ST1, ST2",
+	"mfence",
+	"sfence",
+	"clflush m8",
+	"imul r16/32, r/m16/32",
+	"cmpxchg r/m8, AL, r8",
+	"cmpxchg r/m16/32, EAX, r16/32",
+	"lss SS, r16/32, m16/32&16/32",
+	"btr r/m16/32, r16/32",
+	"lfs FS, r/m16/32, m16/32&16/32",
+	"lgs GS, r/m16/32, m16/32&16/32",
+	"movzx r16/32, r/m8",
+	"movzx r16/32, r/m16",
+	"popcnt r16/32, r/m16/32",
+	"ud",
+	"bt r/m16/32, imm8",
+	"bts r/m16/32, imm8",
+	"btr r/m16/32, imm8",
+	"btc r/m16/32, imm8",
+	"btc r/m16/32, r16/32",
+	"bsf r16/32, r/m16/32",
+	"bsr r16/32, r/m16/32",
+	"movsx r16/32, r/m8",
+	"movsx r16/32, r/m16",
+	"xadd r/m8, r8",
+	"xadd r/m16/32, r16/32",
+	"cmpps xmm, xmm/m128, imm8",
+	"cmpss xmm, xmm/m32, imm8",
+	"cmppd xmm, xmm/m128, imm8",
+	"cmpsd xmm, xmm/m64, imm8",
+	"movnti m32, r32",
+	"pinsrw mm, m16, imm8",
+	"pinsrw xmm, m16, imm8",
+	"pextrw r32, mm, imm8",
+	"pextrw r32, xmm, imm8",
+	"shufps xmm, xmm/m128, imm8",
+	"shufpd xmm, xmm/m128, imm8",
+	"cmpxchg8b m64, EAX, EDX",
+	"vmptrld m64",
+	"vmclean m64",
+	"vmxon m64",
+	"vmptrst m64",
+	"bswap r16/32",
+	"addsubpd xmm, xmm/m128",
+	"addsubpd xmm, xmm/m128",
+	"psrlw mm, mm/m64",
+	"psrlw xmm, xmm/m128",
+	"psrld mm, mm/m64",
+	"psrld xmm, xmm/m128",
+	"psrlq mm, mm/m64",
+	"psrlq xmm, xmm/m128",
+	"paddq mm, mm/m64",
+	"paddq xmm, xmm/m128",
+	"pmullw mm, mm/m64",
+	"pmullw xmm, xmm/m128",
+	"movq xmm/m64, xmm",
+	"movq2dq xmm, mm",
+	"movdq2q mm, xmm",
+	"pmovmskb r32, mm",
+	"pmovmskb r32, xmm",
+	"psubusb mm, mm/m64",
+	"psubusb xmm, xmm/m128",
+	"psubusw mm, mm/m64",
+	"psubusw xmm, xmm/m128",
+	"pminub mm, mm/m64",
+	"pminub xmm, xmm/m128",
+	"pand mm, mm/m64",
+	"pand xmm, xmm/m128",
+	"paddusb mm, mm/m64",
+	"paddusb xmm, xmm/m128",
+	"paddusw mm, mm/m64",
+	"paddusw xmm, xmm/m128",
+	"pmaxub mm, mm/m64",
+	"pmaxub xmm, xmm/m128",
+	"pandn mm, mm/m64",
+	"pandn xmm, xmm/m128",
+	"pavgb mm, mm/m64",
+	"pavgb xmm, xmm/m128",
+	"psraw mm, mm/m64",
+	"psraw xmm, xmm/m128",
+	"psrad mm, mm/m64",
+	"psrad xmm, xmm/m128",
+	"pavgw mm, mm/m64",
+	"pavgw xmm, xmm/m128",
+	"pmulhuw mm, mm/m64",
+	"pmulhuw xmm, xmm/m128",
+	"pmulhw mm, mm/m64",
+	"pmulhw xmm, xmm/m128",
+	"cvtpd2dq xmm, xmm/m128",
+	"cvttpd2dq xmm, xmm/m128",
+	"cvtdq2pd xmm, xmm/m128",
+	"movntq m64, mm",
+	"movntdq m128, xmm",
+	"psubsb mm, mm/m64",
+	"psubsb xmm, xmm/m128",
+	"psubsw mm, mm/m64",
+	"psubsw xmm, xmm/m128",
+	"pminsw mm, mm/m64",
+	"pminsw xmm, xmm/m128",
+	"por mm, mm/m64",
+	"por xmm, xmm/m128",
+	"paddsb mm, mm/m64",
+	"paddsb xmm, xmm/m128",
+	"paddsw mm, mm/m64",
+	"paddsw xmm, xmm/m128",
+	"pmaxsw mm, mm/m64",
+	"pmaxsw xmm, xmm/m128",
+	"pxor mm, mm/m64",
+	"pxor xmm, xmm/m128",
+	"lddqu xmm, m128",
+	"psllw mm, mm/m64",
+	"psllw xmm, xmm/m128",
+	"pslld mm, mm/m64",
+	"pslld xmm, xmm/m128",
+	"psllq mm, mm/m64",
+	"psllq xmm, xmm/m128",
+	"pmuludq mm, mm/m64",
+	"pmuludq xmm, xmm/m128",
+	"pmaddwd mm, mm/m64",
+	"pmaddwd xmm, xmm/m128",
+	"psadbw mm, mm/m64",
+	"psadbw xmm, xmm/m128",
+	"maskmovq m64, mm, mm",
+	"maskmovdqu m128, xmm, xmm",
+	"psubb mm, mm/m64",
+	"psubb xmm, xmm/m128",
+	"psubw mm, mm/m64",
+	"psubw xmm, xmm/m128",
+	"psubd mm, mm/m64",
+	"psubd xmm, xmm/m128",
+	"psubq mm, mm/m64",
+	"psubq xmm, xmm/m128",
+	"paddb mm, mm/m64",
+	"paddb xmm, xmm/m128",
+	"paddw mm, mm/m64",
+	"paddw xmm, xmm/m128",
+	"paddd mm, mm/m64",
+	"paddd xmm, xmm/m128",
+	"adc r/m8, r8",
+	"adc r/m16/32, r16/32",
+	"adc r8, r/m8",
+	"adc r16/32, r/m16/32",
+	"adc AL, imm8",
+	"adc EAX, imm16/32",
+	"push SS",
+	"pop SS",
+	"sbb r/m8, r8",
+	"sbb r/m16/32, r16/32",
+	"sbb r8, r/m8",
+	"sbb r16/32, r/m16/32",
+	"sbb AL, imm8",
+	"sbb EAX, imm16/32",
+	"push DS",
+	"pop DS",
+	"and r/m8, r8",
+	"and r/m16/32, r16/32",
+	"and r8, r/m8",
+	"and r16/32, r/m16/32",
+	"and AL, imm8",
+	"and EAX, imm16/32",
+	"daa AL",
+	"sub r/m8, r8",
+	"sub r/m16/32, r16/32",
+	"sub r8, r/m8",
+	"sub r16/32, r/m16/32",
+	"sub AL, imm8",
+	"sub EAX, imm16/32",
+	"das AL",
+	"xor r/m8, r8",
+	"xor r/m16/32, r16/32",
+	"xor r8, r/m8",
+	"xor r16/32, r/m16/32",
+	"xor AL, imm8",
+	"xor EAX, imm16/32",
+	"aaa AL, AH",
+	"cmp r/m8, r8",
+	"cmp r/m16/32, r16/32",
+	"cmp r8, r/m8",
+	"cmp r16/32, r/m16/32",
+	"cmp AL, imm8",
+	"cmp EAX, imm16/32",
+	"aas AL, AH",
+	"inc r16/32",
+	"dec r16/32",
+	"push r16/32",
+	"pop r16/32",
+	"pushad",
+	"popad",
+	"bound r16/32, m16/32&16/32",
+	"arpl r/m16, r16",
+	"arpl r/m16, r16",
+	"push imm16/32",
+	"imul r16/32, r/m16/32, imm16/32",
+	"push imm8",
+	"imul r16/32, r/m16/32, imm8",
+	"insb",
+	"insd",
+	"outsb",
+	"outsd",
+	"jo short rel8",
+	"jno short rel8",
+	"jb short rel8",
+	"jae short rel8",
+	"je short rel8",
+	"jne short rel8",
+	"jna short rel8",
+	"ja short rel8",
+	"js short rel8",
+	"jns short rel8",
+	"jp short rel8",
+	"jnp short rel8",
+	"jl short rel8",
+	"jge short rel8",
+	"jle short rel8",
+	"jg short rel8",
+	"add r/m8, imm8",
+	"or r/m8, imm8",
+	"adc r/m8, imm8",
+	"sbb r/m8, imm8",
+	"and r/m8, imm8",
+	"sub r/m8, imm8",
+	"xor r/m8, imm8",
+	"cmp r/m8, imm8",
+	"add r/m16/32, imm16/32",
+	"or r/m16/32, imm16/32",
+	"adc r/m16/32, imm16/32",
+	"sbb r/m16/32, imm16/32",
+	"and r/m16/32, imm16/32",
+	"sub r/m16/32, imm16/32",
+	"xor r/m16/32, imm16/32",
+	"cmp r/m16/32, imm16/32",
+	"add r/m8, imm8",
+	"or r/m8, imm8",
+	"adc r/m8, imm8",
+	"sbb r/m8, imm8",
+	"and r/m8, imm8",
+	"sub r/m8, imm8",
+	"xor r/m8, imm8",
+	"cmp r/m8, imm8",
+	"add r/m16/32, imm8",
+	"or r/m16/32, imm8",
+	"adc r/m16/32, imm8",
+	"sbb r/m16/32, imm8",
+	"and r/m16/32, imm8",
+	"sub r/m16/32, imm8",
+	"xor r/m16/32, imm8",
+	"cmp r/m16/32, imm8",
+	"test r/m8, r8",
+	"test r/m16/32, r16/32",
+	"xchg r/m8, r8",
+	"xchg r/m16/32, r16/32",
+	"mov r/m8, r8",
+	"mov r/m16/32, r16/32",
+	"mov r8, r/m8",
+	"mov r16/32, r/m16/32",
+	"mov m16, Sreg",
+	"lea r16/32, m32",
+	"mov Sreg, r/m16",
+	"pop r/m16/32",
+	"nop",
+	"xchg EAX, r16/32",
+	"cbw AX, AL",
+	"cwd AX, AL",
+	"callf ptr16/32",
+	"fwait",
+	"pushfd",
+	"popfd",
+	"sahf AH",
+	"lahf AH",
+	"mov AL, moffs8",
+	"mov EAX, moffs16/32",
+	"mov moffs8, AL",
+	"mov moffs16/32, EAX",
+	"movsb",
+	"movsw",
+	"cmpsb",
+	"cmpsw",
+	"test AL, imm8",
+	"test EAX, imm16/32",
+	"stosb",
+	"stosw",
+	"lodsb",
+	"lodsw",
+	"scasb",
+	"scasw",
+	"mov r8, imm8",
+	"mov r16/32, imm16/32",
+	"rol r/m8, imm8",
+	"ror r/m8, imm8",
+	"rcl r/m8, imm8",
+	"rcr r/m8, imm8",
+	"shl r/m8, imm8",
+	"shr r/m8, imm8",
+	"sal r/m8, imm8",
+	"sar r/m8, imm8",
+	"rol r/m16/32, imm8",
+	"ror r/m16/32, imm8",
+	"rcl r/m16/32, imm8",
+	"rcr r/m16/32, imm8",
+	"shl r/m16/32, imm8",
+	"shr r/m16/32, imm8",
+	"sal r/m16/32, imm8",
+	"sar r/m16/32, imm8",
+	"ret imm16",
+	"retn",
+	"les ES, r16/32, m16/32&16/32",
+	"lds DS, r16/32, m16/32&16/32",
+	"mov r/m8, imm8",
+	"mov r/m16/32, imm16/32",
+	"mov r/m16/32, imm16",
+	"enter EBP, imm16, imm8",
+	"leave EBP",
+	"retf imm16",
+	"retf",
+	"int 3",
+	"int imm8",
+	"into",
+	"iretd",
+	"rol r/m8, one",
+	"ror r/m8, one",
+	"rcl r/m8, one",
+	"rcr r/m8, one",
+	"shl r/m8, one",
+	"shr r/m8, one",
+	"shl r/m8, one",
+	"shr r/m8, one",
+	"rol r/m16/32, one",
+	"ror r/m16/32, one",
+	"rcl r/m16/32, one",
+	"rcr r/m16/32, one",
+	"shl r/m16/32, one",
+	"shr r/m16/32, one",
+	"shl r/m16/32, one",
+	"shr r/m16/32, one",
+	"rol r/m8, CL",
+	"ror r/m8, CL",
+	"rcl r/m8, CL",
+	"rcr r/m8, CL",
+	"shl r/m8, CL",
+	"shr r/m8, CL",
+	"shl r/m8, CL",
+	"shr r/m8, CL",
+	"rol r/m16/32, CL",
+	"ror r/m16/32, CL",
+	"rcl r/m16/32, CL",
+	"rcr r/m16/32, CL",
+	"shl r/m16/32, CL",
+	"shr r/m16/32, CL",
+	"shl r/m16/32, CL",
+	"shr r/m16/32, CL",
+	"aam AL, AH, imm8",
+	"aad AL, AH, imm8",
+	"setalc AL",
+	"xlatb AL",
+	"fadd ST, STi",
+	"fmul ST, STi",
+	"fcom ST, STi",
+	"fcomp ST, STi",
+	"fsub ST, STi",
+	"fsubr ST, STi",
+	"fdiv ST, STi",
+	"fdivr ST, STi",
+	"fadd STi",
+	"fmul STi",
+	"fcom STi",
+	"fcomp STi",
+	"fsub STi",
+	"fsubr STi",
+	"fdiv STi",
+	"fdivr STi",
+	"fld STi",
+	"fxch STi",
+	"fst STi",
+	"fstp STi",
+	"fldenv STi",
+	"fldcw STi",
+	"fnstenv STi",
+	"fnstcw STi",
+	"fcmovb ST, STi",
+	"fcmove ST, STi",
+	"fcmovbe ST, STi",
+	"fcmovu ST, STi",
+	"fisub ST, STi",
+	"fisubr ST, STi",
+	"fidiv ST, STi",
+	"fidivr ST, STi",
+	"fiadd STi",
+	"fimul STi",
+	"ficom STi",
+	"ficomp STi",
+	"fisub STi",
+	"fisubr STi",
+	"fidiv STi",
+	"fidivr STi",
+	"fcmovnb ST, STi",
+	"fcmovne ST, STi",
+	"fcmovnbe ST, STi",
+	"fcmovnu ST, STi",
+	"fild STi",
+	"fisttp STi",
+	"fist STi",
+	"fistp STi",
+	"finit STi",
+	"fucomi STi",
+	"fcomi STi",
+	"fstp STi",
+	"fadd STi, ST",
+	"fmul STi, ST",
+	"fcom STi, ST",
+	"fcomp STi, ST",
+	"fsub STi, ST",
+	"fsubr STi, ST",
+	"fdiv STi, ST",
+	"fdivr STi, ST",
+	"fadd STi",
+	"fmul STi",
+	"fcom STi",
+	"fcomp STi",
+	"fsub STi",
+	"fsubr STi",
+	"fdiv STi",
+	"fdivr STi",
+	"ffree STi",
+	"fld STi",
+	"fisttp STi",
+	"fst STi",
+	"fstp STi",
+	"frstor STi",
+	"fucomp STi",
+	"fnsave STi",
+	"fnstsw STi",
+	"faddp ST, STi",
+	"fmulp ST, STi",
+	"ficom ST, STi",
+	"ficomp ST, STi",
+	"fsubrp ST, STi",
+	"fsubp ST, STi",
+	"fdivrp ST, STi",
+	"fdivp ST, STi",
+	"fiadd STi",
+	"fimul STi",
+	"ficom STi",
+	"ficomp STi",
+	"fisub STi",
+	"fisubr STi",
+	"fidiv STi",
+	"fdivr STi",
+	"ffreep STi",
+	"fisttp r32",
+	"fist STi",
+	"fistp STi",
+	"fnstsw STi",
+	"fucomip ST, STi",
+	"fcomip ST, STi",
+	"fistp r64",
+	"fild STi",
+	"fisttp STi",
+	"fist STi",
+	"fistp STi",
+	"fbld STi",
+	"fild STi",
+	"fbstp STi",
+	"fistp STi",
+	"loopne ECX, rel8",
+	"loope ECX, rel8",
+	"loop ECX, rel8",
+	"jecxz rel8",
+	"in AL, imm8",
+	"in EAX, imm8",
+	"out imm8, AL",
+	"out imm8, EAX",
+	"call rel16/32",
+	"jmp rel16/32",
+	"jmpf ptr16/32",
+	"jmp short rel8",
+	"in AL, DX",
+	"in EAX, DX",
+	"out DX, AL",
+	"out DX, EAX",
+	"int 1",
+	"hlt",
+	"cmc",
+	"test r/m8, imm8",
+	"test r/m8, imm8",
+	"not r/m8",
+	"neg r/m8",
+	"mul AX, AL, r/m8",
+	"imul AX, AL, r/m8",
+	"div AX, AL, AX, r/m8",
+	"idiv AX, AL, AX, r/m8",
+	"test r/m16/32, imm16/32",
+	"test r/m16/32, imm16/32",
+	"not r/m16/32",
+	"neg r/m16/32",
+	"mul EDX, EAX, r/m16/32",
+	"imul EDX, EAX, r/m16/32",
+	"div EDX, EAX, r/m16/32",
+	"idiv EDX, EAX, r/m16/32",
+	"clc",
+	"stc",
+	"cli",
+	"sti",
+	"cld",
+	"std",
+	"inc r/m8",
+	"dec r/m8",
+	"inc r/m8",
+	"dec r/m8",
+	"inc r/m16/32",
+	"dec r/m16/32",
+	"call r/m16/32",
+	"callf m16/32&16/32",
+	"jmp r/m16/32",
+	"jmpf m16/32&16/32",
+	"push r/m16/32",
+	"push r/m16/32",
+	"movsxd r16/32, r/m32",
+};
+
+constexpr disa_mnemonic disa_form_mnemonics[FORM_COUNT] =
+{
+	MN_ADD,
+	MN_ADD,
+	MN_ADD,
+	MN_ADD,
+	MN_ADD,
+	MN_ADD,
+	MN_PUSH,
+	MN_POP,
+	MN_OR,
+	MN_OR,
+	MN_OR,
+	MN_OR,
+	MN_OR,
+	MN_OR,
+	MN_PUSH,
+	MN_SLDT,
+	MN_STR,
+	MN_LLDT,
+	MN_LTR,
+	MN_VERR,
+	MN_VERW,
+	MN_VMCALL,
+	MN_VMLAUNCH,
+	MN_VMRESUME,
+	MN_VMXOFF,
+	MN_MONITOR,
+	MN_MWAIT,
+	MN_CLAC,
+	MN_SGDT,
+	MN_SIDT,
+	MN_LGDT,
+	MN_LIDT,
+	MN_SMSW,
+	MN_SMSW,
+	MN_LMSW,
+	MN_INVPLG,
+	MN_LAR,
+	MN_LSL,
+	MN_UD,
+	MN_SYSCALL,
+	MN_CLTS,
+	MN_SYSRET,
+	MN_INVD,
+	MN_WBINVD,
+	MN_UD2,
+	MN_NOP,
+	MN_MOVUPS,
+	MN_MOVSS,
+	MN_MOVUPD,
+	MN_MOVSD,
+	MN_MOVUPS,
+	MN_MOVSS,
+	MN_MOVUPD,
+	MN_MOVSD,
+	MN_MOVHLPS,
+	MN_MOVLPS,
+	MN_MOVLPD,
+	MN_MOVDDUP,
+	MN_MOVSLDUP,
+	MN_MOVLPS,
+	MN_MOVLPD,
+	MN_UNPCKLPS,
+	MN_UNPCKLPD,
+	MN_UNPCKHPS,
+	MN_UNPCKHPD,
+	MN_MOVLHPS,
+	MN_MOVHPS,
+	MN_MOVHPD,
+	MN_MOVSHDUP,
+	MN_MOVHPS,
+	MN_MOVHPD,
+	MN_PREFETCHNTA,
+	MN_PREFETCHT0,
+	MN_PREFETCHT1,
+	MN_PREFETCHT2,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_HINT_NOP,
+	MN_MOV,
+	MN_MOV,
+	MN_MOV,
+	MN_MOV,
+	MN_MOVAPS,
+	MN_MOVAPD,
+	MN_MOVAPS,
+	MN_MOVAPD,
+	MN_CVTPI2PS,
+	MN_CVTPI2SS,
+	MN_CVTPI2PD,
+	MN_CVTPI2SD,
+	MN_MOVNTPS,
+	MN_MOVNTPD,
+	MN_CVTTPS2PI,
+	MN_CVTTSS2SI,
+	MN_CVTTPD2PI,
+	MN_CVTTSD2SI,
+	MN_CVTPS2PI,
+	MN_CVTSS2SI,
+	MN_CVTPD2PI,
+	MN_CVTSD2SI,
+	MN_UCOMISS,
+	MN_UCOMISD,
+	MN_COMISS,
+	MN_COMISD,
+	MN_WRMSR,
+	MN_RDTSC,
+	MN_RDMSR,
+	MN_RDPMC,
+	MN_SYSENTER,
+	MN_SYSEXIT,
+	MN_GETSEC,
+	MN_PSHUFB,
+	MN_PSHUFB,
+	MN_PHADDW,
+	MN_PHADDW,
+	MN_PHADDD,
+	MN_PHADDD,
+	MN_PHADDSW,
+	MN_PHADDSW,
+	MN_PMADDUBSW,
+	MN_PMADDUBSW,
+	MN_PHSUBW,
+	MN_PHSUBW,
+	MN_PHSUBD,
+	MN_PHSUBD,
+	MN_PHSUBSW,
+	MN_PHSUBSW,
+	MN_PSIGNB,
+	MN_PSIGNB,
+	MN_PSIGNW,
+	MN_PSIGNW,
+	MN_PSIGND,
+	MN_PSIGND,
+	MN_PMULHRSW,
+	MN_PMULHRSW,
+	MN_PBLENDVB,
+	MN_BLENDVPS,
+	MN_BLENDVPD,
+	MN_PTEST,
+	MN_PABSB,
+	MN_PABSB,
+	MN_PABSW,
+	MN_PABSW,
+	MN_PABSD,
+	MN_PABSD,
+	MN_PMOVSXBW,
+	MN_PMOVSXBD,
+	MN_PMOVSXBQ,
+	MN_PMOVSXBD,
+	MN_PMOVSXBQ,
+	MN_PMOVSXDQ,
+	MN_PMULDQ,
+	MN_PCMPEQQ,
+	MN_MOVNTDQA,
+	MN_PACKUSDW,
+	MN_PMOVZXBW,
+	MN_PMOVZXBD,
+	MN_PMOVZXBQ,
+	MN_PMOVZXBD,
+	MN_PMOVZXBQ,
+	MN_PMOVZXBQ,
+	MN_PCMPGTQ,
+	MN_PMINSB,
+	MN_PMINSD,
+	MN_PMINUW,
+	MN_PMINUD,
+	MN_PMAXSB,
+	MN_PMAXSD,
+	MN_PMAXUW,
+	MN_PMAXUD,
+	MN_PMULLD,
+	MN_PHMINPOSUW,
+	MN_INVEPT,
+	MN_INVVPID,
+	MN_MOVBE,
+	MN_CRC32,
+	MN_MOVBE,
+	MN_CRC32,
+	MN_ROUNDPS,
+	MN_ROUNDPD,
+	MN_ROUNDSS,
+	MN_ROUNDSD,
+	MN_BLENDPS,
+	MN_BLENDPD,
+	MN_PBLENDW,
+	MN_PALIGNR,
+	MN_PALIGNR,
+	MN_PEXTRB,
+	MN_PEXTRW,
+	MN_PEXTRD,
+	MN_EXTRACTPS,
+	MN_PINSRB,
+	MN_INSERTPS,
+	MN_PINSRD,
+	MN_DPPS,
+	MN_DPPD,
+	MN_MPSADBW,
+	MN_PCMPESTRM,
+	MN_PCMPESTRI,
+	MN_PCMPISTRM,
+	MN_PCMPISTRI,
+	MN_CMOVO,
+	MN_CMOVNO,
+	MN_CMOVB,
+	MN_CMOVNB,
+	MN_CMOVE,
+	MN_CMOVNE,
+	MN_CMOVBE,
+	MN_CMOVA,
+	MN_CMOVS,
+	MN_CMOVNS,
+	MN_CMOVP,
+	MN_CMOVNP,
+	MN_CMOVL,
+	MN_CMOVGE,
+	MN_CMOVNG,
+	MN_CMOVG,
+	MN_MOVMSKPS,
+	MN_MOVMSKPD,
+	MN_MOVMSKPD,
+	MN_SQRTPS,
+	MN_SQRTSS,
+	MN_SQRTPD,
+	MN_SQRTSD,
+	MN_RSQRTPS,
+	MN_RSQRTSS,
+	MN_RCPPS,
+	MN_RCPSS,
+	MN_ANDPS,
+	MN_ANDPD,
+	MN_ANDNPS,
+	MN_ANDNPD,
+	MN_ORPS,
+	MN_ORPD,
+	MN_XORPS,
+	MN_XORPD,
+	MN_ADDPS,
+	MN_ADDSS,
+	MN_ADDPD,
+	MN_ADDSD,
+	MN_MULPS,
+	MN_MULSS,
+	MN_MULPD,
+	MN_ADDSD,
+	MN_CVTPS2PD,
+	MN_CVTPD2PS,
+	MN_CVTSS2SD,
+	MN_CVTSD2SS,
+	MN_CVTDQ2PS,
+	MN_CVTPS2DQ,
+	MN_CVTTPS2DQ,
+	MN_SUBPS,
+	MN_SUBSS,
+	MN_SUBPD,
+	MN_SUBSD,
+	MN_MINPS,
+	MN_MINSS,
+	MN_MINPD,
+	MN_MINSD,
+	MN_DIVPS,
+	MN_DIVSS,
+	MN_DIVPD,
+	MN_DIVSD,
+	MN_MAXPS,
+	MN_MAXSS,
+	MN_MAXPD,
+	MN_MAXSD,
+	MN_PUNPCKLBW,
+	MN_PUNPCKLBW,
+	MN_PUNPCKLBD,
+	MN_PUNPCKLBD,
+	MN_PUNPCKLBQ,
+	MN_PUNPCKLBQ,
+	MN_PACKSSWB,
+	MN_PACKSSWB,
+	MN_PCMPGTB,
+	MN_PCMPGTB,
+	MN_PCMPGTW,
+	MN_PCMPGTW,
+	MN_PCMPGTD,
+	MN_PCMPGTD,
+	MN_PACKUSWB,
+	MN_PACKUSWB,
+	MN_PUNPCKHBW,
+	MN_PUNPCKHBW,
+	MN_PUNPCKHWD,
+	MN_PUNPCKHWD,
+	MN_PUNPCKHDQ,
+	MN_PUNPCKHDQ,
+	MN_PACKSSDW,
+	MN_PACKSSDW,
+	MN_PUNPCKLQDQ,
+	MN_PUNPCKHQDQ,
+	MN_MOVD,
+	MN_MOVD,
+	MN_MOVQ,
+	MN_MOVDQA,
+	MN_MOVDQU,
+	MN_PSHUFW,
+	MN_PSHUFLW,
+	MN_PSHUFHW,
+	MN_PSHUFD,
+	MN_PSRLW,
+	MN_PSRLW,
+	MN_PSRAW,
+	MN_PSRAW,
+	MN_PSLLW,
+	MN_PSLLW,
+	MN_PSRLD,
+	MN_PSRLD,
+	MN_PSRAD,
+	MN_PSRAD,
+	MN_PSLLD,
+	MN_PSLLD,
+	MN_PSRLD,
+	MN_PSRLD,
+	MN_PSRAD,
+	MN_PSRAD,
+	MN_PSLLD,
+	MN_PSLLD,
+	MN_PCMPEQB,
+	MN_PCMPEQB,
+	MN_PCMPEQW,
+	MN_PCMPEQW,
+	MN_PCMPEQD,
+	MN_PCMPEQD,
+	MN_EMMS,
+	MN_VMREAD,
+	MN_VMWRITE,
+	MN_HADDPD,
+	MN_HADDPS,
+	MN_HSUBPD,
+	MN_HSUBPS,
+	MN_MOVD,
+	MN_MOVD,
+	MN_MOVQ,
+	MN_MOVQ,
+	MN_MOVDQA,
+	MN_MOVDQU,
+	MN_LONG_JO,
+	MN_LONG_JNO,
+	MN_LONG_JB,
+	MN_LONG_JNB,
+	MN_LONG_JE,
+	MN_LONG_JNE,
+	MN_LONG_JNA,
+	MN_LONG_JA,
+	MN_LONG_JS,
+	MN_LONG_JNS,
+	MN_LONG_JP,
+	MN_LONG_JNP,
+	MN_LONG_JL,
+	MN_LONG_JNL,
+	MN_LONG_JNG,
+	MN_LONG_JG,
+	MN_SETO,
+	MN_SETNO,
+	MN_SETB,
+	MN_SETNB,
+	MN_SETE,
+	MN_SETNE,
+	MN_SETNA,
+	MN_SETA,
+	MN_SETS,
+	MN_SETNS,
+	MN_SETP,
+	MN_SETNP,
+	MN_SETL,
+	MN_SETNL,
+	MN_SETNG,
+	MN_SETG,
+	MN_PUSH,
+	MN_POP,
+	MN_CPUID,
+	MN_BT,
+	MN_SHLD,
+	MN_SHLD,
+	MN_PUSH,
+	MN_POP,
+	MN_RSM,
+	MN_BTS,
+	MN_SHRD,
+	MN_SHRD,
+	MN_FXSAVE,
+	MN_FXRSTOR,
+	MN_LDMXCSR,
+	MN_STMXCSR,
+	MN_XSAVE,
+	MN_LFENCE,
+	MN_XRSTOR,
+	MN_MFENCE,
+	MN_SFENCE,
+	MN_CLFLUSH,
+	MN_IMUL,
+	MN_CMPXCHG,
+	MN_CMPXCHG,
+	MN_LSS,
+	MN_BTR,
+	MN_LFS,
+	MN_LGS,
+	MN_MOVZX,
+	MN_MOVZX,
+	MN_POPCNT,
+	MN_UD,
+	MN_BT,
+	MN_BTS,
+	MN_BTR,
+	MN_BTC,
+	MN_BTC,
+	MN_BSF,
+	MN_BSR,
+	MN_MOVSX,
+	MN_MOVSX,
+	MN_XADD,
+	MN_XADD,
+	MN_CMPPS,
+	MN_CMPSS,
+	MN_CMPPD,
+	MN_CMPSD,
+	MN_MOVNTI,
+	MN_PINSRW,
+	MN_PINSRW,
+	MN_PEXTRW,
+	MN_PEXTRW,
+	MN_SHUFPS,
+	MN_SHUFPD,
+	MN_CMPXCHG8B,
+	MN_VMPTRLD,
+	MN_VMCLEAN,
+	MN_VMXON,
+	MN_VMPTRST,
+	MN_BSWAP,
+	MN_ADDSUBPD,
+	MN_ADDSUBPD,
+	MN_PSRLW,
+	MN_PSRLW,
+	MN_PSRLD,
+	MN_PSRLD,
+	MN_PSRLQ,
+	MN_PSRLQ,
+	MN_PADDQ,
+	MN_PADDQ,
+	MN_PMULLW,
+	MN_PMULLW,
+	MN_MOVQ,
+	MN_MOVQ2DQ,
+	MN_MOVDQ2Q,
+	MN_PMOVMSKB,
+	MN_PMOVMSKB,
+	MN_PSUBUSB,
+	MN_PSUBUSB,
+	MN_PSUBUSW,
+	MN_PSUBUSW,
+	MN_PMINUB,
+	MN_PMINUB,
+	MN_PAND,
+	MN_PAND,
+	MN_PADDUSB,
+	MN_PADDUSB,
+	MN_PADDUSW,
+	MN_PADDUSW,
+	MN_PMAXUB,
+	MN_PMAXUB,
+	MN_PANDN,
+	MN_PANDN,
+	MN_PAVGB,
+	MN_PAVGB,
+	MN_PSRAW,
+	MN_PSRAW,
+	MN_PSRAD,
+	MN_PSRAD,
+	MN_PAVGW,
+	MN_PAVGW,
+	MN_PMULHUW,
+	MN_PMULHUW,
+	MN_PMULHW,
+	MN_PMULHW,
+	MN_CVTPD2DQ,
+	MN_CVTTPD2DQ,
+	MN_CVTDQ2PD,
+	MN_MOVNTQ,
+	MN_MOVNTDQ,
+	MN_PSUBSB,
+	MN_PSUBSB,
+	MN_PSUBSW,
+	MN_PSUBSW,
+	MN_PMINSW,
+	MN_PMINSW,
+	MN_POR,
+	MN_POR,
+	MN_PADDSB,
+	MN_PADDSB,
+	MN_PADDSW,
+	MN_PADDSW,
+	MN_PMAXSW,
+	MN_PMAXSW,
+	MN_PXOR,
+	MN_PXOR,
+	MN_LDDQU,
+	MN_PSLLW,
+	MN_PSLLW,
+	MN_PSLLD,
+	MN_PSLLD,
+	MN_PSLLQ,
+	MN_PSLLQ,
+	MN_PMULUDQ,
+	MN_PMULUDQ,
+	MN_PMADDWD,
+	MN_PMADDWD,
+	MN_PSADBW,
+	MN_PSADBW,
+	MN_MASKMOVQ,
+	MN_MASKMOVDQU,
+	MN_PSUBB,
+	MN_PSUBB,
+	MN_PSUBW,
+	MN_PSUBW,
+	MN_PSUBD,
+	MN_PSUBD,
+	MN_PSUBQ,
+	MN_PSUBQ,
+	MN_PADDB,
+	MN_PADDB,
+	MN_PADDW,
+	MN_PADDW,
+	MN_PADDD,
+	MN_PADDD,
+	MN_ADC,
+	MN_ADC,
+	MN_ADC,
+	MN_ADC,
+	MN_ADC,
+	MN_ADC,
+	MN_PUSH,
+	MN_POP,
+	MN_SBB,
+	MN_SBB,
+	MN_SBB,
+	MN_SBB,
+	MN_SBB,
+	MN_SBB,
+	MN_PUSH,
+	MN_POP,
+	MN_AND,
+	MN_AND,
+	MN_AND,
+	MN_AND,
+	MN_AND,
+	MN_AND,
+	MN_DAA,
+	MN_SUB,
+	MN_SUB,
+	MN_SUB,
+	MN_SUB,
+	MN_SUB,
+	MN_SUB,
+	MN_DAS,
+	MN_XOR,
+	MN_XOR,
+	MN_XOR,
+	MN_XOR,
+	MN_XOR,
+	MN_XOR,
+	MN_AAA,
+	MN_CMP,
+	MN_CMP,
+	MN_CMP,
+	MN_CMP,
+	MN_CMP,
+	MN_CMP,
+	MN_AAS,
+	MN_INC,
+	MN_DEC,
+	MN_PUSH,
+	MN_POP,
+	MN_PUSHAD,
+	MN_POPAD,
+	MN_BOUND,
+	MN_ARPL,
+	MN_ARPL,
+	MN_PUSH,
+	MN_IMUL,
+	MN_PUSH,
+	MN_IMUL,
+	MN_INSB,
+	MN_INSD,
+	MN_OUTSB,
+	MN_OUTSD,
+	MN_JO_SHORT,
+	MN_JNO_SHORT,
+	MN_JB_SHORT,
+	MN_JAE_SHORT,
+	MN_JE_SHORT,
+	MN_JNE_SHORT,
+	MN_JNA_SHORT,
+	MN_JA_SHORT,
+	MN_JS_SHORT,
+	MN_JNS_SHORT,
+	MN_JP_SHORT,
+	MN_JNP_SHORT,
+	MN_JL_SHORT,
+	MN_JGE_SHORT,
+	MN_JLE_SHORT,
+	MN_JG_SHORT,
+	MN_ADD,
+	MN_OR,
+	MN_ADC,
+	MN_SBB,
+	MN_AND,
+	MN_SUB,
+	MN_XOR,
+	MN_CMP,
+	MN_ADD,
+	MN_OR,
+	MN_ADC,
+	MN_SBB,
+	MN_AND,
+	MN_SUB,
+	MN_XOR,
+	MN_CMP,
+	MN_ADD,
+	MN_OR,
+	MN_ADC,
+	MN_SBB,
+	MN_AND,
+	MN_SUB,
+	MN_XOR,
+	MN_CMP,
+	MN_ADD,
+	MN_OR,
+	MN_ADC,
+	MN_SBB,
+	MN_AND,
+	MN_SUB,
+	MN_XOR,
+	MN_CMP,
+	MN_TEST,
+	MN_TEST,
+	MN_XCHG,
+	MN_XCHG,
+	MN_MOV,
+	MN_MOV,
+	MN_MOV,
+	MN_MOV,
+	MN_MOV,
+	MN_LEA,
+	MN_MOV,
+	MN_POP,
+	MN_NOP,
+	MN_XCHG,
+	MN_CBW,
+	MN_CWD,
+	MN_CALLF,
+	MN_FWAIT,
+	MN_PUSHFD,
+	MN_POPFD,
+	MN_SAHF,
+	MN_LAHF,
+	MN_MOV,
+	MN_MOV,
+	MN_MOV,
+	MN_MOV,
+	MN_MOVSB,
+	MN_MOVSW,
+	MN_CMPSB,
+	MN_CMPSW,
+	MN_TEST,
+	MN_TEST,
+	MN_STOSB,
+	MN_STOSW,
+	MN_LODSB,
+	MN_LODSW,
+	MN_SCASB,
+	MN_SCASW,
+	MN_MOV,
+	MN_MOV,
+	MN_ROL,
+	MN_ROR,
+	MN_RCL,
+	MN_RCR,
+	MN_SHL,
+	MN_SHR,
+	MN_SAL,
+	MN_SAR,
+	MN_ROL,
+	MN_ROR,
+	MN_RCL,
+	MN_RCR,
+	MN_SHL,
+	MN_SHR,
+	MN_SAL,
+	MN_SAR,
+	MN_RET,
+	MN_RETN,
+	MN_LES,
+	MN_LDS,
+	MN_MOV,
+	MN_MOV,
+	MN_MOV,
+	MN_ENTER,
+	MN_LEAVE,
+	MN_RETF,
+	MN_RETF,
+	MN_INT_3,
+	MN_INT,
+	MN_INTO,
+	MN_IRETD,
+	MN_ROL,
+	MN_ROR,
+	MN_RCL,
+	MN_RCR,
+	MN_SHL,
+	MN_SHR,
+	MN_SHL,
+	MN_SHR,
+	MN_ROL,
+	MN_ROR,
+	MN_RCL,
+	MN_RCR,
+	MN_SHL,
+	MN_SHR,
+	MN_SHL,
+	MN_SHR,
+	MN_ROL,
+	MN_ROR,
+	MN_RCL,
+	MN_RCR,
+	MN_SHL,
+	MN_SHR,
+	MN_SHL,
+	MN_SHR,
+	MN_ROL,
+	MN_ROR,
+	MN_RCL,
+	MN_RCR,
+	MN_SHL,
+	MN_SHR,
+	MN_SHL,
+	MN_SHR,
+	MN_AAM,
+	MN_AAD,
+	MN_SETALC,
+	MN_XLATB,
+	MN_FADD,
+	MN_FMUL,
+	MN_FCOM,
+	MN_FCOMP,
+	MN_FSUB,
+	MN_FSUBR,
+	MN_FDIV,
+	MN_FDIVR,
+	MN_FADD,
+	MN_FMUL,
+	MN_FCOM,
+	MN_FCOMP,
+	MN_FSUB,
+	MN_FSUBR,
+	MN_FDIV,
+	MN_FDIVR,
+	MN_FLD,
+	MN_FXCH,
+	MN_FST,
+	MN_FSTP,
+	MN_FLDENV,
+	MN_FLDCW,
+	MN_FNSTENV,
+	MN_FNSTCW,
+	MN_FCMOVB,
+	MN_FCMOVE,
+	MN_FCMOVBE,
+	MN_FCMOVU,
+	MN_FISUB,
+	MN_FISUBR,
+	MN_FIDIV,
+	MN_FIDIVR,
+	MN_FIADD,
+	MN_FIMUL,
+	MN_FICOM,
+	MN_FICOMP,
+	MN_FISUB,
+	MN_FISUBR,
+	MN_FIDIV,
+	MN_FIDIVR,
+	MN_FCMOVNB,
+	MN_FCMOVNE,
+	MN_FCMOVNBE,
+	MN_FCMOVNU,
+	MN_FILD,
+	MN_FISTTP,
+	MN_FIST,
+	MN_FISTP,
+	MN_FINIT,
+	MN_FUCOMI,
+	MN_FCOMI,
+	MN_FSTP,
+	MN_FADD,
+	MN_FMUL,
+	MN_FCOM,
+	MN_FCOMP,
+	MN_FSUB,
+	MN_FSUBR,
+	MN_FDIV,
+	MN_FDIVR,
+	MN_FADD,
+	MN_FMUL,
+	MN_FCOM,
+	MN_FCOMP,
+	MN_FSUB,
+	MN_FSUBR,
+	MN_FDIV,
+	MN_FDIVR,
+	MN_FFREE,
+	MN_FLD,
+	MN_FISTTP,
+	MN_FST,
+	MN_FSTP,
+	MN_FRSTOR,
+	MN_FUCOMP,
+	MN_FNSAVE,
+	MN_FNSTSW,
+	MN_FADDP,
+	MN_FMULP,
+	MN_FICOM,
+	MN_FICOMP,
+	MN_FSUBRP,
+	MN_FSUBP,
+	MN_FDIVRP,
+	MN_FDIVP,
+	MN_FIADD,
+	MN_FIMUL,
+	MN_FICOM,
+	MN_FICOMP,
+	MN_FISUB,
+	MN_FISUBR,
+	MN_FIDIV,
+	MN_FDIVR,
+	MN_FFREEP,
+	MN_FISTTP,
+	MN_FIST,
+	MN_FISTP,
+	MN_FNSTSW,
+	MN_FUCOMIP,
+	MN_FCOMIP,
+	MN_FISTP,
+	MN_FILD,
+	MN_FISTTP,
+	MN_FIST,
+	MN_FISTP,
+	MN_FBLD,
+	MN_FILD,
+	MN_FBSTP,
+	MN_FISTP,
+	MN_LOOPNE,
+	MN_LOOPE,
+	MN_LOOP,
+	MN_JECXZ,
+	MN_IN,
+	MN_IN,
+	MN_OUT,
+	MN_OUT,
+	MN_CALL,
+	MN_JMP,
+	MN_JMPF,
+	MN_JMP_SHORT,
+	MN_IN,
+	MN_IN,
+	MN_OUT,
+	MN_OUT,
+	MN_INT_1,
+	MN_HLT,
+	MN_CMC,
+	MN_TEST,
+	MN_TEST,
+	MN_NOT,
+	MN_NEG,
+	MN_MUL,
+	MN_IMUL,
+	MN_DIV,
+	MN_IDIV,
+	MN_TEST,
+	MN_TEST,
+	MN_NOT,
+	MN_NEG,
+	MN_MUL,
+	MN_IMUL,
+	MN_DIV,
+	MN_IDIV,
+	MN_CLC,
+	MN_STC,
+	MN_CLI,
+	MN_STI,
+	MN_CLD,
+	MN_STD,
+	MN_INC,
+	MN_DEC,
+	MN_INC,
+	MN_DEC,
+	MN_INC,
+	MN_DEC,
+	MN_CALL,
+	MN_CALLF,
+	MN_JMP,
+	MN_JMPF,
+	MN_PUSH,
+	MN_PUSH,
+	MN_MOVSXD,
+};
+
+constexpr const char* disa_mnemonic_name(const disa_mnemonic mnemonic)
+{
+	return (mnemonic < MN_COUNT) ? disa_mnemonic_names[mnemonic] : "???";
+}
+
+constexpr const char* disa_form_name(const disa_form form)
+{
+	return (form < FORM_COUNT) ? disa_form_names[form] : "???";
+}
+
+constexpr disa_mnemonic disa_form_mnemonic(const disa_form form)
+{
+	return (form < FORM_COUNT) ? disa_form_mnemonics[form] : MN_NONE;
+}
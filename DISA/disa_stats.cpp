@@ -0,0 +1,243 @@
+#include "disa_stats.hpp"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <mutex>
+
+#ifdef DISA_INSTRUMENT
+// the counters of the running threads, and what the finished ones counted
+static std::mutex& registry_lock()
+{
+	static std::mutex lock;
+	return lock;
+}
+
+static std::vector<disa_stats_counters*>& registry()
+{
+	static std::vector<disa_stats_counters*> threads;
+	return threads;
+}
+
+static disa_stats& retired()
+{
+	static disa_stats stats;
+	return stats;
+}
+
+static disa_stats& baseline() // totals at the last reset
+{
+	static disa_stats stats;
+	return stats;
+}
+
+static void add(disa_stats& to, const disa_stats_counters& from)
+{
+	const auto get = [](const std::atomic<std::uint64_t>& counter)
+	{
+		return counter.load(std::memory_order_relaxed);
+	};
+
+	to.instructions += get(from.instructions);
+	to.unknown += get(from.unknown);
+	to.bytes_formatted += get(from.bytes_formatted);
+	to.allocations += get(from.allocations);
+
+	for (std::size_t i = 0; i < FORM_COUNT; i++) to.forms[i] += get(from.forms[i]);
+	for (std::size_t i = 0; i < DISA_STATS_PREFIXES; i++) to.prefixes[i] += get(from.prefixes[i]);
+	for (std::size_t i = 0; i < DISA_STATS_BUCKETS; i++) to.latency[i] += get(from.latency[i]);
+}
+
+// Owns a thread's counters; hands what they counted over to retired() when the thread ends
+struct disa_stats_thread
+{
+	disa_stats_counters* counters;
+
+	disa_stats_thread()
+		: counters(new disa_stats_counters())
+	{
+		std::lock_guard<std::mutex> guard(registry_lock());
+		registry().push_back(counters);
+	}
+
+	~disa_stats_thread()
+	{
+		std::lock_guard<std::mutex> guard(registry_lock());
+		add(retired(), *counters);
+
+		auto& threads = registry();
+		threads.erase(std::find(threads.begin(), threads.end(), counters));
+		delete counters;
+	}
+};
+
+disa_stats_counters& disa_thread_stats()
+{
+	thread_local disa_stats_thread thread;
+	return *thread.counters;
+}
+
+// Everything counted since the start, with the lock held
+static disa_stats totals()
+{
+	disa_stats stats = retired();
+
+	for (const auto counters : registry())
+	{
+		add(stats, *counters);
+	}
+
+	return stats;
+}
+#endif
+
+disa_stats disa_get_stats()
+{
+	disa_stats stats;
+#ifdef DISA_INSTRUMENT
+	std::lock_guard<std::mutex> guard(registry_lock());
+	stats = totals();
+
+	const disa_stats& base = baseline();
+	stats.enabled = true;
+	stats.instructions -= base.instructions;
+	stats.unknown -= base.unknown;
+	stats.bytes_formatted -= base.bytes_formatted;
+	stats.allocations -= base.allocations;
+
+	for (std::size_t i = 0; i < FORM_COUNT; i++) stats.forms[i] -= base.forms[i];
+	for (std::size_t i = 0; i < DISA_STATS_PREFIXES; i++) stats.prefixes[i] -= base.prefixes[i];
+	for (std::size_t i = 0; i < DISA_STATS_BUCKETS; i++) stats.latency[i] -= base.latency[i];
+#endif
+	return stats;
+}
+
+void disa_reset_stats()
+{
+#ifdef DISA_INSTRUMENT
+	// the counters belong to their threads, so they're left alone
+	// and what they hold now is subtracted from later snapshots
+	std::lock_guard<std::mutex> guard(registry_lock());
+	baseline() = totals();
+#endif
+}
+
+const char* disa_prefix_name(const std::size_t bit)
+{
+	static const char* const names[DISA_STATS_PREFIXES] = { "repne", "repe", "66", "67", "lock", "cs", "ss", "ds", "es", "fs", "gs", "rex", "rex.w" };
+	return (bit < DISA_STATS_PREFIXES) ? names[bit] : "";
+}
+
+// Form IDs sorted by how often they were decoded, most first (only the ones that were)
+static std::vector<std::size_t> forms_by_count(const disa_stats& stats)
+{
+	std::vector<std::size_t> forms;
+
+	for (std::size_t i = 0; i < FORM_COUNT; i++)
+	{
+		if (stats.forms[i])
+		{
+			forms.push_back(i);
+		}
+	}
+
+	std::stable_sort(forms.begin(), forms.end(), [&stats](const std::size_t a, const std::size_t b)
+	{
+		return stats.forms[a] > stats.forms[b];
+	});
+
+	return forms;
+}
+
+static void append(std::string& out, const char* format, ...)
+{
+	char line[256];
+
+	va_list args;
+	va_start(args, format);
+	std::vsnprintf(line, sizeof(line), format, args);
+	va_end(args);
+
+	out += line;
+}
+
+std::string disa_stats_text(const disa_stats& stats, const std::size_t top)
+{
+	std::string out;
+
+	if (!stats.enabled)
+	{
+		return "disa stats: not built with DISA_INSTRUMENT\n";
+	}
+
+	const double n = stats.instructions ? double(stats.instructions) : 1.0;
+
+	append(out, "instructions     %llu\n", static_cast<unsigned long long>(stats.instructions));
+	append(out, "unknown          %llu (%.2f%%)\n", static_cast<unsigned long long>(stats.unknown), stats.unknown * 100.0 / n);
+	append(out, "bytes formatted  %llu\n", static_cast<unsigned long long>(stats.bytes_formatted));
+	append(out, "allocations      %llu (%.2f per instruction)\n", static_cast<unsigned long long>(stats.allocations), stats.allocations / n);
+
+	out += "prefixes        ";
+
+	for (std::size_t i = 0; i < DISA_STATS_PREFIXES; i++)
+	{
+		if (stats.prefixes[i])
+		{
+			append(out, " %s %llu", disa_prefix_name(i), static_cast<unsigned long long>(stats.prefixes[i]));
+		}
+	}
+
+	out += "\nlatency (cycles)\n";
+
+	for (std::size_t i = 0; i < DISA_STATS_BUCKETS; i++)
+	{
+		if (stats.latency[i])
+		{
+			append(out, "  %10llu+  %llu\n", 1ull << i, static_cast<unsigned long long>(stats.latency[i]));
+		}
+	}
+
+	const auto forms = forms_by_count(stats);
+	append(out, "top forms (%zu of %zu seen)\n", std::min(top, forms.size()), forms.size());
+
+	for (std::size_t i = 0; i < forms.size() && i < top; i++)
+	{
+		const std::uint64_t count = stats.forms[forms[i]];
+		append(out, "  %10llu  %5.2f%%  %s\n", static_cast<unsigned long long>(count), count * 100.0 / n, disa_form_name(static_cast<disa_form>(forms[i])));
+	}
+
+	return out;
+}
+
+std::string disa_stats_json(const disa_stats& stats)
+{
+	std::string out;
+
+	append(out, "{\"enabled\":%s,\"instructions\":%llu,\"unknown\":%llu,\"bytes_formatted\":%llu,\"allocations\":%llu,\"prefixes\":{",
+		stats.enabled ? "true" : "false", static_cast<unsigned long long>(stats.instructions), static_cast<unsigned long long>(stats.unknown),
+		static_cast<unsigned long long>(stats.bytes_formatted), static_cast<unsigned long long>(stats.allocations));
+
+	for (std::size_t i = 0; i < DISA_STATS_PREFIXES; i++)
+	{
+		append(out, "%s\"%s\":%llu", i ? "," : "", disa_prefix_name(i), static_cast<unsigned long long>(stats.prefixes[i]));
+	}
+
+	out += "},\"latency\":[";
+
+	for (std::size_t i = 0; i < DISA_STATS_BUCKETS; i++)
+	{
+		append(out, "%s%llu", i ? "," : "", static_cast<unsigned long long>(stats.latency[i]));
+	}
+
+	// only the forms that were decoded, most first (form names have no quotes or backslashes)
+	out += "],\"forms\":[";
+
+	const auto forms = forms_by_count(stats);
+
+	for (std::size_t i = 0; i < forms.size(); i++)
+	{
+		append(out, "%s{\"form\":%zu,\"name\":\"%s\",\"count\":%llu}", i ? "," : "", forms[i], disa_form_name(static_cast<disa_form>(forms[i])), static_cast<unsigned long long>(stats.forms[forms[i]]));
+	}
+
+	out += "]}";
+	return out;
+}
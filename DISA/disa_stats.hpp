@@ -0,0 +1,135 @@
+#pragma once
+#include "disa.hpp"
+
+// Counters compiled into the decoder: which opcode forms a workload
+// decodes, how often it falls back to "???", which prefixes it sees, how
+// long each decode takes, and how much text and how many heap allocations
+// the decoding costs. For finding the hot paths without a profiler.
+//
+// They only exist when every file of DISA is built with DISA_INSTRUMENT
+// defined. Otherwise the decoder has no extra code at all, and
+// disa_get_stats() returns a snapshot with `enabled` false.
+// Each thread counts into its own counters, so counting never locks.
+//
+//	std::cout << disa_stats_text(disa_get_stats());
+
+constexpr std::size_t DISA_STATS_PREFIXES = 13; // one per PRE_* bit, PRE_REPNE to PRE_REX_W
+constexpr std::size_t DISA_STATS_BUCKETS = 32;
+
+struct disa_stats
+{
+	bool enabled = false;
+
+	std::uint64_t instructions = 0; // decoded
+	std::uint64_t unknown = 0; // decoded as "???"
+	std::uint64_t forms[FORM_COUNT] = {}; // by disa_form
+	std::uint64_t prefixes[DISA_STATS_PREFIXES] = {}; // by PRE_* bit (see disa_prefix_name)
+
+	// latency[i]: decodes that took [2^i, 2^(i+1)) cycles
+	// (rdtsc; nanoseconds on targets without it)
+	std::uint64_t latency[DISA_STATS_BUCKETS] = {};
+
+	std::uint64_t bytes_formatted = 0; // text written by disa_format
+	std::uint64_t allocations = 0; // heap allocations made for disa_inst, disa_read, disa_format and disa_batch
+};
+
+// Everything counted since the start (or the last disa_reset_stats), by all threads
+disa_stats disa_get_stats();
+void disa_reset_stats();
+
+const char* disa_prefix_name(const std::size_t bit); // "repne", "repe", "66", "67", "lock", "cs"... "rex", "rex.w"
+
+// `top`: how many of the most decoded forms to list
+std::string disa_stats_text(const disa_stats& stats, const std::size_t top = 20);
+std::string disa_stats_json(const disa_stats& stats);
+
+#ifdef DISA_INSTRUMENT
+#include <atomic>
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+// What DISA itself uses to count
+
+// One thread's counters. Only that thread writes them (a load and a
+// store, no locked instruction); disa_get_stats reads them at any time
+struct disa_stats_counters
+{
+	std::atomic<std::uint64_t> instructions;
+	std::atomic<std::uint64_t> unknown;
+	std::atomic<std::uint64_t> forms[FORM_COUNT];
+	std::atomic<std::uint64_t> prefixes[DISA_STATS_PREFIXES];
+	std::atomic<std::uint64_t> latency[DISA_STATS_BUCKETS];
+	std::atomic<std::uint64_t> bytes_formatted;
+	std::atomic<std::uint64_t> allocations;
+};
+
+disa_stats_counters& disa_thread_stats();
+
+inline void disa_stats_add(std::atomic<std::uint64_t>& counter, const std::uint64_t n)
+{
+	counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+inline std::uint64_t disa_stats_clock()
+{
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64)) || defined(__i386__) || defined(__x86_64__)
+	return __rdtsc();
+#else
+	return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+inline void disa_stats_decoded(const disa_record& record, const std::uint64_t start)
+{
+	auto& counters = disa_thread_stats();
+	const std::uint64_t elapsed = disa_stats_clock() - start;
+
+	disa_stats_add(counters.instructions, 1);
+
+	if (record.row == DISA_NO_ROW)
+	{
+		disa_stats_add(counters.unknown, 1);
+	}
+	else
+	{
+		disa_stats_add(counters.forms[record.row], 1);
+	}
+
+	for (std::size_t bit = 0; (record.prefix >> bit) && bit < DISA_STATS_PREFIXES; bit++)
+	{
+		if ((record.prefix >> bit) & 1)
+		{
+			disa_stats_add(counters.prefixes[bit], 1);
+		}
+	}
+
+	std::size_t bucket = 0;
+
+	while ((elapsed >> (bucket + 1)) && bucket + 1 < DISA_STATS_BUCKETS)
+	{
+		bucket++;
+	}
+
+	disa_stats_add(counters.latency[bucket], 1);
+}
+
+inline void disa_stats_formatted(const std::size_t bytes)
+{
+	disa_stats_add(disa_thread_stats().bytes_formatted, bytes);
+}
+
+inline void disa_stats_allocated(const std::size_t allocations)
+{
+	disa_stats_add(disa_thread_stats().allocations, allocations);
+}
+
+// Wraps the statements that only exist with DISA_INSTRUMENT
+#define DISA_STATS(...) __VA_ARGS__
+#else
+#define DISA_STATS(...)
+#endif
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+# Compares two outputs of Benchmarks/disa_bench and flags the modes that got slower:
+#
+#   python3 Tools/disa_bench_compare.py before.json after.json [--threshold 5]
+#
+# Exits with 1 if any mode's ns/instruction grew by more than the threshold (percent),
+# or if it allocates more per instruction than before.
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+
+    return {(c["name"], m["mode"]): (c, m) for c in data["corpora"] for m in c["modes"]}
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("before")
+    parser.add_argument("after")
+    parser.add_argument("--threshold", type=float, default=5.0)
+    args = parser.parse_args()
+
+    before = load(args.before)
+    after = load(args.after)
+    regressed = False
+
+    print(f"{'corpus':<16}{'mode':<12}{'ns/inst':>10}{'':>4}{'ns/inst':>10}{'change':>10}{'allocs/inst':>14}")
+
+    for key in sorted(after):
+        if key not in before:
+            continue
+
+        old_corpus, old = before[key]
+        new_corpus, new = after[key]
+
+        if old_corpus["hash"] != new_corpus["hash"]:
+            print(f"{key[0]:<16}{key[1]:<12}  corpus changed, not compared")
+            continue
+
+        change = (new["ns_per_instruction"] / old["ns_per_instruction"] - 1) * 100 if old["ns_per_instruction"] else 0.0
+        flag = ""
+
+        if change > args.threshold or new["allocations_per_instruction"] > old["allocations_per_instruction"]:
+            flag = "  <-- regression"
+            regressed = True
+
+        print(f"{key[0]:<16}{key[1]:<12}{old['ns_per_instruction']:>10.2f}{'->':>4}{new['ns_per_instruction']:>10.2f}{change:>+9.1f}%"
+              f"{old['allocations_per_instruction']:>7.2f}->{new['allocations_per_instruction']:<5.2f}{flag}")
+
+    return 1 if regressed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
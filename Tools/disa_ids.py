@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+# Generates DISA/disa_ids.hpp from the rows of disa_optable in DISA/disa.cpp.
+# Run it from the repository root after changing the table:
+#
+#   python3 Tools/disa_ids.py
+#
+# disa.cpp checks at compile time that the generated header matches the table.
+
+import re
+import sys
+from collections import Counter
+
+SOURCE = "DISA/disa.cpp"
+OUTPUT = "DISA/disa_ids.hpp"
+
+
+def read_rows():
+    with open(SOURCE, newline="") as f:
+        text = f.read()
+
+    start = text.index("disa_optable[] =")
+    end = text.index("\n};", start)
+
+    return re.findall(r'\{\s*"([^"]*)",\s*"([^"]*)",\s*\{([^}]*)\},\s*"[^"]*"\s*\}', text[start:end])
+
+
+def identifier(text):
+    return re.sub(r"[^A-Z0-9]+", "_", text.upper()).strip("_")
+
+
+def operand_token(optype):
+    return identifier(optype.replace("r_m", "rm"))
+
+
+def operand_text(optype):
+    for a, b in (("r_m", "r/m"), ("xmm_m", "xmm/m"), ("mm_m", "mm/m"), ("_and_", "&"), ("16_32", "16/32")):
+        optype = optype.replace(a, b)
+    return optype
+
+
+def main():
+    rows = read_rows()
+
+    if not rows:
+        sys.exit("no rows found in " + SOURCE)
+
+    mnemonics = sorted(set(row[1] for row in rows))
+
+    forms = []
+    for code, name, operands, in rows:
+        optypes = [x.strip() for x in operands.split(",") if x.strip()]
+        forms.append({
+            "id": "_".join(["FORM", identifier(name)] + [operand_token(x) for x in optypes]),
+            "code": code,
+            "mnemonic": "MN_" + identifier(name),
+            "text": (name + " " + ", ".join(operand_text(x) for x in optypes)).strip(),
+        })
+
+    # the same mnemonic and operands can be encoded more than one way
+    counts = Counter(form["id"] for form in forms)
+    for form in forms:
+        if counts[form["id"]] > 1:
+            form["id"] += "_" + identifier(form["code"].replace("+", "_"))
+
+    counts = Counter(form["id"] for form in forms)
+    seen = Counter()
+    for form in forms:
+        if counts[form["id"]] > 1:
+            seen[form["id"]] += 1
+            form["id"] += "_" + str(seen[form["id"]])
+
+    out = []
+    out.append("#pragma once")
+    out.append("#include <cstdint>")
+    out.append("")
+    out.append("// Generated by Tools/disa_ids.py from disa_optable. Don't edit by hand.")
+    out.append("")
+    out.append("// Every distinct opcode_name in the table")
+    out.append("enum disa_mnemonic : std::uint16_t")
+    out.append("{")
+    out.append("\tMN_NONE, // ???")
+    for name in mnemonics:
+        out.append("\tMN_%s, // %s" % (identifier(name), name))
+    out.append("\tMN_COUNT")
+    out.append("};")
+    out.append("")
+    out.append("// Every row of the table, in order (a form is the row index)")
+    out.append("enum disa_form : std::uint16_t")
+    out.append("{")
+    for form in forms:
+        out.append("\t%s, // %s" % (form["id"], form["code"]))
+    out.append("\tFORM_COUNT,")
+    out.append("\tFORM_NONE = 0xFFFF // same as DISA_NO_ROW")
+    out.append("};")
+    out.append("")
+    out.append("constexpr const char* disa_mnemonic_names[MN_COUNT] =")
+    out.append("{")
+    out.append('\t"???",')
+    for name in mnemonics:
+        out.append('\t"%s",' % name)
+    out.append("};")
+    out.append("")
+    out.append("constexpr const char* disa_form_names[FORM_COUNT] =")
+    out.append("{")
+    for form in forms:
+        out.append('\t"%s",' % form["text"])
+    out.append("};")
+    out.append("")
+    out.append("constexpr disa_mnemonic disa_form_mnemonics[FORM_COUNT] =")
+    out.append("{")
+    for form in forms:
+        out.append("\t%s," % form["mnemonic"])
+    out.append("};")
+    out.append("")
+    out.append("constexpr const char* disa_mnemonic_name(const disa_mnemonic mnemonic)")
+    out.append("{")
+    out.append('\treturn (mnemonic < MN_COUNT) ? disa_mnemonic_names[mnemonic] : "???";')
+    out.append("}")
+    out.append("")
+    out.append("constexpr const char* disa_form_name(const disa_form form)")
+    out.append("{")
+    out.append('\treturn (form < FORM_COUNT) ? disa_form_names[form] : "???";')
+    out.append("}")
+    out.append("")
+    out.append("constexpr disa_mnemonic disa_form_mnemonic(const disa_form form)")
+    out.append("{")
+    out.append("\treturn (form < FORM_COUNT) ? disa_form_mnemonics[form] : MN_NONE;")
+    out.append("}")
+    out.append("")
+
+    with open(OUTPUT, "w", newline="") as f:
+        f.write("\r\n".join(out))
+
+
+if __name__ == "__main__":
+    main()